@@ -0,0 +1,92 @@
+/*
+    Author: Maciej Cieslik
+
+    Measures throughput of cutting the lawn depending on the number of cutting threads.
+    The lawn has the finest grid (1 cm fields on 10 x 10 m) and the biggest blade, so every cut
+    covers tens of thousands of fields. Every configuration cuts the same sections at different angles.
+    Usage: CutBenchmark [sections_number]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "Config.h"
+#include "Lawn.h"
+#include "MathHelper.h"
+
+using namespace std;
+
+namespace {
+    constexpr unsigned int LAWN_SIZE_CM = 1000;
+    constexpr double SECTION_LENGTH_CM = 100.0;
+    constexpr int DEFAULT_SECTIONS_NUMBER = 400;
+
+    struct Section {
+        pair<double, double> beginning_;
+        pair<double, double> ending_;
+        unsigned short angle_;
+    };
+
+    // Sections start on a grid of points and go in different directions, all of them stay inside the lawn.
+    vector<Section> createSections(int sections_number) {
+        vector<Section> sections;
+        double margin = SECTION_LENGTH_CM + 100.0;
+        double span = LAWN_SIZE_CM - 2.0 * margin;
+
+        for (int i = 0; i < sections_number; ++i) {
+            Section section;
+            section.angle_ = static_cast<unsigned short>((i * 37) % 360);
+            double angle_in_radians = MathHelper::convertDegreesToRadians(section.angle_);
+            section.beginning_ = make_pair(margin + fmod(i * 131.0, span), margin + fmod(i * 71.0, span));
+            section.ending_ = make_pair(section.beginning_.first + sin(angle_in_radians) * SECTION_LENGTH_CM,
+                section.beginning_.second + cos(angle_in_radians) * SECTION_LENGTH_CM);
+            sections.push_back(section);
+        }
+        return sections;
+    }
+
+    double measureCuttingTimeMs(unsigned int threads_number, const vector<Section>& sections) {
+        Lawn lawn(LAWN_SIZE_CM, LAWN_SIZE_CM);
+        lawn.setParallelCutting(threads_number, 0);
+        lawn.cutGrass(make_pair(500.0, 500.0), Config::MAX_BLADE_DIAMETER); // starts the threads
+
+        auto start = chrono::steady_clock::now();
+        for (const Section& section : sections) {
+            lawn.cutGrassSection(section.beginning_, Config::MAX_BLADE_DIAMETER, section.ending_, section.angle_);
+        }
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int sections_number = argc > 1 ? max(1, atoi(argv[1])) : DEFAULT_SECTIONS_NUMBER;
+    Config::initializeRuntimeConstants(LAWN_SIZE_CM, LAWN_SIZE_CM);
+    vector<Section> sections = createSections(sections_number);
+
+    unsigned int hardware_threads = max(1u, thread::hardware_concurrency());
+    vector<unsigned int> threads_numbers = {1, 2, 4, 8, 16};
+    threads_numbers.erase(remove_if(threads_numbers.begin(), threads_numbers.end(),
+        [hardware_threads](unsigned int threads) { return threads > hardware_threads; }), threads_numbers.end());
+    if (threads_numbers.back() != hardware_threads) {
+        threads_numbers.push_back(hardware_threads);
+    }
+
+    cout << "Cutting " << sections_number << " sections of " << SECTION_LENGTH_CM << " cm with "
+        << Config::MAX_BLADE_DIAMETER << " cm blade, field width " << Config::FIELD_WIDTH << " cm" << endl;
+    cout << setw(8) << "threads" << setw(14) << "time [ms]" << setw(14) << "cuts/s" << setw(10) << "speedup" << endl;
+
+    double serial_time_ms = 0.0;
+    for (unsigned int threads_number : threads_numbers) {
+        double time_ms = measureCuttingTimeMs(threads_number, sections);
+        if (threads_number == 1) serial_time_ms = time_ms;
+
+        cout << fixed << setprecision(2) << setw(8) << threads_number << setw(14) << time_ms
+            << setw(14) << sections_number * 1000.0 / time_ms << setw(10) << serial_time_ms / time_ms << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+    Author: Maciej Cieslik
+
+    Measures queries over points of the simulation. Points are spread randomly on a 100 x 100 m lawn,
+    then nearest point and radius queries of the PointIndex are compared with checking all points,
+    and finally all points are deleted in random order.
+    Usage: PointQueryBenchmark [points_number]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Config.h"
+#include "FileLogger.h"
+#include "Lawn.h"
+#include "Logger.h"
+#include "Mower.h"
+#include "StateSimulation.h"
+
+using namespace std;
+
+namespace {
+    constexpr unsigned int LAWN_SIZE_CM = 10000;
+    constexpr int DEFAULT_POINTS_NUMBER = 100000;
+    constexpr int QUERIES_NUMBER = 10000;
+    constexpr int LINEAR_QUERIES_NUMBER = 200;
+    constexpr double QUERY_RADIUS_CM = 200.0;
+
+    double measureTimeUs(chrono::steady_clock::time_point start, int operations_number) {
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / operations_number;
+    }
+
+    // Finds the nearest point by checking all of them, like scripts had to do with getPoints()
+    unsigned int findNearestPointLinearly(const vector<Point>& points, double x, double y) {
+        unsigned int nearest_id = 0;
+        double nearest_distance = INFINITY;
+        for (const Point& point : points) {
+            double distance = hypot(point.getX() - x, point.getY() - y);
+            if (distance < nearest_distance) {
+                nearest_distance = distance;
+                nearest_id = point.getId();
+            }
+        }
+        return nearest_id;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int points_number = argc > 1 ? max(1, atoi(argv[1])) : DEFAULT_POINTS_NUMBER;
+    Config::initializeRuntimeConstants(LAWN_SIZE_CM, LAWN_SIZE_CM);
+    Config::initializeMowerConstants(50, 50, 0, 0, 0);
+    Lawn lawn(LAWN_SIZE_CM, LAWN_SIZE_CM);
+    Mower mower(50, 50, 20, 100);
+    Logger logger;
+    FileLogger file_logger("point_query_benchmark.log");
+    StateSimulation simulation(lawn, mower, logger, file_logger);
+
+    mt19937 generator(1);
+    uniform_real_distribution<double> distribution(0.0, LAWN_SIZE_CM);
+    vector<pair<double, double>> queries;
+    for (int i = 0; i < QUERIES_NUMBER; ++i) {
+        queries.emplace_back(distribution(generator), distribution(generator));
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < points_number; ++i) {
+        simulation.simulateAddPoint(distribution(generator), distribution(generator));
+    }
+    double adding_time_us = measureTimeUs(start, points_number);
+
+    start = chrono::steady_clock::now();
+    unsigned int checksum = 0;
+    for (const pair<double, double>& query : queries) {
+        checksum += simulation.findNearestPoint(query.first, query.second)->getId();
+    }
+    double nearest_time_us = measureTimeUs(start, QUERIES_NUMBER);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < LINEAR_QUERIES_NUMBER; ++i) {
+        checksum -= findNearestPointLinearly(simulation.getPoints(), queries[i].first, queries[i].second);
+    }
+    double linear_time_us = measureTimeUs(start, LINEAR_QUERIES_NUMBER);
+
+    start = chrono::steady_clock::now();
+    size_t found_points_number = 0;
+    for (const pair<double, double>& query : queries) {
+        found_points_number += simulation.findPointsInRadius(query.first, query.second, QUERY_RADIUS_CM).size();
+    }
+    double radius_time_us = measureTimeUs(start, QUERIES_NUMBER);
+
+    vector<unsigned int> ids;
+    for (const Point& point : simulation.getPoints()) {
+        ids.push_back(point.getId());
+    }
+    shuffle(ids.begin(), ids.end(), generator);
+    start = chrono::steady_clock::now();
+    for (unsigned int id : ids) {
+        simulation.simulateDeletePoint(id);
+    }
+    double deleting_time_us = measureTimeUs(start, points_number);
+
+    cout << points_number << " points on " << LAWN_SIZE_CM / 100 << " x " << LAWN_SIZE_CM / 100 << " m lawn" << endl;
+    cout << fixed << setprecision(3);
+    cout << setw(32) << left << "add point [us]" << adding_time_us << endl;
+    cout << setw(32) << "nearest point [us]" << nearest_time_us << endl;
+    cout << setw(32) << "nearest point, all points [us]" << linear_time_us << endl;
+    cout << setw(32) << "points within 2 m [us]" << radius_time_us << " ("
+        << found_points_number / QUERIES_NUMBER << " points on average)" << endl;
+    cout << setw(32) << "delete point [us]" << deleting_time_us << endl;
+    cout << "checksum " << checksum << endl;
+    return 0;
+}
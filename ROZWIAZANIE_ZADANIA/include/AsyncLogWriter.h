@@ -0,0 +1,88 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Writes logs to the file on a background thread, so the simulation thread does not wait for the disk.
+    Logs are passed through a bounded lock-free queue, which keeps their order. Structured records
+    are formatted by the writer thread, so the simulation thread does not build messages at all. When the queue is full,
+    the overflow policy decides what happens: the producer waits until the writer makes space (BLOCK),
+    the log is dropped (DROP), or the log is dropped and the number of dropped logs is written to the file
+    (DROP_AND_REPORT). Dropped logs are always counted.
+    Logs which are still queued are written when the writer is destroyed.
+    The file is flushed when the writer has nothing to write and when flush() is called.
+    A FileLogger gives the writer functions writing to its own stream, so synchronous and asynchronous logs
+    of the same file go through one buffer. A writer created with a path opens the file itself.
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "BoundedMpscQueue.h"
+#include "Log.h"
+#include "LogRecord.h"
+
+class FileLogger;
+
+enum class LogOverflowPolicy {
+    BLOCK,
+    DROP,
+    DROP_AND_REPORT
+};
+
+class AsyncLogWriter {
+public:
+    using RecordWriter = std::function<void(const LogRecord&)>;
+    using FileFlusher = std::function<void()>;
+
+private:
+    std::unique_ptr<FileLogger> file_logger_; // only when the writer opens the file itself
+    RecordWriter write_record_;
+    FileFlusher flush_file_;
+    LogOverflowPolicy overflow_policy_;
+    BoundedMpscQueue<LogRecord> queue_;
+    std::atomic<uint64_t> pushed_count_{0};
+    std::atomic<uint64_t> written_count_{0};
+    std::atomic<uint64_t> dropped_count_{0};
+    uint64_t popped_count_ = 0; // used only by the writer thread
+    uint64_t reported_drops_count_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable entries_condition_;
+    std::condition_variable written_condition_;
+    std::atomic<bool> is_writer_waiting_{false};
+    std::atomic<bool> stopping_{false};
+    std::thread writer_thread_;
+
+    void push(LogRecord& record);
+    void wakeUpWriter();
+    void runWriter();
+    void waitForEntries();
+    void reportDrops();
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 8192;
+
+    AsyncLogWriter(const std::string& file_path, const size_t& capacity = DEFAULT_CAPACITY, 
+        const LogOverflowPolicy& overflow_policy = LogOverflowPolicy::BLOCK, 
+        const LogFileFormat& format = LogFileFormat::TEXT);
+    AsyncLogWriter(RecordWriter write_record, FileFlusher flush_file, const size_t& capacity = DEFAULT_CAPACITY,
+        const LogOverflowPolicy& overflow_policy = LogOverflowPolicy::BLOCK);
+    ~AsyncLogWriter();
+    AsyncLogWriter(const AsyncLogWriter&) = delete;
+    AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+    void pushLog(const Log& log);
+    void pushMessage(const std::string& message);
+    void pushRecord(const LogRecord& record);
+    void flush();
+
+    LogOverflowPolicy getOverflowPolicy() const;
+    size_t getCapacity() const;
+    uint64_t getWrittenCount() const;
+    uint64_t getDroppedCount() const;
+};
@@ -0,0 +1,114 @@
+/*
+    Author: Maciej Cieslik
+
+    Bounded lock-free queue for many producers and a single consumer. Producers reserve a slot
+    with one atomic operation, so threads which push never wait for each other or for the consumer.
+    Every slot has a sequence number, which tells whether the slot is free for the producer of the given
+    position or already filled for the consumer. The capacity is rounded up to a power of 2.
+    Only one thread may pop values.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class BoundedMpscQueue {
+public:
+    explicit BoundedMpscQueue(size_t capacity);
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    bool tryPush(T& value);
+    bool tryPop(T& out_value);
+    bool isEmpty() const;
+    size_t getCapacity() const;
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence_;
+        T value_;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t capacity_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> push_position_{0};
+    alignas(64) size_t pop_position_ = 0; // used only by the consumer
+
+    static size_t roundUpToPowerOfTwo(size_t value);
+};
+
+template <typename T>
+BoundedMpscQueue<T>::BoundedMpscQueue(size_t capacity)
+    : capacity_(roundUpToPowerOfTwo(capacity)), mask_(capacity_ - 1) {
+    slots_ = std::make_unique<Slot[]>(capacity_);
+    for (size_t i = 0; i < capacity_; ++i) {
+        slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+}
+
+// Moves the value into the queue. Returns false and leaves the value untouched when the queue is full.
+template <typename T>
+bool BoundedMpscQueue<T>::tryPush(T& value) {
+    size_t position = push_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+
+    while (true) {
+        slot = &slots_[position & mask_];
+        size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0) {
+            if (push_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = push_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->value_ = std::move(value);
+    slot->sequence_.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+// Values are popped in the order in which producers reserved their slots.
+template <typename T>
+bool BoundedMpscQueue<T>::tryPop(T& out_value) {
+    Slot& slot = slots_[pop_position_ & mask_];
+    if (slot.sequence_.load(std::memory_order_acquire) != pop_position_ + 1) {
+        return false;
+    }
+
+    out_value = std::move(slot.value_);
+    slot.sequence_.store(pop_position_ + capacity_, std::memory_order_release);
+    ++pop_position_;
+    return true;
+}
+
+// Should be called only by the consumer.
+template <typename T>
+bool BoundedMpscQueue<T>::isEmpty() const {
+    const Slot& slot = slots_[pop_position_ & mask_];
+    return slot.sequence_.load(std::memory_order_acquire) != pop_position_ + 1;
+}
+
+template <typename T>
+size_t BoundedMpscQueue<T>::getCapacity() const {
+    return capacity_;
+}
+
+template <typename T>
+size_t BoundedMpscQueue<T>::roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
@@ -0,0 +1,73 @@
+/*
+    Author: Hanna Biegacz
+
+    Queue of commands for MowerController, which keeps built-in commands by value in one vector.
+    Every command is stored as a std::variant of the built-in command types, so scripts pushing
+    hundreds of moves and rotations do not allocate every command separately, and executing a built-in
+    command does not need a virtual call. User-defined commands derived from ICommand are stored
+    as std::unique_ptr<ICommand>. Commands which are pushed rarely and are much bigger than moves
+    (MoveToNearestPointCommand, VisitPointsCommand) are stored the same way, so they do not make every slot bigger.
+    Finished commands are removed from the front only by moving the front index. When the buffer is emptied,
+    its memory is kept for next commands, so reserving the size of a script costs one allocation.
+*/
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+#include "commands/AddPointCommand.h"
+#include "commands/DeletePointCommand.h"
+#include "commands/MoveCommand.h"
+#include "commands/MoveToPointCommand.h"
+#include "commands/GetDistanceToPointCommand.h"
+#include "commands/RotateCommand.h"
+#include "commands/RotateTowardsPointCommand.h"
+#include "commands/MowingOptionCommand.h"
+#include "commands/GetCurrentAngleCommand.h"
+#include "commands/GetCurrentPositionCommand.h"
+#include "commands/ArcCommand.h"
+#include "commands/PolylineCommand.h"
+#include "commands/SplineCommand.h"
+
+class CommandBuffer {
+public:
+    using Command = std::variant<std::monostate, MoveCommand, RotateCommand, MowingOptionCommand,
+        AddPointCommand, DeletePointCommand, MoveToPointCommand, GetDistanceToPointCommand,
+        RotateTowardsPointCommand, GetCurrentAngleCommand, GetCurrentPositionCommand, ArcCommand, PolylineCommand,
+        SplineCommand, std::unique_ptr<ICommand>>;
+
+    CommandBuffer() = default;
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    template <typename T, typename... Args>
+    void emplace(Args&&... args);
+    void push(std::unique_ptr<ICommand> command);
+    void reserve(size_t commands_number);
+    void popFront();
+    void clear();
+    std::vector<unsigned int> takePendingPointMoves();
+
+    bool executeFront(StateSimulation& sim, double dt);
+    double getFrontMaxTimestep(const StateSimulation& sim) const;
+    bool isFrontInstantaneous() const;
+    double getFrontUnusedTime() const;
+    bool isEmpty() const;
+    size_t getSize() const;
+    size_t getCapacity() const;
+
+private:
+    std::vector<Command> commands_;
+    size_t front_index_ = 0;
+
+    void prepareForPush();
+    void compact();
+};
+
+template <typename T, typename... Args>
+void CommandBuffer::emplace(Args&&... args) {
+    prepareForPush();
+    commands_.emplace_back(std::in_place_type<T>, std::forward<Args>(args)...);
+}
@@ -25,6 +25,10 @@ namespace Constants {
     inline constexpr double DISTANCE_PRECISION = 0.001; // cm
     inline constexpr u_int64_t TICK_DURATION = 10; // ms
     inline constexpr unsigned int ROTATION_SPEED = 90; // degrees / s
+    inline constexpr double DEFAULT_TIMESTEP = 0.02; // s
+    inline constexpr double MIN_TIMESTEP = 0.001; // s
+    inline constexpr double MAX_TIMESTEP = 1.0; // s
+    inline constexpr double FINE_TIMESTEP = 0.02; // s, the longest step for rotations and homing
     
     inline constexpr double PI = 3.14159265358979;
 }
@@ -0,0 +1,59 @@
+/*
+    Author: Hanna Biegacz
+
+    Plans mowing of the whole lawn with back-and-forth stripes (boustrophedon path). Neighbouring stripes overlap
+    at least by the required part of the blade diameter, and the stripes are spread evenly between the edges
+    of the lawn. Every change of stripe takes two rotations by 90 degrees, so stripes run along the longer side
+    of the lawn, which needs fewer stripes.
+    The plan starts in a corner of the lawn. Its commands are kept as ScenarioCommands, so the same plan can be
+    given to a MowerController or written as a scenario, e.g. to compare it with custom paths in batch runs.
+    Predicted time counts moves and rotations of the plan without driving to its beginning. It does not include
+    rounding of every simulation step up to 10 ms, so the simulation takes longer (about 12% for a plan
+    of an 800x600 lawn).
+    Predicted coverage is measured by marking fields of the planned path on an empty grid of the lawn size,
+    without the fields of the lawn's obstacles.
+*/
+
+#pragma once
+#include <string>
+#include <utility>
+#include <vector>
+#include "ScenarioCommand.h"
+
+class Lawn;
+class MowerController;
+
+struct CoveragePlan {
+    std::pair<double, double> starting_point_;
+    unsigned short starting_angle_ = 0;
+    std::vector<ScenarioCommand> commands_; // executed from the starting pose
+    bool are_stripes_vertical_ = true;
+    unsigned int stripes_number_ = 0;
+    unsigned int turns_number_ = 0; // rotations by 90 degrees
+    double stripe_spacing_ = 0.0; // cm
+    double path_length_ = 0.0; // cm
+    double predicted_time_ = 0.0; // s, without rounding of simulation steps
+    double predicted_coverage_ = 0.0; // ratio of mowed fields to all fields, which can be mowed
+};
+
+class CoveragePlanner {
+public:
+    CoveragePlanner(const Lawn& lawn, unsigned int blade_diameter, double overlap);
+
+    CoveragePlan createPlan(unsigned int speed) const;
+    CoveragePlan createPlan(unsigned int speed, bool are_stripes_vertical) const;
+    static void emitPlan(const CoveragePlan& plan, MowerController& controller);
+    static void writeScenario(const CoveragePlan& plan, const std::string& path, ScenarioParameters parameters,
+        ScenarioFormat format = ScenarioFormat::BINARY);
+
+private:
+    static constexpr double SPACING_TOLERANCE = 1e-9;
+
+    const Lawn& lawn_;
+    unsigned int blade_diameter_;
+    double overlap_;
+
+    std::vector<double> calculateStripePositions(double across_length) const;
+    double calculateStripeBeginning(double along_length) const;
+    void calculatePrediction(CoveragePlan& plan, unsigned int speed) const;
+};
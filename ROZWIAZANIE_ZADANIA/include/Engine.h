@@ -2,6 +2,11 @@
     Author: Hanna Biegacz
     This class is the main coordinator of the simulation.
     It runs the simulation loop in a separate thread (fixed timestep) and manages time speed. 
+    The timestep is chosen when the engine is created: long steps give faster batch runs,
+    short steps give more accurate results. Commands which need accuracy split long steps into substeps.
+    Between steps the thread sleeps until the next step is due instead of polling,
+    and it is woken up early when the simulation is stopped, the speed changes or new commands arrive.
+    When several mowers are simulated, the snapshot provider builds snapshots with all of them.
     It also handles synchronization (mutexes) to safely connect the 
     logic update with the visualization.
 */
@@ -9,9 +14,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <thread>
+#include <vector>
+#include "Constants.h"
+#include "Log.h"
+#include "PerformanceMetrics.h"
 #include "StateInterpolator.h"
 
 class StateSimulation;
@@ -20,7 +31,8 @@ class Engine {
 public:
     Engine(StateSimulation& simulation, 
            std::function<void(StateSimulation&, double)> user_logic = nullptr,
-           std::function<void(const std::string&)> error_callback = nullptr);
+           std::function<void(const std::string&)> error_callback = nullptr,
+           double fixed_timestep = Constants::DEFAULT_TIMESTEP);
     ~Engine();
 
     Engine(const Engine&) = delete;
@@ -29,29 +41,51 @@ public:
     void start();
     void stop();
     bool isRunning() const;
+    void wakeUp();
 
     void setSimulationSpeed(double multiplier);
     double getSpeedMultiplier() const;
     double getSimulationTime() const; 
+    double getFixedTimestep() const;
     StateInterpolator& getStateInterpolator();
+    const PerformanceMetrics& getPerformanceMetrics() const;
 
     void setUserSimulationLogic(std::function<void(StateSimulation&, double)> callback);
     void setOnErrorCallback(std::function<void(const std::string&)> callback);
+    void setCommandQueueDepthProvider(std::function<size_t()> provider);
+    void setSnapshotProvider(std::function<SimulationSnapshot()> provider);
     static void defaultSimulationLogic(StateSimulation& simulation, double dt);
 
 private:
     void runSimulation();
     void updateSimulation(double dt);
     void processLogs(); 
+    void updateTickMetrics(double tick_time_ms, double cutting_time_ms);
+    void updateTicksPerSecond(std::chrono::steady_clock::time_point now);
+    bool waitForNextStep(double accumulator);
+    void stopWithError(const std::string& message);
+    bool hasNoPendingCommands();
 
     StateSimulation& simulation_;
     StateInterpolator state_interpolator_;
     std::thread simulation_thread_;
     std::mutex state_mutex_; 
     std::atomic<bool> running_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_condition_;
+    bool wake_requested_ = false;
     std::atomic<double> speed_multiplier_;
     const double fixed_timestep_; 
+    const double max_frame_time_;
 
     std::function<void(StateSimulation&, double)> user_simulation_callback_;
     std::function<void(const std::string&)> error_callback_;
+    std::function<size_t()> command_queue_depth_provider_;
+    std::function<SimulationSnapshot()> snapshot_provider_;
+
+    std::vector<Log> drained_logs_; // reused in every step, so taking logs does not allocate
+
+    PerformanceMetrics metrics_;
+    uint64_t ticks_in_measurement_ = 0;
+    std::chrono::steady_clock::time_point measurement_start_;
 };
@@ -28,3 +28,43 @@ public:
 
     const char* what() const noexcept override;
 };
+
+
+class ScenarioFormatError : public std::exception {
+private:
+    std::string msg;
+public:
+    explicit ScenarioFormatError(const std::string& message);
+
+    const char* what() const noexcept override;
+};
+
+
+class CoveragePlanError : public std::exception {
+private:
+    std::string msg;
+public:
+    explicit CoveragePlanError(const std::string& message);
+
+    const char* what() const noexcept override;
+};
+
+
+class InvalidObstacleError : public std::exception {
+private:
+    std::string msg;
+public:
+    explicit InvalidObstacleError(const std::string& message);
+
+    const char* what() const noexcept override;
+};
+
+
+class ObstacleCollisionError : public std::exception {
+private:
+    std::string msg;
+public:
+    explicit ObstacleCollisionError(const std::string& message);
+
+    const char* what() const noexcept override;
+};
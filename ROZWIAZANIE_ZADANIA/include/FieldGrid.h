@@ -0,0 +1,40 @@
+/* 
+    Author: Maciej Cieslik
+    
+    FieldGrid stores states of lawn fields as bits packed into 32-bit words. Set bit means the grass 
+    on the field is cut. Rows are stored from the bottom of the lawn and every row starts at a new word,
+    so each row is 32-bit aligned. Inside a word the first field of the row is the least significant bit.
+    This layout matches the QImage::Format_MonoLSB scanlines, so the grid can be drawn without conversion.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class FieldGrid {
+private:
+    unsigned int columns_number_ = 0;
+    unsigned int rows_number_ = 0;
+    unsigned int words_per_row_ = 0;
+    std::vector<uint32_t> words_;
+
+public:
+    static constexpr unsigned int BITS_PER_WORD = 32;
+
+    FieldGrid() = default;
+    FieldGrid(const unsigned int& columns_number, const unsigned int& rows_number);
+    bool operator==(const FieldGrid& other) const;
+    bool operator!=(const FieldGrid& other) const;
+
+    unsigned int getColumnsNumber() const;
+    unsigned int getRowsNumber() const;
+    unsigned int getWordsPerRow() const;
+    const std::vector<uint32_t>& getWords() const;
+    bool isEmpty() const;
+
+    bool isFieldCut(const unsigned int& column, const unsigned int& row) const;
+    void cutField(const unsigned int& column, const unsigned int& row);
+    void clearField(const unsigned int& column, const unsigned int& row);
+    size_t countCutFields() const;
+    std::vector<std::vector<bool>> toVectors() const;
+};
@@ -2,25 +2,54 @@
     Author: Maciej Cieslik
     
     Class, which handles saving logs to file.
+    The file is opened at the first write and stays open. Logs are collected in a big buffer,
+    which is written to the file when it is full, when the last write to the file was more than
+    FLUSH_INTERVAL_MS ago, when flush() is called and when the last copy of the logger is destroyed.
+    When asynchronous writing is enabled, logs are only queued and written by a background thread.
+    Copies of the file logger share the same file, filter and writer, so logs from all copies keep their order.
+    Asynchronous writing can be enabled on any copy, also after other copies were made, and the writer
+    writes through the same stream and buffer as synchronous writes.
+    Structured records are formatted only when they are written to a text log (on the writer thread when
+    writing is asynchronous). A binary log stores records without formatting, it can be rendered as
+    a text log with the LogFormatter tool.
 */
 
 #pragma once
 
 
+#include <memory>
 #include <string>
+#include "AsyncLogWriter.h"
 #include "Log.h"
+#include "LogFilter.h"
+#include "LogRecord.h"
 
 
 class FileLogger {
 private:
-    std::string file_path_;
+    struct LogFile;
+
+    std::shared_ptr<LogFile> log_file_; // also keeps the path, the format and the writer
+    std::shared_ptr<LogFilter> filter_;
+
 public:
-    FileLogger(const std::string& path);
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+    static constexpr long FLUSH_INTERVAL_MS = 1000;
+
+    FileLogger(const std::string& path, const LogFileFormat& format = LogFileFormat::TEXT);
     FileLogger(const FileLogger& other);
     FileLogger& operator=(const FileLogger&) = delete;
 
     const std::string& getFilePath() const;
+    LogFileFormat getFormat() const;
+    LogFilter& getFilter() const;
+    void enableAsyncWriting(const size_t& capacity = AsyncLogWriter::DEFAULT_CAPACITY, 
+        const LogOverflowPolicy& overflow_policy = LogOverflowPolicy::BLOCK);
+    bool isAsyncWritingEnabled() const;
+    AsyncLogWriter* getAsyncWriter() const;
     
     void saveLog(const Log& log) const;
     void saveMessage(const std::string& message) const;
+    void saveRecord(const LogRecord& record) const;
+    void flush() const;
 };
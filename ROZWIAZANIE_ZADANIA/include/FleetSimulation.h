@@ -0,0 +1,65 @@
+/* 
+    Author: Maciej Cieslik, Hanna Biegacz
+    
+    Simulates a fleet of mowers, which share one lawn. Every mower has its own StateSimulation and 
+    MowerController with its own command queue. In every step all mowers are stepped in parallel on 
+    a thread pool. While mowers are stepped the lawn is only read: each mower collects fields under its 
+    blade. When all mowers are finished the collected fields are cut on the calling thread, so mowers 
+    never write the lawn concurrently and the result does not depend on the order of the threads.
+    Every mower saves logs to its own file in the background, the first mower uses the given log path.
+*/
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "FileLogger.h"
+#include "Lawn.h"
+#include "Logger.h"
+#include "Mower.h"
+#include "MowerController.h"
+#include "SimulationSnapshot.h"
+#include "StateSimulation.h"
+#include "ThreadPool.h"
+
+class FleetSimulation {
+private:
+    struct FleetMower {
+        Mower mower_;
+        Logger logger_;
+        FileLogger file_logger_;
+        StateSimulation simulation_;
+        MowerController controller_;
+
+        FleetMower(Lawn& lawn, const Mower& mower_template, const std::string& log_path);
+        static FileLogger createFileLogger(const std::string& log_path);
+    };
+
+    Lawn& lawn_;
+    std::string log_path_;
+    std::vector<std::unique_ptr<FleetMower>> mowers_;
+    ThreadPool thread_pool_;
+    std::vector<Log> drained_logs_;
+
+    void cutCollectedFields();
+    void processLogs();
+
+public:
+    FleetSimulation(Lawn& lawn, const std::string& log_path, const size_t& threads_number = 0);
+    FleetSimulation(const FleetSimulation&) = delete;
+    FleetSimulation& operator=(const FleetSimulation&) = delete;
+
+    unsigned int addMower(const Mower& mower_template);
+    unsigned int getMowersNumber() const;
+    const Lawn& getLawn() const;
+    StateSimulation& getSimulation(const unsigned int& mower_index);
+    const StateSimulation& getSimulation(const unsigned int& mower_index) const;
+    MowerController& getController(const unsigned int& mower_index);
+    size_t getQueueSize() const;
+
+    void update(const double& dt);
+    SimulationSnapshot buildSimulationSnapshot() const;
+
+    static std::string createMowerLogPath(const std::string& log_path, const unsigned int& mower_index);
+};
@@ -0,0 +1,34 @@
+/*
+    Author: Hanna Biegacz
+
+    FrameStatistics keeps the durations of the most recent frames and calculates
+    frames per second and frame time percentiles from them. Percentiles show stutter,
+    which is hidden by the average: a few slow frames barely change FPS but raise the 99th percentile.
+    It is not thread-safe, it is meant to be used only by the render thread.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+class FrameStatistics {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 240;
+
+    explicit FrameStatistics(size_t capacity = DEFAULT_CAPACITY);
+
+    void addFrameTime(double frame_time_ms);
+    void clear();
+
+    size_t getSamplesCount() const;
+    double getAverageFrameTimeMs() const;
+    double getFramesPerSecond() const;
+    double getPercentileFrameTimeMs(double percentile) const;
+
+private:
+    std::vector<double> frame_times_ms_;
+    size_t capacity_;
+    size_t next_index_ = 0;
+    double frame_times_sum_ms_ = 0.0;
+};
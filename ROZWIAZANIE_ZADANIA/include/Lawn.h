@@ -2,18 +2,74 @@
     Author: Maciej Cieslik
     
     Describes Lawn, on which mower is cutting grass. Lawn consists of fields, which are repesented by 
-    bool element in 2-dimensional vector. False meaning the grass is not cut, true meaning the grass is cut. 
+    bits in FieldGrid. Unset bit meaning the grass is not cut, set bit meaning the grass is cut. 
     Left down corner point has coordinates (0.0, 0.0).
+    Fields of a cut can also be collected without changing the lawn and cut later. Collecting only reads
+    the lawn, so several mowers sharing one lawn can collect their fields in parallel.
+    Big cuts are split into bands of rows, which are cut in parallel. Rows of FieldGrid never share a word,
+    so bands do not write the same memory. Small cuts stay on the calling thread, because waking up other
+    threads would cost more than cutting.
+    Curved moves cut the area swept by the blade along an arc, so a curve is cut exactly in one cut
+    instead of many short straight sections.
+    Optionally the lawn counts how many separate passes of the blade went over each field. Counting is
+    disabled by default, so simulations which do not need it do not pay for the extra memory. A pass is
+    started explicitly by the simulation (every command and every new straight segment), cuts between two
+    passes belong to the same pass however many cut calls they take.
+    Obstacles and no-go zones are kept in an ObstacleMap. Fields which middles lie inside an obstacle are marked
+    in a separate FieldGrid once, when the obstacle is added, so masking a cut costs one bit check per field.
+    Obstacle fields are never mowed and they do not count into the mowed area.
 */
 #pragma once
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
+#include "FieldGrid.h"
+#include "ObstacleMap.h"
+#include "ThreadPool.h"
 
 class Lawn {
+public:
+    static constexpr size_t DEFAULT_MIN_PARALLEL_FIELDS = 50000;
+    static constexpr uint32_t FIRST_PASS_ID = 1;
+
 private:
+    // Rows from first_row_ (inclusive) to end_row_ (exclusive). Default band contains all rows.
+    struct RowBand {
+        unsigned int first_row_ = 0;
+        unsigned int end_row_ = UINT_MAX;
+    };
+
+    // Arc of the blade middle. Directions are unit vectors from the middle of the arc to its ends.
+    struct ArcSection {
+        std::pair<double, double> arc_middle_;
+        double radius_ = 0.0;
+        std::pair<double, double> beginning_point_;
+        std::pair<double, double> ending_point_;
+        std::pair<double, double> beginning_direction_;
+        std::pair<double, double> ending_direction_;
+        double orientation_ = -1.0; // -1 for clockwise arcs, 1 for counterclockwise arcs
+        bool is_longer_than_half_circle_ = false;
+        bool is_full_circle_ = false;
+    };
+
     unsigned int width_;
     unsigned int length_;
-    // Outer vector represents length(vertical), inner represents width(horizontal)
-    std::vector<std::vector<bool>> fields_; 
+    // Rows represent length(vertical), columns represent width(horizontal)
+    FieldGrid fields_;
+    ObstacleMap obstacle_map_;
+    FieldGrid obstacle_fields_; // set bits mark fields covered by obstacles, empty when there are no obstacles
+    size_t obstacle_fields_number_;
+    // Pass counting data, stored row by row. Empty when pass counting is disabled.
+    std::vector<uint8_t> pass_counts_;
+    std::vector<uint32_t> last_pass_ids_; // pass which cut the field last, 0 when no pass has cut it
+    uint32_t pass_id_; // pass of the fields cut now
+    uint32_t last_pass_id_; // the latest id given by beginPass
+    unsigned int cutting_threads_number_; // 0 means all hardware threads, 1 disables parallel cutting
+    size_t min_parallel_fields_;
+    std::unique_ptr<ThreadPool> cutting_pool_; // created on the first big cut
 
     bool isFieldInMowingArea(const double& x, const double& y, const std::pair<double, double>& blade_middle, 
         const double& blade_diameter) const;
@@ -23,12 +79,43 @@ private:
         const double& blade_diameter) const;
     std::pair<double, double> calculateFirstMowingFieldCoords(const std::pair<double, double>& blade_middle, 
         const double& blade_diameter) const;
-    void cutTiltedRectangle(const std::pair<double, double>& blade_middle_beginning, 
+    template <typename FieldVisitor>
+    void visitTiltedRectangleFields(const std::pair<double, double>& blade_middle_beginning, 
         const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
-        const unsigned short& angle);
-    void cutVerticalRectangle(const std::pair<double, double>& blade_middle_beginning, 
-        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending);
-    std::pair<double, double> calculateAdditionFactors(const unsigned short& angle);
+        const unsigned short& angle, const RowBand& band, FieldVisitor& visitor) const;
+    template <typename FieldVisitor>
+    void visitVerticalRectangleFields(const std::pair<double, double>& blade_middle_beginning, 
+        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending,
+        const RowBand& band, FieldVisitor& visitor) const;
+    std::pair<double, double> calculateAdditionFactors(const unsigned short& angle) const;
+    template <typename FieldVisitor>
+    void visitCircleFields(const std::pair<double, double>& blade_middle, const unsigned int& blade_diameter,
+        const RowBand& band, FieldVisitor& visitor) const;
+    template <typename FieldVisitor>
+    void visitRectangleFields(const std::pair<double, double>& blade_middle_beginning, 
+        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending,
+        const unsigned short& angle, const RowBand& band, FieldVisitor& visitor) const;
+    template <typename FieldVisitor>
+    void visitSectionFields(const std::pair<double, double>& blade_middle_beginning, 
+        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending,
+        const unsigned short& angle, const RowBand& band, FieldVisitor& visitor) const;
+    ArcSection createArcSection(const std::pair<double, double>& arc_middle, const double& radius,
+        const double& beginning_angle, const double& sweep_angle) const;
+    bool isDirectionInArc(const double& dx, const double& dy, const ArcSection& arc) const;
+    bool isPointInArcArea(const double& x, const double& y, const ArcSection& arc, const double& blade_radius) const;
+    bool isFieldInArcArea(const double& x, const double& y, const ArcSection& arc, const double& blade_radius) const;
+    std::pair<std::pair<double, double>, std::pair<double, double>> calculateArcBounds(const ArcSection& arc) const;
+    template <typename FieldVisitor>
+    void visitArcFields(const ArcSection& arc, const unsigned int& blade_diameter, const RowBand& band,
+        FieldVisitor& visitor) const;
+    void countPass(const std::pair<unsigned int, unsigned int>& indexes);
+    bool isRowInBand(const double& y, const RowBand& band) const;
+    void cutInRowBands(const std::pair<double, double>& blade_middle_beginning, const unsigned int& blade_diameter,
+        const std::pair<double, double>& blade_middle_ending, const std::function<void(const RowBand&)>& cut_band);
+    std::vector<RowBand> splitIntoRowBands(const double& down_side_y, const double& up_side_y, 
+        const size_t& bands_number) const;
+    ThreadPool* getCuttingPool();
+    void markObstacleFields(const unsigned int& obstacle_index);
 
 public:
     Lawn(const unsigned int& lawn_width, const unsigned int& lawn_length);
@@ -40,6 +127,19 @@ public:
     unsigned int getWidth() const;
     unsigned int getLength() const;
     std::vector<std::vector<bool>> getFields() const;
+    const FieldGrid& getFieldGrid() const;
+    const std::vector<uint8_t>& getPassCounts() const;
+    bool isPassCountingEnabled() const;
+    void enablePassCounting();
+    void setParallelCutting(const unsigned int& threads_number, const size_t& min_parallel_fields);
+    unsigned int getCuttingThreadsNumber() const;
+    size_t getMinParallelFields() const;
+    const ObstacleMap& getObstacleMap() const;
+    const FieldGrid& getObstacleFields() const;
+    unsigned int addCircleObstacle(const std::pair<double, double>& middle, const double& radius,
+        const ObstacleType& type);
+    unsigned int addPolygonObstacle(const std::vector<std::pair<double, double>>& vertices, const ObstacleType& type);
+    bool isObstacleField(const std::pair<unsigned int, unsigned int>& indexes) const;
 
     bool isPointInLawn(const double& x, const double& y) const;
     std::pair<unsigned int, unsigned int> calculateFieldIndexes(const double& x, const double& y) const;
@@ -50,10 +150,24 @@ public:
         const unsigned int& vector_size);
     
     double calculateShavedArea() const;
+    double calculateOverlapRatio() const;
     void cutGrass(const std::pair<double, double>& blade_middle, const unsigned int& blade_diameter);
     void cutGrassSection(const std::pair<double, double>& blade_middle_beginning, const unsigned int& blade_diameter,
         const std::pair<double, double>& blade_middle_ending, const unsigned short& angle);
     void cutRectangularGrass(const std::pair<double, double>& blade_middle_beginning, 
         const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending,
         const unsigned short& angle);
+
+    void collectGrassSection(const std::pair<double, double>& blade_middle_beginning, 
+        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
+        const unsigned short& angle, std::vector<std::pair<unsigned int, unsigned int>>& out_fields) const;
+    void cutGrassArc(const std::pair<double, double>& arc_middle, const double& radius, const double& beginning_angle,
+        const double& sweep_angle, const unsigned int& blade_diameter);
+    void collectGrassArc(const std::pair<double, double>& arc_middle, const double& radius, 
+        const double& beginning_angle, const double& sweep_angle, const unsigned int& blade_diameter,
+        std::vector<std::pair<unsigned int, unsigned int>>& out_fields) const;
+    uint32_t beginPass(const std::pair<double, double>& blade_middle, const unsigned int& blade_diameter);
+    uint32_t getPassId() const;
+    void setPassId(const uint32_t& pass_id);
+    void cutFields(const std::vector<std::pair<unsigned int, unsigned int>>& fields);
 };
@@ -3,6 +3,7 @@
     
     Each log represents error, for example: attempt of mowing outside the lawn. 
     Log constists of simulation time when it occured and message.
+    Logs can be moved, so passing them to the Logger does not copy the message.
 */
 
 #pragma once
@@ -13,12 +14,14 @@ private:
     u_int64_t time_;
     std::string message_;
 public:
-    Log(const u_int64_t& time, const std::string& message);
-    Log(const Log& other);
-    Log& operator=(const Log&);
+    Log(const u_int64_t& time, std::string message);
+    Log(const Log& other) = default;
+    Log(Log&& other) noexcept = default;
+    Log& operator=(const Log& other) = default;
+    Log& operator=(Log&& other) noexcept = default;
     bool operator==(const Log& other) const;
     bool operator!=(const Log& other) const;
 
     u_int64_t getTime() const;
-    std::string getMessage() const;
-};
\ No newline at end of file
+    const std::string& getMessage() const;
+};
@@ -0,0 +1,30 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Decides which events are saved to the logs file. An event is saved when its level is at least
+    the minimal level and its category is enabled. The filter is checked before the record is formatted
+    or queued, so filtered out events cost almost nothing. The filter can be changed while the simulation
+    is running. Messages without time (for example reports of dropped logs) are never filtered out.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "LogRecord.h"
+
+class LogFilter {
+private:
+    std::atomic<uint8_t> min_level_;
+    std::atomic<uint32_t> disabled_categories_; // bit mask indexed by LogCategory
+public:
+    LogFilter();
+    LogFilter(const LogFilter&) = delete;
+    LogFilter& operator=(const LogFilter&) = delete;
+
+    LogLevel getMinLevel() const;
+    void setMinLevel(const LogLevel& level);
+    bool isCategoryEnabled(const LogCategory& category) const;
+    void setCategoryEnabled(const LogCategory& category, const bool& enable);
+
+    bool isEnabled(const LogEventType& type) const;
+};
@@ -0,0 +1,96 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Structured log of a simulation event. Instead of a ready message, the record stores the type of the event,
+    the simulation time and numeric values of the event (for example distance and starting point of a move),
+    so creating it does not cost any formatting. The message is built only when the record is written
+    to a text log or rendered by the LogFormatter tool. Logs with custom messages are stored as text records.
+    Records can be written to and read from a compact binary log (values are stored in native byte order).
+    Every event type has a level and a category, which are used to filter logs.
+*/
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+enum class LogFileFormat {
+    TEXT,
+    BINARY
+};
+
+enum class LogLevel : uint8_t {
+    DEBUG,  // events of every step, for example moves and rotations
+    INFO,
+    ERROR
+};
+
+enum class LogCategory : uint8_t {
+    MOVEMENT,
+    ROTATION,
+    MOWING,
+    POINTS,
+    ERRORS,
+    GENERAL,    // messages and custom logs, which are not simulation events
+    CATEGORIES_NUMBER
+};
+
+enum class LogEventType : uint8_t {
+    TEXT_LOG,       // log with custom message, written with time
+    TEXT_MESSAGE,   // message written without time
+    MOVED,          // values: distance, beginning x, beginning y
+    MOVED_OUTSIDE_LAWN,
+    ROTATED,        // values: angle
+    INVALID_ROTATION_ANGLE,
+    MOWING_ON,
+    MOWING_OFF,
+    POINT_NOT_FOUND, // values: point id
+    MOVING_TO_POINT, // values: point id
+    MOVED_INTO_OBSTACLE,
+    POINT_OUTSIDE_LAWN,
+    POINT_NOT_DELETED, // values: point id
+    POINT_ARRIVED,   // values: point id
+    NO_POINTS_FOUND,
+    ROUTE_OPTIMIZED, // values: points number, time of the given order, time of the optimized route
+    EVENT_TYPES_NUMBER
+};
+
+class LogRecord {
+private:
+    LogEventType type_;
+    u_int64_t time_;
+    std::array<double, 3> values_;
+    std::string text_;
+
+    void writeMessage(std::ostream& stream) const;
+    static void writeDouble(std::ostream& stream, const double& value);
+public:
+    static constexpr char BINARY_LOG_MAGIC[] = "MOWLOG1";
+
+    LogRecord();
+    LogRecord(const LogEventType& type, const u_int64_t& time, const double& value_0 = 0.0, 
+        const double& value_1 = 0.0, const double& value_2 = 0.0);
+    LogRecord(const LogEventType& type, const u_int64_t& time, const std::string& text);
+    bool operator==(const LogRecord& other) const;
+    bool operator!=(const LogRecord& other) const;
+
+    LogEventType getType() const;
+    u_int64_t getTime() const;
+    double getValue(const unsigned int& index) const;
+    const std::string& getText() const;
+    static unsigned int getValuesNumber(const LogEventType& type);
+    static bool isTextType(const LogEventType& type);
+    static LogLevel getLevel(const LogEventType& type);
+    static LogCategory getCategory(const LogEventType& type);
+
+    std::string formatMessage() const;
+    std::string formatLine() const;
+    void writeTextLine(std::ostream& stream) const;
+
+    static void writeBinaryHeader(std::ostream& stream);
+    static bool readBinaryHeader(std::istream& stream);
+    void writeBinary(std::ostream& stream) const;
+    bool readBinary(std::istream& stream);
+};
@@ -1,25 +1,29 @@
 /* 
     Author: Maciej Cieslik
     
-    Collects logs from StateSimulation in a queue. Each log represents error, for example: attempt of mowing
-    outside the lawn. Log constists of simulation time when it occured and message.
+    Collects logs from StateSimulation in the order they occured. Each log represents error, for example:
+    attempt of mowing outside the lawn. Log constists of simulation time when it occured and message.
+    Collected logs are taken with drainInto, which swaps the logs with the given buffer. When the same buffer
+    is used in every step, both vectors keep their memory and taking logs does not allocate.
 */
 
 #pragma once
 #include <string>
-#include <queue>
+#include <vector>
 #include "Log.h"
 
 class Logger {
 private:
-    std::queue<Log> logs_;
+    std::vector<Log> logs_;
 public:
     Logger();
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
 
-    const std::queue<Log>& getLogs() const;
+    const std::vector<Log>& getLogs() const;
 
     void push(const Log& newLog);
+    void push(Log&& newLog);
+    void drainInto(std::vector<Log>& buffer);
     void clear();
 };
@@ -8,6 +8,8 @@ class MathHelper {
 public:
     static double convertDegreesToRadians(const unsigned short& angle);
     static double convertRadiansToDegrees(const double& angle);
+    static double convertFractionalDegreesToRadians(const double& angle);
+    static double normalizeAngle(const double& angle);
     static double calculateAParameter(const unsigned short& angle);
     static double calculateAPerpendicularParameter(const double& a_parameter);
     static double roundNumber(const double& value, const double& precision);
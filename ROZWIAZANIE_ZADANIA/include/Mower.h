@@ -4,10 +4,14 @@
     Describes mower. Mower has rectangular shape with blade, which middle is located in the central point of the mower.
     Blade cuts grass in circular area. The mower moves in continuous space(mower can cover the part of the field).
     Location of mower is described by coordinates(x, y) of it's middle point.
+    Moves on a lawn with obstacles are checked against its ObstacleMap, the mower stops before the move
+    which would hit an obstacle or enter a no-go zone.
 */
 
 #pragma once
+#include <utility>
 
+class Lawn;
 
 class Mower {
 private:
@@ -23,6 +27,7 @@ private:
     std::pair<double, double> calculateFinalPoint(const double& distance) const;
     bool calculateIfXAccessible(const double& calculatedX, const unsigned int& lawn_width) const;
     bool calculateIfYAccessible(const double& calculatedY, const unsigned int& lawn_length) const;
+    void checkObstacleCollision(const std::pair<double, double>& final_point, const Lawn& lawn) const;
 
 public:
     Mower(const unsigned int& width, const unsigned int& length, const unsigned int& blade_diameter,
@@ -46,6 +51,11 @@ public:
     void setY(const double& new_y);
 
     void move(const double& distance, const unsigned int& lawn_width, const unsigned int& lawn_length);
+    void moveToPose(const double& x, const double& y, const unsigned short& angle, const unsigned int& lawn_width,
+        const unsigned int& lawn_length);
+    void move(const double& distance, const Lawn& lawn);
+    void moveToPose(const double& x, const double& y, const unsigned short& angle, const Lawn& lawn);
+    bool isPointAccessible(const double& x, const double& y, const Lawn& lawn) const;
     void rotate(const short& angle);
     void turnOnMowing();
     void turnOffMowing();
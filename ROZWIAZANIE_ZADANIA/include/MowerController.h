@@ -1,26 +1,29 @@
 /*
     Author: Hanna Biegacz
     This class is responsible for handling user input and executing commands.
-    Manages a command queue for the lawn mower.
+    Manages a command queue for the lawn mower. Commands are kept in a CommandBuffer, so built-in commands
+    do not need separate allocations, and reserving commands for a long script costs one allocation.
+    Custom commands derived from ICommand can be added with addCommand.
     Provides simple methods to control the mower (move, rotate, mowing on/off)
-    and executes commands sequentially during simulation updates.
+    and to drive it along curves (arcs, polylines and splines) without splitting them into short moves.
+    Pending moves to points at the end of the queue can be reordered into a shorter route with optimizeRoute.
+    Commands are executed sequentially during simulation updates. Instantaneous commands, such as adding points,
+    do not use up a simulation step, and the time left after a finished command is used by the next one.
+    Every command which takes time begins a new pass of the blade when it starts.
+    The queue is guarded by a mutex, so commands can be pushed from another thread while the Engine
+    runs update on the simulation thread.
 */
 
 #pragma once
 
-#include <queue>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include "StateSimulation.h"
-#include "commands/AddPointCommand.h"
-#include "commands/DeletePointCommand.h"
-#include "commands/MoveCommand.h"
-#include "commands/MoveToPointCommand.h"
-#include "commands/GetDistanceToPointCommand.h"
-#include "commands/RotateCommand.h"
-#include "commands/RotateTowardsPointCommand.h"
-#include "commands/MowingOptionCommand.h"
-#include "commands/GetCurrentAngleCommand.h"
-#include "commands/GetCurrentPositionCommand.h"
+#include "CommandBuffer.h"
+#include "RouteOptimizer.h"
 
 class MowerController {
 public:
@@ -32,19 +35,47 @@ public:
     void move(double cm);
     void move(const double* distance_ptr, double scale = 1.0);
     void rotate(short deg);
+    void moveAlongArc(double radius, double angle);
+    void moveAlongPolyline(std::vector<std::pair<double, double>> points);
+    void moveAlongSpline(std::vector<std::pair<double, double>> points);
     void setMowing(bool enable);
     void addPoint(double x, double y);
     void deletePoint(unsigned int point_id);
     void moveToPoint(unsigned int point_id);
+    void moveToNearestPoint(bool delete_point_on_arrival = false);
+    void optimizeRoute(double time_budget = RouteOptimizer::DEFAULT_TIME_BUDGET);
     void getDistanceToPoint(unsigned int point_id, double& out_distance);
     void rotateTowardsPoint(unsigned int point_id);
     void getCurrentAngle(unsigned short& out_angle);
     void getCurrentPosition(double& out_x, double& out_y);
-
-
+    void addCommand(std::unique_ptr<ICommand> command);
+    void reserveCommands(size_t commands_number);
 
     void update(StateSimulation& sim, double dt);
+    size_t getQueueSize() const;
+    void setCommandAddedCallback(std::function<void()> callback);
 
 private:
-    std::queue<std::unique_ptr<ICommand>> command_queue_;
+    CommandBuffer command_queue_;
+    bool is_front_started_ = false; // a pass was begun for the command at the front
+    mutable std::mutex queue_mutex_;
+    std::function<void()> command_added_callback_;
+
+    static constexpr double SUBSTEP_TOLERANCE = 1e-9;
+    static constexpr double MIN_COMMAND_TIME = 1e-6; // s, shorter rests of a step are not passed to the next command
+
+    template <typename T, typename... Args>
+    void pushCommand(Args&&... args);
+    void notifyCommandAdded();
+    bool executeFrontCommand(StateSimulation& sim, double& time_left);
+    static int calculateSubstepsNumber(double max_timestep, double dt);
 };
+
+template <typename T, typename... Args>
+void MowerController::pushCommand(Args&&... args) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        command_queue_.emplace<T>(std::forward<Args>(args)...);
+    }
+    notifyCommandAdded();
+}
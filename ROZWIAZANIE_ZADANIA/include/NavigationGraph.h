@@ -0,0 +1,83 @@
+/*
+    Author: Hanna Biegacz
+
+    Plans collision-free paths around obstacles of the lawn. The graph is a visibility graph: its nodes are
+    placed a bit outside the corners of obstacles (8 nodes around every circle, one node at every convex vertex
+    of a polygon) and at points added to the lawn. Two nodes are connected when the mower can drive straight
+    between them without hitting an obstacle.
+    Edges are not built in advance. A* search checks only edges of nodes it visits, and results of these checks
+    are cached, so the next paths through the same part of the lawn cost only a few lookups.
+    The graph follows the obstacle map: new obstacles add their nodes, switch off nodes they cover and remove
+    cached edges going near them. Obstacles are never removed, so edges found blocked stay blocked.
+    Edges between corner nodes keep an additional margin from obstacles, which leaves room for small errors
+    of the mower following the path.
+*/
+
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class ObstacleMap;
+struct Obstacle;
+
+class NavigationGraph {
+public:
+    static constexpr double NAVIGATION_MARGIN = 10.0; // cm, distance between corner nodes and obstacles
+    static constexpr unsigned int CIRCLE_NODES_NUMBER = 8;
+
+    NavigationGraph(const ObstacleMap& obstacle_map, unsigned int lawn_width, unsigned int lawn_length,
+        double clearance);
+
+    void update();
+    void addPoint(unsigned int point_id, const std::pair<double, double>& position);
+    void removePoint(unsigned int point_id);
+    std::vector<std::pair<double, double>> findPath(const std::pair<double, double>& start,
+        const std::pair<double, double>& goal);
+    std::vector<std::pair<double, double>> findPathToPoint(const std::pair<double, double>& start,
+        unsigned int point_id);
+
+    size_t getActiveNodesNumber() const;
+    size_t getCachedEdgesNumber() const;
+
+private:
+    enum class NodeType : uint8_t {
+        CORNER,
+        POINT,
+        TEMPORARY // start or goal of a single search
+    };
+
+    struct Node {
+        std::pair<double, double> position_;
+        NodeType type_ = NodeType::CORNER;
+        bool is_active_ = true;
+        std::vector<unsigned int> cached_neighbours_; // points only, other ends of cached edges
+    };
+
+    const ObstacleMap& obstacle_map_;
+    unsigned int lawn_width_;
+    unsigned int lawn_length_;
+    double clearance_; // distance kept by the middle of the mower from physical obstacles
+    size_t known_obstacles_number_ = 0;
+    std::vector<Node> nodes_;
+    std::vector<unsigned int> corner_nodes_;
+    std::unordered_map<unsigned int, unsigned int> point_nodes_; // point id -> node index
+    std::vector<unsigned int> free_point_nodes_;
+    std::unordered_map<uint64_t, bool> visibility_cache_;
+
+    void addCornerNodes(const Obstacle& obstacle);
+    void addCircleNodes(const Obstacle& obstacle, double distance);
+    void addPolygonNodes(const Obstacle& obstacle, double distance);
+    void addCornerNode(const std::pair<double, double>& position);
+    void refreshNodesNear(const std::pair<double, double>& left_down_corner,
+        const std::pair<double, double>& right_up_corner);
+    void removeEdgesNear(const std::vector<std::pair<std::pair<double, double>, std::pair<double, double>>>& areas);
+    void removeEdgesOfNode(unsigned int node_index);
+    bool isNodeAccessible(const Node& node) const;
+    bool isVisible(unsigned int first_index, unsigned int second_index);
+    std::vector<std::pair<double, double>> searchPath(unsigned int start_index, unsigned int goal_index);
+    double calculateDistance(unsigned int first_index, unsigned int second_index) const;
+
+    static uint64_t calculateEdgeKey(unsigned int first_index, unsigned int second_index);
+};
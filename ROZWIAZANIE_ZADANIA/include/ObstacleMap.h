@@ -0,0 +1,93 @@
+/*
+    Author: Maciej Cieslik
+
+    Describes obstacles on the lawn, e.g. trees, flower beds or ponds. Obstacles are circles or polygons,
+    their coordinates are given in cm like coordinates of the lawn. Physical obstacles can not be touched
+    by the blade, so the middle of the mower has to stay at least the blade radius away from them. No-go zones
+    can not be entered by the middle of the mower, the same as borders of the lawn.
+    Obstacles are kept in a uniform grid of square buckets. Every bucket stores indexes of obstacles, which
+    bounding boxes overlap it, so a query checks only obstacles close to the queried point or segment.
+    Queries do not change the map, so mowers sharing one lawn can check collisions in parallel.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+enum class ObstacleType : uint8_t {
+    OBSTACLE,   // physical obstacle, the blade can not touch it
+    NO_GO_ZONE  // the middle of the mower can not enter it
+};
+
+
+enum class ObstacleShape : uint8_t {
+    CIRCLE,
+    POLYGON
+};
+
+
+struct Obstacle {
+    ObstacleType type_ = ObstacleType::OBSTACLE;
+    ObstacleShape shape_ = ObstacleShape::CIRCLE;
+    std::pair<double, double> middle_; // circles only
+    double radius_ = 0.0; // circles only
+    std::vector<std::pair<double, double>> vertices_; // polygons only
+    std::pair<double, double> left_down_corner_; // bounding box
+    std::pair<double, double> right_up_corner_;
+};
+
+
+class ObstacleMap {
+private:
+    unsigned int width_;
+    unsigned int length_;
+    double bucket_size_; // cm
+    unsigned int columns_number_;
+    unsigned int rows_number_;
+    std::vector<Obstacle> obstacles_;
+    std::vector<std::vector<unsigned int>> buckets_; // stored row by row, from the bottom of the lawn
+
+    unsigned int addObstacle(Obstacle& obstacle);
+    std::pair<unsigned int, unsigned int> calculateBucketIndexes(const double& x, const double& y) const;
+    template <typename ObstacleCheck>
+    bool isAnyObstacleInArea(const std::pair<double, double>& left_down_corner,
+        const std::pair<double, double>& right_up_corner, ObstacleCheck& check) const;
+    template <typename ObstacleCheck>
+    bool isAnyObstacleNearSegment(const std::pair<double, double>& beginning, const std::pair<double, double>& ending,
+        const double& range, ObstacleCheck& check) const;
+    bool isSegmentInObstacleRange(const Obstacle& obstacle, const std::pair<double, double>& beginning,
+        const std::pair<double, double>& ending, const double& clearance) const;
+    bool isSegmentCrossingPolygon(const std::vector<std::pair<double, double>>& vertices,
+        const std::pair<double, double>& beginning, const std::pair<double, double>& ending) const;
+    double calculateDistanceToPolygonEdges(const std::vector<std::pair<double, double>>& vertices,
+        const std::pair<double, double>& beginning, const std::pair<double, double>& ending) const;
+
+    static bool isPointInShape(const Obstacle& obstacle, const double& x, const double& y);
+    static bool isPointInPolygon(const std::vector<std::pair<double, double>>& vertices, const double& x,
+        const double& y);
+    static double calculateDistanceToSegment(const std::pair<double, double>& point,
+        const std::pair<double, double>& beginning, const std::pair<double, double>& ending);
+    static double calculateCrossProduct(const std::pair<double, double>& origin, const std::pair<double, double>& a,
+        const std::pair<double, double>& b);
+
+public:
+    static constexpr double MIN_BUCKET_SIZE = 50.0; // cm
+    static constexpr unsigned int MAX_BUCKETS_PER_SIDE = 256;
+
+    ObstacleMap(const unsigned int& lawn_width, const unsigned int& lawn_length);
+
+    const std::vector<Obstacle>& getObstacles() const;
+    bool isEmpty() const;
+    double getBucketSize() const;
+
+    unsigned int addCircle(const std::pair<double, double>& middle, const double& radius, const ObstacleType& type);
+    unsigned int addPolygon(const std::vector<std::pair<double, double>>& vertices, const ObstacleType& type);
+
+    bool isPointInObstacle(const unsigned int& obstacle_index, const double& x, const double& y) const;
+    bool isPointBlocked(const double& x, const double& y) const;
+    bool isSegmentBlocked(const std::pair<double, double>& beginning, const std::pair<double, double>& ending,
+        const double& blade_radius, const double& margin = 0.0) const;
+};
@@ -0,0 +1,21 @@
+/*
+    Author: Hanna Biegacz
+
+    PerformanceMetrics holds values measured by the Engine on the simulation thread,
+    which are shown by the performance HUD of the Visualizer. All values are atomics,
+    so the render thread reads them without taking any lock and never slows the simulation down.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct PerformanceMetrics {
+    std::atomic<uint64_t> simulation_ticks_{0};
+    std::atomic<double> ticks_per_second_{0.0};
+    std::atomic<double> tick_time_ms_{0.0};
+    std::atomic<double> cutting_time_per_tick_ms_{0.0};
+    std::atomic<size_t> command_queue_depth_{0};
+};
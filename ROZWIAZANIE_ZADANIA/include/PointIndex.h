@@ -0,0 +1,47 @@
+/*
+    Author: Maciej Cieslik
+
+    Spatial index of points on the lawn. Points are kept in a uniform grid of square buckets, the same as
+    obstacles in the ObstacleMap, so finding the nearest point or points within a radius checks only
+    buckets close to the queried point. Adding and deleting a point changes only its own bucket.
+    The nearest point is searched in rings of buckets around the queried point, and the search stops
+    when the next ring can not contain a closer point.
+*/
+
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "Point.h"
+
+
+class PointIndex {
+private:
+    unsigned int width_;
+    unsigned int length_;
+    double bucket_size_; // cm
+    unsigned int columns_number_;
+    unsigned int rows_number_;
+    std::vector<std::vector<Point>> buckets_; // stored row by row, from the bottom of the lawn
+    size_t points_number_;
+
+    std::pair<unsigned int, unsigned int> calculateBucketIndexes(const double& x, const double& y) const;
+    std::vector<Point>& getBucket(const double& x, const double& y);
+    void findNearestPointInBucket(const unsigned int& column, const unsigned int& row, const double& x,
+        const double& y, const Point*& nearest_point, double& nearest_distance_squared) const;
+
+public:
+    static constexpr double MIN_BUCKET_SIZE = 10.0; // cm
+    static constexpr unsigned int MAX_BUCKETS_PER_SIDE = 256;
+
+    PointIndex(const unsigned int& lawn_width, const unsigned int& lawn_length);
+
+    size_t getSize() const;
+    double getBucketSize() const;
+
+    void addPoint(const Point& point);
+    bool deletePoint(const Point& point);
+    std::optional<Point> findNearestPoint(const double& x, const double& y) const;
+    std::vector<Point> findPointsInRadius(const double& x, const double& y, const double& radius) const;
+};
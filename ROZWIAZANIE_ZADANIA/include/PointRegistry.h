@@ -0,0 +1,41 @@
+/*
+    Author: Maciej Cieslik
+
+    Stores points of the simulation by their ids. Points are kept in a vector in the order they were added,
+    which is the order used for rendering, and every id knows the index of its point in this vector,
+    so finding and deleting a point does not depend on the number of points.
+    Deleted points are only unlinked from their ids. They are removed from the vector when the points
+    are read next time, so deleting many points costs a single pass over the vector.
+    Ids are given by the simulation in increasing order and they are never used again, so an old id
+    can not find a point added later.
+*/
+
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "Point.h"
+
+
+class PointRegistry {
+private:
+    static constexpr unsigned int NO_SLOT = std::numeric_limits<unsigned int>::max();
+
+    mutable std::vector<Point> slots_; // points in the order of adding, deleted ones until the next compaction
+    mutable std::vector<unsigned int> id_slots_; // index of the slot for every id, NO_SLOT when there is no point
+    mutable size_t deleted_points_number_;
+
+    bool isSlotUsed(const size_t& slot) const;
+    void compact() const;
+
+public:
+    PointRegistry();
+
+    const std::vector<Point>& getPoints() const;
+    size_t getSize() const;
+    bool isEmpty() const;
+
+    void addPoint(const Point& point);
+    bool deletePoint(const unsigned int& id);
+    const Point* findPoint(const unsigned int& id) const;
+};
@@ -20,6 +20,7 @@ public:
 
     void update(double dt_ms);
     double getSmoothedTime() const;
+    double getRenderLagMs() const;
 
 private:
     static constexpr double BASE_BUFFER_DELAY_MS = 200.0;  
@@ -0,0 +1,149 @@
+/*
+    Author: Hanna Biegacz
+
+    RenderWorker composes frames of the visualization in a separate thread, so drawing
+    big lawns does not block input handling and window resizing on the Qt GUI thread.
+    Frames are drawn into a QImage back buffer. When a frame is finished, the back buffer
+    is swapped with the front buffer, and the GUI thread only blits the latest finished frame.
+    RenderWorker owns the RenderTimeController and the Viewport, because both are
+    used while composing the frame.
+    All mowers of a fleet are drawn, the view follows the first one.
+    When the lawn counts passes of the blade, the lawn can be drawn as a heatmap of repeated passes.
+    The performance HUD shows frame statistics of the render thread together with the metrics
+    published by the Engine, which helps to find out which thread is responsible for stutter.
+*/
+
+#pragma once
+
+#include <QImage>
+#include <QColor>
+#include <QVector>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <vector>
+#include "FrameStatistics.h"
+#include "PerformanceMetrics.h"
+#include "RenderTimeController.h"
+#include "StateInterpolator.h"
+#include "SimulationSnapshot.h"
+#include "Viewport.h"
+
+class QPainter;
+
+class RenderWorker {
+public:
+    explicit RenderWorker(StateInterpolator& state_interpolator);
+    ~RenderWorker();
+    RenderWorker(const RenderWorker&) = delete;
+    RenderWorker& operator=(const RenderWorker&) = delete;
+
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    void setFrameReadyCallback(std::function<void()> callback);
+    void setFrameInterval(int interval_ms);
+    void setTargetSize(int width_px, int height_px);
+
+    void zoomAt(double factor, double screen_x, double screen_y);
+    void pan(double dx_px, double dy_px);
+    void toggleFollowMode();
+    void resetView();
+    void toggleHeatmap();
+    bool isHeatmapVisible() const;
+    void toggleHud();
+    bool isHudVisible() const;
+    void setPerformanceMetrics(const PerformanceMetrics* metrics);
+
+    void composeFrame();
+    QImage getLatestFrame() const;
+    double getLastCompositionTimeMs() const;
+    double getAverageCompositionTimeMs() const;
+
+private:
+    static constexpr int DEFAULT_FRAME_INTERVAL_MS = 10;
+    static constexpr double COMPOSITION_TIME_SMOOTHING = 0.1;
+    static constexpr double MIN_POINT_HEIGHT = 30.0;
+    static constexpr double POINT_PROPORTION = 0.05;
+    static constexpr int HEATMAP_SATURATION_PASSES = 6;
+    static constexpr double HUD_MARGIN_PX = 8.0;
+    static constexpr double HUD_LINE_HEIGHT_PX = 16.0;
+    static constexpr double HUD_WIDTH_PX = 300.0;
+    static constexpr int HUD_FONT_SIZE = 9;
+
+    static const QColor BACKGROUND_COLOR;
+    static const QColor UNMOWED_GRASS_COLOR;
+    static const QColor MOWED_GRASS_COLOR;
+    static const QColor FIRST_OVERLAP_COLOR;
+    static const QColor MAX_OVERLAP_COLOR;
+    static const QColor OBSTACLE_COLOR;
+    static const QColor HUD_BACKGROUND_COLOR;
+    static const QColor HUD_TEXT_COLOR;
+
+    StateInterpolator& state_interpolator_;
+    RenderTimeController render_time_controller_;
+    std::vector<QImage> point_images_;
+    QImage mower_image_;
+    QVector<QRgb> lawn_palette_;
+    QVector<QRgb> obstacle_palette_;
+    QVector<QRgb> heatmap_palette_;
+    std::atomic<bool> is_heatmap_visible_{false};
+    std::atomic<bool> is_hud_visible_{false};
+    std::atomic<const PerformanceMetrics*> performance_metrics_{nullptr};
+    FrameStatistics frame_statistics_;
+
+    std::thread render_thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<int> frame_interval_ms_{DEFAULT_FRAME_INTERVAL_MS};
+    std::function<void()> frame_ready_callback_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_condition_;
+    bool wake_requested_ = false;
+
+    mutable std::mutex view_mutex_;
+    Viewport viewport_;
+    int target_width_px_ = 0;
+    int target_height_px_ = 0;
+
+    mutable std::mutex frame_mutex_;
+    QImage front_buffer_;
+    QImage back_buffer_;
+
+    std::chrono::steady_clock::time_point last_frame_time_;
+    bool has_last_frame_time_ = false;
+    std::atomic<double> last_composition_time_ms_{0.0};
+    std::atomic<double> average_composition_time_ms_{0.0};
+
+    void runRenderLoop();
+    void requestFrame();
+    void updateRenderTime();
+    Viewport prepareViewport(const SimulationSnapshot& sim_snapshot, const StaticSimulationData& static_data,
+        int& out_width_px, int& out_height_px);
+    void prepareBackBuffer(int width_px, int height_px);
+    void publishBackBuffer();
+    void recordCompositionTime(double composition_time_ms);
+
+    void loadMowerImage();
+    void loadPointImages();
+    void buildHeatmapPalette();
+    void setupPainter(QPainter& painter) const;
+    QImage wrapFieldGrid(const FieldGrid& fields, const QVector<QRgb>& palette) const;
+    QImage wrapPassCounts(const std::vector<uint8_t>& pass_counts, int num_cols, int num_rows) const;
+    void renderLawn(QPainter& painter, const SimulationSnapshot& sim_snapshot, const StaticSimulationData& static_data,
+        const Viewport& viewport) const;
+    void renderMowers(QPainter& painter, const SimulationSnapshot& sim_snapshot, const StaticSimulationData& static_data,
+        const Viewport& viewport) const;
+    void renderMower(QPainter& painter, const MowerPose& pose, double mower_w_px, double mower_h_px,
+        const Viewport& viewport) const;
+    void renderPoints(QPainter& painter, const SimulationSnapshot& sim_snapshot, const Viewport& viewport,
+        int height_px) const;
+    void renderHud(QPainter& painter) const;
+    std::vector<std::string> buildHudLines() const;
+    void calculateMowerRenderSize(const StaticSimulationData& static_data, double scale,
+        double& out_w_px, double& out_h_px) const;
+};
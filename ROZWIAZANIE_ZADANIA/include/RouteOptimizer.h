@@ -0,0 +1,55 @@
+/*
+    Author: Hanna Biegacz
+
+    Orders points to visit, so the mower drives through all of them in short time (open travelling salesman
+    path starting at the mower). Time of a route counts driving between points with the speed of the mower
+    and rotating towards the next point with Constants::ROTATION_SPEED, starting from the current angle
+    of the mower. Paths around obstacles are not planned here, so legs are counted as straight lines.
+    The route starts as nearest-neighbour order (always the point reached in the shortest time) and is improved
+    with 2-opt moves, which reverse a part of the route, until no move shortens it or the time budget is used.
+    Only moves which connect a point with one of its nearest points are checked, so a pass over the route
+    costs O(n) checks instead of O(n^2). Reversing a part of the route does not change the rotations inside it,
+    so every move is checked in constant time.
+*/
+
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "Point.h"
+
+struct OptimizedRoute {
+    std::vector<unsigned int> point_ids_;
+    double given_order_time_ = 0.0; // s, predicted time of visiting points in the given order
+    double predicted_time_ = 0.0; // s, predicted time of the optimized route
+    unsigned int improvements_number_ = 0; // 2-opt moves applied to the nearest-neighbour route
+    bool is_local_optimum_ = false; // false when the time budget ended before 2-opt moves were exhausted
+};
+
+class RouteOptimizer {
+public:
+    static constexpr double DEFAULT_TIME_BUDGET = 0.05; // s
+
+    RouteOptimizer(double speed, double time_budget = DEFAULT_TIME_BUDGET);
+
+    OptimizedRoute optimize(const std::pair<double, double>& start, unsigned short start_angle,
+        const std::vector<Point>& points) const;
+    double calculateRouteTime(const std::pair<double, double>& start, unsigned short start_angle,
+        const std::vector<Point>& points) const;
+
+private:
+    static constexpr double MIN_IMPROVEMENT = 1e-9; // s
+    static constexpr size_t NEIGHBOURS_NUMBER = 10;
+
+    double speed_;
+    double time_budget_;
+
+    std::vector<size_t> createNearestNeighbourRoute(const std::vector<std::pair<double, double>>& nodes,
+        double start_heading) const;
+    static std::vector<std::vector<size_t>> findNearestNodes(const std::vector<std::pair<double, double>>& nodes);
+    double calculateLegTime(const std::pair<double, double>& from, const std::pair<double, double>& to) const;
+    static double calculateTurnTime(const std::pair<double, double>& previous, const std::pair<double, double>& from,
+        const std::pair<double, double>& to);
+    static double calculateTurnTime(double heading, const std::pair<double, double>& from,
+        const std::pair<double, double>& to);
+};
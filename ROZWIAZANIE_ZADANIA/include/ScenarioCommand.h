@@ -0,0 +1,74 @@
+/*
+    Author: Hanna Biegacz
+
+    Scenario describes a whole run of the simulation, so paths can be changed without recompiling Main.cc.
+    It consists of parameters of the lawn and the mower, and a list of commands for the MowerController.
+    ScenarioCommand is a single command of a scenario, which can be written to and read from the compact
+    binary format of scenarios (values are stored in native byte order). Text scenarios are parsed
+    by the ScenarioReader.
+*/
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+enum class ScenarioFormat {
+    TEXT,
+    BINARY
+};
+
+struct ScenarioParameters {
+    unsigned int lawn_width_ = 0; // cm
+    unsigned int lawn_length_ = 0; // cm
+    unsigned int mower_width_ = 0; // cm
+    unsigned int mower_length_ = 0; // cm
+    unsigned int blade_diameter_ = 0; // cm
+    unsigned int speed_ = 0; // cm/s
+    double starting_x_ = 0.0;
+    double starting_y_ = 0.0;
+    unsigned short starting_angle_ = 0;
+};
+
+enum class ScenarioCommandType : uint8_t {
+    MOVE,                   // values: distance
+    ROTATE,                 // values: angle
+    MOWING_ON,
+    MOWING_OFF,
+    ADD_POINT,              // values: x, y
+    DELETE_POINT,           // values: point id
+    MOVE_TO_POINT,          // values: point id
+    ROTATE_TOWARDS_POINT,   // values: point id
+    GET_DISTANCE_TO_POINT,  // values: point id
+    GET_CURRENT_POSITION,
+    ARC,                    // values: radius, angle
+    COMMAND_TYPES_NUMBER
+};
+
+class ScenarioCommand {
+public:
+    static constexpr char BINARY_SCENARIO_MAGIC[] = "MOWSCN1";
+
+    ScenarioCommand();
+    explicit ScenarioCommand(ScenarioCommandType type, double value_0 = 0.0, double value_1 = 0.0);
+    bool operator==(const ScenarioCommand& other) const;
+    bool operator!=(const ScenarioCommand& other) const;
+
+    ScenarioCommandType getType() const;
+    double getValue(unsigned int index) const;
+    static unsigned int getValuesNumber(ScenarioCommandType type);
+    static const char* getKeyword(ScenarioCommandType type);
+
+    void writeTextLine(std::ostream& stream) const;
+    static void writeTextParameters(std::ostream& stream, const ScenarioParameters& parameters);
+
+    static void writeBinaryHeader(std::ostream& stream, const ScenarioParameters& parameters);
+    static bool readBinaryHeader(std::istream& stream, ScenarioParameters& out_parameters);
+    void writeBinary(std::ostream& stream) const;
+    bool readBinary(std::istream& stream);
+
+private:
+    ScenarioCommandType type_;
+    std::array<double, 2> values_;
+};
@@ -0,0 +1,71 @@
+/*
+    Author: Hanna Biegacz
+
+    Reads a scenario from a file and feeds its commands to the MowerController. The format is detected
+    from the beginning of the file. Commands are read in batches while the simulation runs, so scenarios
+    with millions of commands are never held in memory.
+
+    Text format: one entry per line, everything after '#' is a comment. Parameters come first:
+        lawn <width_cm> <length_cm>
+        mower <width_cm> <length_cm> <blade_diameter_cm> <speed_cm_s>
+        start <x_cm> <y_cm> <angle_deg>     (optional)
+    and they are followed by commands:
+        move <cm>, rotate <deg>, mowing on, mowing off, add_point <x> <y>, delete_point <id>,
+        move_to_point <id>, rotate_towards_point <id>, distance_to_point <id>, position,
+        arc <radius_cm> <angle_deg>
+    Invalid files throw ScenarioFormatError with the number of the wrong line.
+    Results of distance_to_point and position are saved in the log of the simulation.
+*/
+
+#pragma once
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ScenarioCommand.h"
+
+class MowerController;
+
+class ScenarioReader {
+public:
+    static constexpr size_t FEED_BATCH_SIZE = 4096;
+
+    explicit ScenarioReader(const std::string& path);
+    ScenarioReader(const ScenarioReader&) = delete;
+    ScenarioReader& operator=(const ScenarioReader&) = delete;
+
+    ScenarioFormat getFormat() const;
+    const ScenarioParameters& getParameters() const;
+    bool isFinished() const;
+    unsigned long getReadCommandsNumber() const;
+
+    bool readCommand(ScenarioCommand& out_command);
+    size_t feed(MowerController& controller, size_t max_commands);
+    size_t feedController(MowerController& controller);
+
+private:
+    static constexpr size_t READ_BUFFER_SIZE = 1 << 16;
+
+    std::vector<char> read_buffer_;
+    std::ifstream stream_;
+    std::string path_;
+    ScenarioFormat format_;
+    ScenarioParameters parameters_;
+    std::string line_;
+    unsigned long line_number_ = 0;
+    unsigned long read_commands_number_ = 0;
+    bool is_finished_ = false;
+    bool has_pending_command_ = false;
+    ScenarioCommand pending_command_;
+    double distance_result_ = 0.0; // queried values are written here by the controller
+    double x_result_ = 0.0;
+    double y_result_ = 0.0;
+
+    void readTextParameters();
+    bool readTextLine();
+    bool parseTextParameter(const char* keyword, size_t keyword_length, const char* cursor);
+    ScenarioCommand parseTextCommand(const char* keyword, size_t keyword_length, const char* cursor) const;
+    bool readTextCommand(ScenarioCommand& out_command);
+    bool readBinaryCommand(ScenarioCommand& out_command);
+    void pushCommand(MowerController& controller, const ScenarioCommand& command);
+    [[noreturn]] void throwLineError(const std::string& message) const;
+};
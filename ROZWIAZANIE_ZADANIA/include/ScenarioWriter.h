@@ -0,0 +1,35 @@
+/*
+    Author: Hanna Biegacz
+
+    Writes scenarios for the ScenarioReader, e.g. from programs generating paths of the mower.
+    Commands are written through a large buffer, so writing millions of commands is cheap,
+    and the binary format takes only a few bytes per command.
+*/
+
+#pragma once
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ScenarioCommand.h"
+
+class ScenarioWriter {
+public:
+    ScenarioWriter(const std::string& path, const ScenarioParameters& parameters,
+        ScenarioFormat format = ScenarioFormat::BINARY);
+    ScenarioWriter(const ScenarioWriter&) = delete;
+    ScenarioWriter& operator=(const ScenarioWriter&) = delete;
+
+    ScenarioFormat getFormat() const;
+    unsigned long getWrittenCommandsNumber() const;
+    void write(const ScenarioCommand& command);
+    void close();
+
+private:
+    static constexpr size_t WRITE_BUFFER_SIZE = 1 << 16;
+
+    std::vector<char> write_buffer_;
+    std::ofstream stream_;
+    std::string path_;
+    ScenarioFormat format_;
+    unsigned long written_commands_number_ = 0;
+};
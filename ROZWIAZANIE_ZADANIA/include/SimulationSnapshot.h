@@ -5,18 +5,30 @@
     Used by StateInterpolator to perform smooth rendering without 
     repeatedly locking and accessing the main StateSimulation object.
     Contains mower position, lawn state, and points at a specific time.
+    When a fleet of mowers shares the lawn, x_, y_ and angle_ describe the first mower
+    and poses of the other mowers are stored in other_mowers_.
 */
 
 #pragma once
+#include <cstdint>
 #include <vector>
+#include "FieldGrid.h"
 #include "Point.h"
 
+struct MowerPose {
+    double x_ = 0;
+    double y_ = 0;
+    double angle_ = 0;
+};
+
 struct SimulationSnapshot { 
     double x_ = 0;
     double y_ = 0;
     double angle_ = 0;
     double simulation_time_ = 0;
 
-    std::vector<std::vector<bool>> fields_;
+    FieldGrid fields_;
+    std::vector<uint8_t> pass_counts_; // empty when the lawn does not count passes
     std::vector<Point> points_;
+    std::vector<MowerPose> other_mowers_; // empty when only one mower is simulated
 };
@@ -21,6 +21,7 @@ struct StaticSimulationData {
     double width_cm_ = 0.0;
     double length_cm = 0.0;
     double blade_diameter_cm = 0.0;
+    FieldGrid obstacle_fields_; // empty when the lawn has no obstacles
 };
 
 class StateInterpolator {
@@ -35,6 +36,8 @@ public:
     double getSimulationTime() const;
     double getSpeedMultiplier() const;
     const StaticSimulationData& getStaticSimulationData() const;
+    size_t getBufferedSnapshotsCount() const;
+    static size_t getBufferCapacity();
 
     void setSimulationSpeedMultiplier(double speed_multiplier);
     void setStaticSimulationData(const StaticSimulationData& data);
@@ -4,15 +4,33 @@
     Handles simulation state. StateSimulation is responsible for changing state of the world 
     by manipulating the mower and the lawn. Calculates simulation time and creates lightweight 
     snapshots for the interpolator (to minimize locking time and build a history buffer for smooth animation).
+    In the fast-forward mode straight movements are simulated as single segments, which is much
+    cheaper for headless runs. Intermediate poses of such segment are sent to the snapshot callback.
+    Curved moves place the mower on points calculated along the curve, only the saved angle of the mower
+    is rounded to whole degrees, so curves do not drift.
+    Moves which would hit an obstacle are logged and stopped with ObstacleCollisionError, curved moves are
+    checked as short chords.
+    Movement to a point follows a path planned around obstacles by the NavigationGraph. The graph lives as long
+    as the simulation, so it is reused by all moves and it follows points added to and deleted from the lawn.
+    Points are kept in a PointRegistry, so they are found and deleted by id without scanning all points,
+    and in a PointIndex, which finds points close to given coordinates.
+    When several mowers share one lawn, cutting is deferred: fields under the blade are only collected,
+    and they are cut later by the owner of the lawn, so mowers can be simulated in parallel.
+    Every rotation, every straight part heading in a new direction and every command started by the controller
+    begins a new pass of the blade, so the lawn counts a stripe mowed again on the way back as a repeated pass.
 
 */
 
 #pragma once
+#include <functional>
 #include <optional>
 #include "Point.h"
+#include "PointIndex.h"
+#include "PointRegistry.h"
 #include "Lawn.h"
 #include "Logger.h"
 #include "Mower.h"
+#include "NavigationGraph.h"
 #include "FileLogger.h"
 #include "StateInterpolator.h"
 
@@ -22,18 +40,40 @@ private:
     Mower& mower_;
     Logger& logger_;
     u_int64_t time_;
-    std::vector<Point> points_;
+    PointRegistry points_;
+    PointIndex point_index_;
     unsigned int next_point_id_;
     FileLogger file_logger_;
+    double cutting_time_ms_; // real time spent on cutting the lawn, measured for the performance HUD
+    bool is_fast_forward_;
+    std::function<void(const SimulationSnapshot&)> snapshot_callback_;
+    bool is_cutting_deferred_;
+    std::vector<std::pair<unsigned int, unsigned int>> pending_fields_; // collected when cutting is deferred
+    NavigationGraph navigation_graph_;
+    uint32_t pass_id_; // pass of the blade on the lawn
+    std::optional<std::pair<double, double>> pending_pass_beginning_; // pass begun while cutting is deferred
 
     double countDistanceToBorder(const double& distance) const;
     std::pair<double, double> countBorderPoint() const;
     void calculateMovementTime(const double& distance);  
     void calculateRotationTime(const short& angle);
     void moveToPointAttempt(const double& x, const double& y);
+    std::vector<std::pair<double, double>> planPath(const unsigned int& id, const std::pair<double, double>& target);
     std::pair<short, double> calculateAngleAndDistance(const double& x, const double& y) const;
     double calculateRotationNoDx(const double& dy) const;
     double calculateRotationDx(const double& dy, const double& dx) const;
+    void placeMower(const double& x, const double& y, const unsigned short& angle);
+    void cutSection(const std::pair<double, double>& beginning_point, const std::pair<double, double>& ending_point,
+        const unsigned short& angle);
+    void checkArcInLawn(const std::pair<double, double>& arc_middle, const double& radius,
+        const double& beginning_angle, const double& sweep_angle);
+    void checkArcCollision(const std::pair<double, double>& arc_middle, const double& radius,
+        const double& beginning_angle, const double& sweep_angle);
+    void logMoveOutsideLawn();
+    void logMoveIntoObstacle();
+    static unsigned short roundAngle(const double& angle);
+    void emitIntermediateSnapshots(const double& beginning_x, const double& beginning_y, 
+        const u_int64_t& beginning_time) const;
 
 public:
     StateSimulation(Lawn& lawn, Mower& mower, Logger& logger, FileLogger& file_logger);
@@ -51,12 +91,30 @@ public:
     const unsigned int& getNextPointId() const;
     StaticSimulationData getStaticData() const;
     const FileLogger& getFileLogger() const;
+    const double& getCuttingTimeMs() const;
     void logArrivalAtPoint(unsigned int pointId);
     SimulationSnapshot buildSimulationSnapshot() const;
     std::optional<std::pair<double, double>> getPointCoordinates(unsigned int pointId);
+    std::vector<std::pair<double, double>> planPathToPoint(unsigned int pointId);
+    std::optional<Point> findNearestPoint(double x, double y) const;
+    std::vector<Point> findPointsInRadius(double x, double y, double radius) const;
     std::pair<short, double> calculateNavigationVector(double targetX, double targetY) const; 
+    bool isFastForward() const;
+    void setFastForward(const bool& enable);
+    void setSnapshotCallback(std::function<void(const SimulationSnapshot&)> callback);
+    bool isCuttingDeferred() const;
+    void setCuttingDeferred(const bool& enable);
+    const std::vector<std::pair<unsigned int, unsigned int>>& getPendingFields() const;
+    void clearPendingFields();
+    void cutPendingFields();
+    uint32_t getPassId() const;
+    void beginPass();
 
     void simulateMovement(const double& distance);
+    void simulateSegment(const double& distance);
+    void simulateLineMovement(const double& x, const double& y);
+    void simulateArcMovement(const std::pair<double, double>& arc_middle, const double& radius,
+        const double& beginning_angle, const double& sweep_angle);
     void simulateRotation(const short& angle);
     void simulateMowingOptionOn();
     void simulateMowingOptionOff();
@@ -0,0 +1,42 @@
+/*
+    Author: Hanna Biegacz
+
+    ThreadPool keeps a fixed number of worker threads, which execute submitted tasks.
+    Creating threads for every simulation step would cost more than stepping a mower,
+    so the threads are created once and wait for tasks on a condition variable.
+    Exceptions thrown by a task are passed to the thread which waits for the task.
+    runForEach splits work dynamically: idle threads take the next unfinished task,
+    and the calling thread helps instead of only waiting.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threads_number = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::future<void> submit(std::function<void()> task);
+    void runForEach(size_t tasks_number, const std::function<void(size_t)>& task);
+    size_t getThreadsNumber() const;
+
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::packaged_task<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable task_condition_;
+    bool stopping_ = false;
+
+    void runWorker();
+};
@@ -0,0 +1,80 @@
+/*
+    Author: Hanna Biegacz
+
+    Viewport describes which part of the lawn is currently visible in the window.
+    It supports three modes: fitting the whole lawn, free zoom/pan controlled by the user
+    and following the mower. It converts simulation coordinates (cm, Y up) to screen
+    coordinates (px, Y down) and tells the Visualizer which cells and points are visible,
+    so the cost of drawing a frame depends only on the visible part of the lawn.
+*/
+
+#pragma once
+
+#include <utility>
+
+struct VisibleArea {
+    double min_x_ = 0.0;
+    double max_x_ = 0.0;
+    double min_y_ = 0.0;
+    double max_y_ = 0.0;
+};
+
+struct CellRange {
+    int first_col_ = 0;
+    int end_col_ = 0;
+    int first_row_ = 0;
+    int end_row_ = 0;
+
+    int getColumnsCount() const { return end_col_ - first_col_; }
+    int getRowsCount() const { return end_row_ - first_row_; }
+    bool isEmpty() const { return getColumnsCount() <= 0 || getRowsCount() <= 0; }
+};
+
+class Viewport {
+public:
+    enum class Mode {
+        FIT_LAWN,
+        FREE,
+        FOLLOW_MOWER
+    };
+
+    static constexpr double MIN_ZOOM = 1.0;
+    static constexpr double MAX_ZOOM = 200.0;
+
+    Viewport() = default;
+
+    void setLawnSize(double lawn_width_cm, double lawn_length_cm);
+    void setScreenSize(double screen_width_px, double screen_height_px);
+
+    void zoomAt(double factor, double screen_x, double screen_y);
+    void pan(double dx_px, double dy_px);
+    void followTarget(double x_cm, double y_cm);
+    void setMode(Mode mode);
+    void reset();
+
+    Mode getMode() const;
+    double getZoom() const;
+    double getScale() const;
+    std::pair<double, double> getCenter() const;
+
+    std::pair<double, double> mapToScreen(double x_cm, double y_cm) const;
+    std::pair<double, double> mapToWorld(double screen_x, double screen_y) const;
+    VisibleArea getVisibleArea() const;
+    CellRange calculateVisibleCells(int num_cols, int num_rows) const;
+    bool isPointVisible(double x_cm, double y_cm, double margin_px) const;
+
+private:
+    Mode mode_ = Mode::FIT_LAWN;
+    double lawn_width_cm_ = 0.0;
+    double lawn_length_cm_ = 0.0;
+    double screen_width_px_ = 0.0;
+    double screen_height_px_ = 0.0;
+    double zoom_ = MIN_ZOOM;
+    double center_x_cm_ = 0.0;
+    double center_y_cm_ = 0.0;
+
+    bool hasValidDimensions() const;
+    double calculateFitScale() const;
+    void centerOnLawn();
+    void clampCenterToLawn();
+};
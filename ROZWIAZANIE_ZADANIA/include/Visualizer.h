@@ -2,21 +2,17 @@
     Author: Hanna Biegacz
     
     This class handles the visualization layer using Qt.
-    It draws the lawn, the mower, and the points based on the current simulation state.
-    It connects the data from StateInterpolator with the timing from RenderTimeController.
-    It also calculates scaling to fit the simulation world inside the application window.
+    Frames with the lawn, the mower and the points are composed by RenderWorker in a separate thread,
+    the Visualizer only shows the latest finished frame and passes user input to the worker.
+    The user can zoom (mouse wheel, +/-), pan (dragging), follow the mower (F), reset the view (0),
+    show the heatmap of repeated passes (H) and the performance HUD (P).
 */
 
 #pragma once
 
 #include <QWidget>
-#include <QTimer>
-#include <QElapsedTimer>
-#include <QPixmap>
-#include <vector>
-#include "RenderTimeController.h"
+#include "RenderWorker.h"
 #include "StateInterpolator.h"
-#include "SimulationSnapshot.h"
 
 class Visualizer : public QWidget {
     Q_OBJECT
@@ -30,42 +26,29 @@ public:
     QSize sizeHint() const override;
     QSize minimumSizeHint() const override;
 
+    void setFrameInterval(int interval_ms);
+    double getFrameCompositionTimeMs() const;
+    void setPerformanceMetrics(const PerformanceMetrics* metrics);
+
 protected:
     void paintEvent(QPaintEvent* event) override;
     void resizeEvent(QResizeEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
 
 private:
     static const int DEFAULT_WINDOW_WIDTH = 800;
     static const int DEFAULT_WINDOW_HEIGHT = 600;
     static const int MIN_WINDOW_WIDTH = 400;
     static const int MIN_WINDOW_HEIGHT = 300;
-    
-    static const QColor UNMOWED_GRASS_COLOR;
-    static const QColor MOWED_GRASS_COLOR;
-
-    StateInterpolator& state_interpolator_;
-    SimulationSnapshot current_sim_snapshot_;
-    RenderTimeController render_time_controller_;
-    StaticSimulationData static_simulation_data_;
-    std::vector<QPixmap> point_pixmaps_;
-    QPixmap mower_image_;
-    QPointF map_offset_;
-    QElapsedTimer frame_timer_;
-    double scale_factor_ = 1.0;
-    double lawn_length_cm_ = 0.0;
-
-    void updateRenderTime();
-    void refreshStateAndLayout();
-    void setupPainter(QPainter& painter);
-    void updateLayout();
-    void loadMowerImage();
-    void loadPointImages();
-    void renderLawn(QPainter& painter) const;
-    void renderMower(QPainter& painter, const SimulationSnapshot& sim_snapshot) const;
-    void renderPoints(QPainter& painter) const;
-    QPointF mapToScreen(double x_cm, double y_cm) const;
+    static constexpr double ZOOM_STEP = 1.25;
+    static constexpr double WHEEL_STEP_DEGREES = 120.0;
 
-    bool hasValidLawnDimensions() const;
-    bool isLawnDataEmpty() const;
-    void calculateMowerRenderSize(double mower_width, double mower_length, double blade_diameter, double& out_w_px, double& out_h_px) const;
-};
\ No newline at end of file
+    RenderWorker render_worker_;
+    QPoint last_drag_position_;
+    bool is_dragging_ = false;
+};
@@ -10,13 +10,15 @@
 #pragma once
 #include "ICommand.h"
 
-class AddPointCommand : public ICommand {
+class AddPointCommand final : public ICommand {
 public:
     AddPointCommand(double x, double y);
     bool execute(StateSimulation& sim, double dt) override;
+    bool isInstantaneous() const override;
 
     AddPointCommand(const AddPointCommand&) = delete;
     AddPointCommand& operator=(const AddPointCommand&) = delete;
+    AddPointCommand(AddPointCommand&&) = default;
 private:
     double x_;
     double y_;
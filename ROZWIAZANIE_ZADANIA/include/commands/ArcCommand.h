@@ -0,0 +1,39 @@
+/*
+    Author: Hanna Biegacz
+
+    Command to move the mower along an arc of a given radius (cm) by a given angle (degrees).
+    Implements ICommand interface.
+    The arc starts at the current pose of the mower and is tangent to its direction. Positive angles turn
+    right (clockwise), negative angles turn left. In every frame the mower moves along the arc, and the area
+    swept by the blade is cut as one arc, so a circle does not need hundreds of short moves and rotations.
+*/
+
+#pragma once
+#include <utility>
+#include "ICommand.h"
+
+class ArcCommand final : public ICommand {
+public:
+    ArcCommand(double radius, double angle);
+    bool execute(StateSimulation& sim, double dt) override;
+    double getUnusedTime() const override;
+
+    ArcCommand(const ArcCommand&) = delete;
+    ArcCommand& operator=(const ArcCommand&) = delete;
+    ArcCommand(ArcCommand&&) = default;
+
+private:
+    static constexpr double ANGLE_PRECISION = 1e-6; // degrees
+    static constexpr double MAX_FAST_FORWARD_SWEEP = 90.0; // degrees of one cut in the fast-forward mode
+
+    double radius_;
+    double angle_left_;
+    std::pair<double, double> arc_middle_;
+    double current_angle_ = 0.0; // position of the mower seen from the middle of the arc
+    bool initialized_ = false;
+    double unused_time_ = 0.0;
+
+    void initializeArc(const StateSimulation& sim);
+    double calculateSweepForFrame(const StateSimulation& sim, double dt) const;
+    void moveAlongArc(StateSimulation& sim, double sweep);
+};
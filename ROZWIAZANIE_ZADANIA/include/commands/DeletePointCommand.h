@@ -1,13 +1,15 @@
 #pragma once
 #include "ICommand.h"
 
-class DeletePointCommand : public ICommand {
+class DeletePointCommand final : public ICommand {
 public:
     explicit DeletePointCommand(unsigned int id);
     bool execute(StateSimulation& sim, double dt) override;
+    bool isInstantaneous() const override;
 
     DeletePointCommand(const DeletePointCommand&) = delete;
     DeletePointCommand& operator=(const DeletePointCommand&) = delete;
+    DeletePointCommand(DeletePointCommand&&) = default;
 private:
     unsigned int id_;
 };
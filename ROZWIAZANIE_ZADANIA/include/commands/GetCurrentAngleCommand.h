@@ -9,11 +9,14 @@
 #pragma once
 #include "ICommand.h"
 
-class GetCurrentAngleCommand : public ICommand {
+class GetCurrentAngleCommand final : public ICommand {
 private:
     unsigned short& output_angle_;
 
 public:
     GetCurrentAngleCommand(unsigned short& output_angle);
     bool execute(StateSimulation& sim, double dt) override;
+    bool isInstantaneous() const override;
+
+    GetCurrentAngleCommand(GetCurrentAngleCommand&&) = default;
 };
@@ -8,13 +8,15 @@
 #pragma once
 #include "ICommand.h"
 
-class GetCurrentPositionCommand : public ICommand {
+class GetCurrentPositionCommand final : public ICommand {
 public:
     GetCurrentPositionCommand(double& outX, double& outY);
     bool execute(StateSimulation& sim, double dt) override;
+    bool isInstantaneous() const override;
 
     GetCurrentPositionCommand(const GetCurrentPositionCommand&) = delete;
     GetCurrentPositionCommand& operator=(const GetCurrentPositionCommand&) = delete;
+    GetCurrentPositionCommand(GetCurrentPositionCommand&&) = default;
 
 private:
     double& out_x_;
@@ -10,13 +10,15 @@
 #include "ICommand.h"
 #include <string>
 
-class GetDistanceToPointCommand : public ICommand {
+class GetDistanceToPointCommand final : public ICommand {
 public:
     GetDistanceToPointCommand(unsigned int pointId, double& outDistance);
     bool execute(StateSimulation& sim, double dt) override;
+    bool isInstantaneous() const override;
 
     GetDistanceToPointCommand(const GetDistanceToPointCommand&) = delete;
     GetDistanceToPointCommand& operator=(const GetDistanceToPointCommand&) = delete;
+    GetDistanceToPointCommand(GetDistanceToPointCommand&&) = default;
 private:
     unsigned int point_id_;
     double& out_distance_;
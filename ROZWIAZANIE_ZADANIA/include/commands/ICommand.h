@@ -5,9 +5,17 @@
     ICommand is an abstract base class for all commands.
     It defines the execute method that is called to execute the command.
     ICommand is used to execute commands in the simulation.
+    Commands which need accuracy (e.g. rotations) limit the length of a single step,
+    so long simulation steps are split into shorter substeps.
+    Built-in commands are final and movable, so the CommandBuffer stores them by value.
+    User-defined commands can still derive from ICommand, they are stored by pointer.
+    Instantaneous commands (e.g. adding a point) take no simulated time, so several of them
+    are executed in one step. A command which finishes before the end of its step reports
+    the unused part of the step, which is then passed to the next command.
 */
 
 #pragma once
+#include <limits>
 #include "StateSimulation.h"
 
 
@@ -16,6 +24,16 @@ public:
     ICommand() {} 
     virtual ~ICommand() = default;
     virtual bool execute(StateSimulation& sim, double dt) = 0;
+    virtual double getMaxTimestep(const StateSimulation& /*sim*/) const {
+        return std::numeric_limits<double>::infinity();
+    }
+    virtual bool isInstantaneous() const {
+        return false;
+    }
+    virtual double getUnusedTime() const {
+        return 0.0;
+    }
     ICommand(const ICommand&) = delete;
     ICommand& operator=(const ICommand&) = delete;
+    ICommand(ICommand&&) = default;
 };
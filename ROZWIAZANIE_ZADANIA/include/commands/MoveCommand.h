@@ -10,18 +10,21 @@
 #pragma once
 #include "ICommand.h"
 
-class MoveCommand : public ICommand {
+class MoveCommand final : public ICommand {
 public:
     explicit MoveCommand(double distance);
     MoveCommand(const double* distance_ptr, double scale);
     bool execute(StateSimulation& sim, double dt) override;
+    double getUnusedTime() const override;
 
     MoveCommand(const MoveCommand&) = delete;
     MoveCommand& operator=(const MoveCommand&) = delete;
+    MoveCommand(MoveCommand&&) = default;
 
 private:
     double distance_left_;
     const double* deferred_distance_ = nullptr;
     double scale_ = 1.0;
     bool initialized_ = false;
+    double unused_time_ = 0.0;
 };
@@ -0,0 +1,33 @@
+/*
+    Author: Hanna Biegacz
+
+    Command to navigate the mower to the point closest to it.
+    Implements ICommand interface.
+    The nearest point is chosen when the command starts, then the mower drives to it
+    the same way as with MoveToPointCommand. The point can be deleted on arrival,
+    so repeating the command visits all points, always going to the nearest unvisited one.
+*/
+
+#pragma once
+#include <optional>
+#include "ICommand.h"
+#include "MoveToPointCommand.h"
+
+class MoveToNearestPointCommand final : public ICommand {
+public:
+    explicit MoveToNearestPointCommand(bool deletePointOnArrival = false);
+    bool execute(StateSimulation& sim, double dt) override;
+    double getMaxTimestep(const StateSimulation& sim) const override;
+    double getUnusedTime() const override;
+
+    MoveToNearestPointCommand(const MoveToNearestPointCommand&) = delete;
+    MoveToNearestPointCommand& operator=(const MoveToNearestPointCommand&) = delete;
+    MoveToNearestPointCommand(MoveToNearestPointCommand&&) = default;
+private:
+    bool delete_point_on_arrival_;
+    unsigned int point_id_ = 0;
+    std::optional<MoveToPointCommand> move_command_;
+    double unused_time_ = 0.0;
+
+    bool initializeTarget(StateSimulation& sim);
+};
@@ -5,27 +5,44 @@
     Implements ICommand interface.
     Executes over multiple frames: first rotates the mower to face the target,
     then moves forward until arrival.
+    On lawns with obstacles the path around them is planned once, when the command starts,
+    and the mower drives to its waypoints one by one.
 */
 
 #pragma once
+#include <utility>
+#include <vector>
 #include "ICommand.h"
 
-class MoveToPointCommand : public ICommand {
+class MoveToPointCommand final : public ICommand {
 public:
     explicit MoveToPointCommand(unsigned int pointId);
     bool execute(StateSimulation& sim, double dt) override;
+    double getMaxTimestep(const StateSimulation& sim) const override;
+    double getUnusedTime() const override;
+    unsigned int getPointId() const;
+    bool isStarted() const;
 
     MoveToPointCommand(const MoveToPointCommand&) = delete;
     MoveToPointCommand& operator=(const MoveToPointCommand&) = delete;
+    MoveToPointCommand(MoveToPointCommand&&) = default;
 private:
+    static constexpr double CLOSE_RANGE_THRESHOLD = 20.0;
+    static constexpr double ARRIVAL_THRESHOLD = 3.0;
+    static constexpr double MAX_STEP_NEAR_OBSTACLES = 100.0; // cm
+
     unsigned int point_id_;
         
     bool initialized_ = false;
+    std::vector<std::pair<double, double>> waypoints_;
+    size_t waypoint_index_ = 0;
     double target_x_ = 0.0;
     double target_y_ = 0.0;
     double rotation_accumulator_ = 0.0;
+    double unused_time_ = 0.0;
 
     bool initializeTarget(StateSimulation& sim);
+    void skipReachedWaypoints(const StateSimulation& sim);
     void applyAccumulatedRotation(StateSimulation& sim);
     void executeRotationLogic(StateSimulation& sim, double dt, short rotationNeeded);
     void executeMovementLogic(StateSimulation& sim, double dt, double distanceToTarget);
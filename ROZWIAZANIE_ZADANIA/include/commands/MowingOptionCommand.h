@@ -8,13 +8,15 @@
 #pragma once
 #include "ICommand.h"
 
-class MowingOptionCommand : public ICommand {
+class MowingOptionCommand final : public ICommand {
 public:
     explicit MowingOptionCommand(bool enable);
     bool execute(StateSimulation& sim, double dt) override;
+    bool isInstantaneous() const override;
 
     MowingOptionCommand(const MowingOptionCommand&) = delete;
     MowingOptionCommand& operator=(const MowingOptionCommand&) = delete;
+    MowingOptionCommand(MowingOptionCommand&&) = default;
 private:
     bool enable_;
 };
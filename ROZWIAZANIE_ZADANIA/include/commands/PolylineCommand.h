@@ -0,0 +1,32 @@
+/*
+    Author: Hanna Biegacz
+
+    Command to move the mower along a polyline, from its current position through the given points (cm).
+    Implements ICommand interface.
+    In every frame the mower covers the distance of the frame along the polyline, passing as many points
+    as needed, and it turns at the points without stopping. Every straight part is cut as one section.
+*/
+
+#pragma once
+#include <utility>
+#include <vector>
+#include "ICommand.h"
+
+class PolylineCommand final : public ICommand {
+public:
+    explicit PolylineCommand(std::vector<std::pair<double, double>> points);
+    bool execute(StateSimulation& sim, double dt) override;
+    double getUnusedTime() const override;
+
+    PolylineCommand(const PolylineCommand&) = delete;
+    PolylineCommand& operator=(const PolylineCommand&) = delete;
+    PolylineCommand(PolylineCommand&&) = default;
+
+private:
+    std::vector<std::pair<double, double>> points_;
+    size_t next_point_index_ = 0;
+    double unused_time_ = 0.0;
+
+    bool isPathFinished() const;
+    double moveAlongPath(StateSimulation& sim, double distance);
+};
@@ -9,16 +9,20 @@
 #pragma once
 #include "ICommand.h"
 
-class RotateCommand : public ICommand {
+class RotateCommand final : public ICommand {
 public:
     explicit RotateCommand(short angle);
     bool execute(StateSimulation& sim, double dt) override;
+    double getMaxTimestep(const StateSimulation& sim) const override;
+    double getUnusedTime() const override;
 
     RotateCommand(const RotateCommand&) = delete;
     RotateCommand& operator=(const RotateCommand&) = delete;
+    RotateCommand(RotateCommand&&) = default;
 private:
-    short angle_left_;
+    double angle_left_; // rotation not added to the accumulator yet
     double rotation_accumulator_ = 0.0;
+    double unused_time_ = 0.0;
 
     double calculateRotationStepForFrame(double dt) const;
     void updateInternalRotationState(double step);
@@ -9,22 +9,26 @@
 #pragma once
 #include "ICommand.h"
 
-class RotateTowardsPointCommand : public ICommand {
+class RotateTowardsPointCommand final : public ICommand {
 public:
     explicit RotateTowardsPointCommand(unsigned int pointId);
     bool execute(StateSimulation& sim, double dt) override;
+    double getMaxTimestep(const StateSimulation& sim) const override;
+    double getUnusedTime() const override;
 
     RotateTowardsPointCommand(const RotateTowardsPointCommand&) = delete;
     RotateTowardsPointCommand& operator=(const RotateTowardsPointCommand&) = delete;
+    RotateTowardsPointCommand(RotateTowardsPointCommand&&) = default;
 private:
     unsigned int point_id_;
     bool initialized_ = false;
     double target_x_ = 0.0;
     double target_y_ = 0.0;
     double rotation_accumulator_ = 0.0;
+    double unused_time_ = 0.0;
 
     bool initializeTarget(StateSimulation& sim);
-    void executeRotationLogic(StateSimulation& sim, double dt, short rotationNeeded);
+    double executeRotationLogic(StateSimulation& sim, double dt, short rotationNeeded);
     void applyAccumulatedRotation(StateSimulation& sim);
     bool isAlignedWithTarget(short rotationNeeded) const;
 };
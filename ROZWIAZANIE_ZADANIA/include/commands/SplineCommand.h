@@ -0,0 +1,38 @@
+/*
+    Author: Hanna Biegacz
+
+    Command to move the mower along a smooth curve (Catmull-Rom spline), which starts at the current position
+    of the mower and goes through all given points (cm).
+    Implements ICommand interface.
+    The curve is sampled into a dense polyline on the first execution, when the position of the mower is known,
+    and then the mower follows it like a PolylineCommand.
+*/
+
+#pragma once
+#include <optional>
+#include <utility>
+#include <vector>
+#include "ICommand.h"
+#include "PolylineCommand.h"
+
+class SplineCommand final : public ICommand {
+public:
+    explicit SplineCommand(std::vector<std::pair<double, double>> points);
+    bool execute(StateSimulation& sim, double dt) override;
+    double getUnusedTime() const override;
+
+    SplineCommand(const SplineCommand&) = delete;
+    SplineCommand& operator=(const SplineCommand&) = delete;
+    SplineCommand(SplineCommand&&) = default;
+
+private:
+    static constexpr double SAMPLE_DISTANCE = 2.0; // cm, the longest straight part of the sampled curve
+
+    std::vector<std::pair<double, double>> points_;
+    std::optional<PolylineCommand> path_;
+
+    static std::vector<std::pair<double, double>> sampleCurve(const std::vector<std::pair<double, double>>& points);
+    static std::pair<double, double> interpolate(const std::pair<double, double>& p0, 
+        const std::pair<double, double>& p1, const std::pair<double, double>& p2, 
+        const std::pair<double, double>& p3, double t);
+};
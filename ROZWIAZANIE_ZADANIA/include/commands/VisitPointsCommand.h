@@ -0,0 +1,42 @@
+/*
+    Author: Hanna Biegacz
+
+    Command to visit a list of points in the order which takes the shortest time.
+    Implements ICommand interface.
+    When the command starts, the points are ordered by RouteOptimizer from the current pose of the mower,
+    and the predicted times of the given and the optimized order are logged before the mower moves.
+    Then the mower drives to the points one by one the same way as with MoveToPointCommand.
+    The time left after reaching a point is used for driving to the next one.
+*/
+
+#pragma once
+#include <optional>
+#include <vector>
+#include "ICommand.h"
+#include "MoveToPointCommand.h"
+#include "RouteOptimizer.h"
+
+class VisitPointsCommand final : public ICommand {
+public:
+    explicit VisitPointsCommand(std::vector<unsigned int> pointIds,
+        double timeBudget = RouteOptimizer::DEFAULT_TIME_BUDGET);
+    bool execute(StateSimulation& sim, double dt) override;
+    double getMaxTimestep(const StateSimulation& sim) const override;
+    double getUnusedTime() const override;
+
+    VisitPointsCommand(const VisitPointsCommand&) = delete;
+    VisitPointsCommand& operator=(const VisitPointsCommand&) = delete;
+    VisitPointsCommand(VisitPointsCommand&&) = default;
+private:
+    static constexpr double MIN_STEP_TIME = 1e-6; // s, shorter rests of a step are left unused
+
+    std::vector<unsigned int> point_ids_;
+    double time_budget_;
+    bool initialized_ = false;
+    size_t next_point_index_ = 0;
+    std::optional<MoveToPointCommand> move_command_;
+    double unused_time_ = 0.0;
+
+    void initializeRoute(StateSimulation& sim);
+    void logRoutePrediction(StateSimulation& sim, const OptimizedRoute& route) const;
+};
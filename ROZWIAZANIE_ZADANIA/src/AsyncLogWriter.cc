@@ -0,0 +1,184 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Implements AsyncLogWriter class.
+*/
+
+#include <chrono>
+#include "AsyncLogWriter.h"
+#include "FileLogger.h"
+
+using namespace std;
+
+
+AsyncLogWriter::AsyncLogWriter(const string& file_path, const size_t& capacity, 
+    const LogOverflowPolicy& overflow_policy, const LogFileFormat& format) : 
+    file_logger_(make_unique<FileLogger>(file_path, format)), overflow_policy_(overflow_policy), queue_(capacity) {
+    // The writer opens the file with its own file logger, so nothing else should write to the same file
+
+    FileLogger* file_logger = file_logger_.get();
+    write_record_ = [file_logger](const LogRecord& record) { file_logger->saveRecord(record); };
+    flush_file_ = [file_logger]() { file_logger->flush(); };
+    writer_thread_ = thread(&AsyncLogWriter::runWriter, this);
+}
+
+
+AsyncLogWriter::AsyncLogWriter(RecordWriter write_record, FileFlusher flush_file, const size_t& capacity,
+    const LogOverflowPolicy& overflow_policy) : write_record_(move(write_record)), flush_file_(move(flush_file)),
+    overflow_policy_(overflow_policy), queue_(capacity) {
+    // Records are written with the given function on the writer thread, they are already filtered
+
+    writer_thread_ = thread(&AsyncLogWriter::runWriter, this);
+}
+
+
+AsyncLogWriter::~AsyncLogWriter() {
+    // Write all queued logs and stop the writer thread
+
+    {
+        lock_guard<mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    entries_condition_.notify_all();
+    writer_thread_.join();
+}
+
+
+void AsyncLogWriter::pushLog(const Log& log) {
+    LogRecord record(LogEventType::TEXT_LOG, log.getTime(), log.getMessage());
+    push(record);
+}
+
+
+void AsyncLogWriter::pushMessage(const string& message) {
+    LogRecord record(LogEventType::TEXT_MESSAGE, 0, message);
+    push(record);
+}
+
+
+void AsyncLogWriter::pushRecord(const LogRecord& record) {
+    LogRecord queued_record = record;
+    push(queued_record);
+}
+
+
+void AsyncLogWriter::push(LogRecord& record) {
+    /* Put the record into the queue. When the queue is full, the producer waits only with BLOCK policy.
+        Logs pushed after the writer started stopping cannot be waited for, so they are dropped */
+
+    while (!queue_.tryPush(record)) {
+        if (overflow_policy_ != LogOverflowPolicy::BLOCK || stopping_.load()) {
+            dropped_count_.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        wakeUpWriter();
+        this_thread::yield();
+    }
+    // Sequentially consistent pair with waitForEntries: either the writer sees the new entry before it sleeps,
+    // or the producer sees that the writer sleeps and wakes it up
+    pushed_count_.fetch_add(1);
+    if (is_writer_waiting_.load()) {
+        wakeUpWriter();
+    }
+}
+
+
+void AsyncLogWriter::wakeUpWriter() {
+    lock_guard<mutex> lock(mutex_);
+    entries_condition_.notify_one();
+}
+
+
+void AsyncLogWriter::flush() {
+    // Wait until all logs pushed before the call are written to the file
+
+    uint64_t pushed_count = pushed_count_.load();
+    wakeUpWriter();
+
+    unique_lock<mutex> lock(mutex_);
+    written_condition_.wait(lock, [this, pushed_count]() {
+        return written_count_.load(memory_order_acquire) >= pushed_count;
+    });
+    lock.unlock();
+    flush_file_();
+}
+
+
+void AsyncLogWriter::runWriter() {
+    // Write entries until the writer is stopped and the queue is empty
+
+    LogRecord record;
+    while (true) {
+        uint64_t written_in_batch = 0;
+        while (queue_.tryPop(record)) {
+            write_record_(record);
+            written_in_batch ++;
+        }
+        popped_count_ += written_in_batch;
+
+        if (written_in_batch > 0) {
+            lock_guard<mutex> lock(mutex_);
+            written_count_.fetch_add(written_in_batch, memory_order_release);
+            written_condition_.notify_all();
+        }
+        reportDrops();
+        if (written_in_batch == 0) {
+            // The writer is idle, so the buffered logs do not have to wait for the next write
+            flush_file_();
+        }
+
+        if (stopping_.load() && queue_.isEmpty()) {
+            return;
+        }
+        waitForEntries();
+    }
+}
+
+
+void AsyncLogWriter::waitForEntries() {
+    /* Sleep until a producer pushes an entry. The timeout protects from sleeping forever if a wake up
+        would be missed, it does not affect the order of the logs */
+
+    chrono::milliseconds IDLE_TIMEOUT = chrono::milliseconds(100);
+
+    unique_lock<mutex> lock(mutex_);
+    is_writer_waiting_.store(true);
+    entries_condition_.wait_for(lock, IDLE_TIMEOUT, [this]() {
+        return stopping_.load() || pushed_count_.load() > popped_count_;
+    });
+    is_writer_waiting_.store(false);
+}
+
+
+void AsyncLogWriter::reportDrops() {
+    // With DROP_AND_REPORT policy write how many logs were dropped since the last report
+
+    if (overflow_policy_ != LogOverflowPolicy::DROP_AND_REPORT) return;
+
+    uint64_t dropped_count = dropped_count_.load(memory_order_relaxed);
+    if (dropped_count == reported_drops_count_) return;
+
+    write_record_(LogRecord(LogEventType::TEXT_MESSAGE, 0,
+        "Dropped " + to_string(dropped_count - reported_drops_count_) + " log entries"));
+    reported_drops_count_ = dropped_count;
+}
+
+
+LogOverflowPolicy AsyncLogWriter::getOverflowPolicy() const {
+    return overflow_policy_;
+}
+
+
+size_t AsyncLogWriter::getCapacity() const {
+    return queue_.getCapacity();
+}
+
+
+uint64_t AsyncLogWriter::getWrittenCount() const {
+    return written_count_.load(memory_order_acquire);
+}
+
+
+uint64_t AsyncLogWriter::getDroppedCount() const {
+    return dropped_count_.load(memory_order_relaxed);
+}
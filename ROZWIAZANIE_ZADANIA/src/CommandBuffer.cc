@@ -0,0 +1,147 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of CommandBuffer class.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include "CommandBuffer.h"
+
+void CommandBuffer::push(std::unique_ptr<ICommand> command) {
+    prepareForPush();
+    commands_.emplace_back(std::move(command));
+}
+
+// Reserves memory for the given number of not finished commands, so pushing them does not allocate.
+void CommandBuffer::reserve(size_t commands_number) {
+    if (front_index_ > 0) {
+        compact();
+    }
+    commands_.reserve(commands_number);
+}
+
+// The finished command is destroyed, but the following commands are not moved.
+// When the last command is finished, the vector is emptied and keeps its memory.
+void CommandBuffer::popFront() {
+    if (isEmpty()) return;
+
+    commands_[front_index_].emplace<std::monostate>();
+    ++front_index_;
+    if (front_index_ == commands_.size()) {
+        clear();
+    }
+}
+
+void CommandBuffer::clear() {
+    commands_.clear();
+    front_index_ = 0;
+}
+
+// Removes MoveToPointCommands which were not started from the end of the queue and returns their point ids
+// in the order of the queue, e.g. to visit them in a shorter route.
+std::vector<unsigned int> CommandBuffer::takePendingPointMoves() {
+    std::vector<unsigned int> point_ids;
+    while (!isEmpty()) {
+        const MoveToPointCommand* command = std::get_if<MoveToPointCommand>(&commands_.back());
+        if (command == nullptr || command->isStarted()) {
+            break;
+        }
+        point_ids.push_back(command->getPointId());
+        commands_.pop_back();
+    }
+    if (isEmpty()) {
+        clear();
+    }
+    std::reverse(point_ids.begin(), point_ids.end());
+    return point_ids;
+}
+
+// Built-in commands are final, so they are called directly. Only user-defined commands
+// are called through the ICommand interface.
+bool CommandBuffer::executeFront(StateSimulation& sim, double dt) {
+    return std::visit([&sim, dt](auto& command) -> bool {
+        using CommandType = std::decay_t<decltype(command)>;
+        if constexpr (std::is_same_v<CommandType, std::monostate>) {
+            return true;
+        } else if constexpr (std::is_same_v<CommandType, std::unique_ptr<ICommand>>) {
+            return command->execute(sim, dt);
+        } else {
+            return command.execute(sim, dt);
+        }
+    }, commands_[front_index_]);
+}
+
+double CommandBuffer::getFrontMaxTimestep(const StateSimulation& sim) const {
+    return std::visit([&sim](const auto& command) -> double {
+        using CommandType = std::decay_t<decltype(command)>;
+        if constexpr (std::is_same_v<CommandType, std::monostate>) {
+            return std::numeric_limits<double>::infinity();
+        } else if constexpr (std::is_same_v<CommandType, std::unique_ptr<ICommand>>) {
+            return command->getMaxTimestep(sim);
+        } else {
+            return command.getMaxTimestep(sim);
+        }
+    }, commands_[front_index_]);
+}
+
+bool CommandBuffer::isFrontInstantaneous() const {
+    return std::visit([](const auto& command) -> bool {
+        using CommandType = std::decay_t<decltype(command)>;
+        if constexpr (std::is_same_v<CommandType, std::monostate>) {
+            return true;
+        } else if constexpr (std::is_same_v<CommandType, std::unique_ptr<ICommand>>) {
+            return command->isInstantaneous();
+        } else {
+            return command.isInstantaneous();
+        }
+    }, commands_[front_index_]);
+}
+
+double CommandBuffer::getFrontUnusedTime() const {
+    return std::visit([](const auto& command) -> double {
+        using CommandType = std::decay_t<decltype(command)>;
+        if constexpr (std::is_same_v<CommandType, std::monostate>) {
+            return 0.0;
+        } else if constexpr (std::is_same_v<CommandType, std::unique_ptr<ICommand>>) {
+            return command->getUnusedTime();
+        } else {
+            return command.getUnusedTime();
+        }
+    }, commands_[front_index_]);
+}
+
+bool CommandBuffer::isEmpty() const {
+    return front_index_ == commands_.size();
+}
+
+size_t CommandBuffer::getSize() const {
+    return commands_.size() - front_index_;
+}
+
+size_t CommandBuffer::getCapacity() const {
+    return commands_.capacity();
+}
+
+// When the vector is full and at least half of it holds finished commands, the waiting commands
+// are moved to the beginning instead of growing the vector.
+void CommandBuffer::prepareForPush() {
+    if (commands_.size() == commands_.capacity() && front_index_ > 0 && front_index_ * 2 >= commands_.size()) {
+        compact();
+    }
+}
+
+// Commands with reference members cannot be assigned, so they are moved by constructing
+// them again in the place of finished commands.
+void CommandBuffer::compact() {
+    size_t waiting_commands_number = getSize();
+    for (size_t i = 0; i < waiting_commands_number; ++i) {
+        Command& target = commands_[i];
+        std::visit([&target](auto& command) {
+            using CommandType = std::decay_t<decltype(command)>;
+            target.emplace<CommandType>(std::move(command));
+        }, commands_[front_index_ + i]);
+    }
+    commands_.resize(waiting_commands_number);
+    front_index_ = 0;
+}
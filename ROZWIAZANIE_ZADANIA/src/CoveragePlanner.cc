@@ -0,0 +1,219 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of CoveragePlanner class.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "CoveragePlanner.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include "FieldGrid.h"
+#include "Lawn.h"
+#include "MathHelper.h"
+#include "MowerController.h"
+#include "ScenarioWriter.h"
+
+using namespace std;
+
+namespace {
+    constexpr short QUARTER_TURN = 90;
+    constexpr unsigned short UP_ANGLE = 0;
+    constexpr unsigned short RIGHT_ANGLE = 90;
+}
+
+// Overlap is the part of the blade diameter mowed again by the next stripe, e.g. 0.1 for 10%.
+CoveragePlanner::CoveragePlanner(const Lawn& lawn, unsigned int blade_diameter, double overlap)
+    : lawn_(lawn), blade_diameter_(blade_diameter), overlap_(overlap) {
+    if (blade_diameter_ == 0) {
+        throw CoveragePlanError("Blade diameter of a coverage plan must be greater than 0.");
+    }
+    if (!(overlap_ >= 0.0 && overlap_ < 1.0)) {
+        throw CoveragePlanError("Overlap of a coverage plan must be in [0; 1) range.");
+    }
+}
+
+// Plans stripes in both directions and chooses the plan with fewer turns, or the faster one when the numbers
+// of turns are equal.
+CoveragePlan CoveragePlanner::createPlan(unsigned int speed) const {
+    CoveragePlan vertical_plan = createPlan(speed, true);
+    CoveragePlan horizontal_plan = createPlan(speed, false);
+
+    if (horizontal_plan.turns_number_ != vertical_plan.turns_number_) {
+        return horizontal_plan.turns_number_ < vertical_plan.turns_number_ ? horizontal_plan : vertical_plan;
+    }
+    return horizontal_plan.predicted_time_ < vertical_plan.predicted_time_ ? horizontal_plan : vertical_plan;
+}
+
+// Vertical stripes start in the left down corner going up, and the next stripes are on their right side.
+// Horizontal stripes start in the same corner going right, and the next stripes are above them.
+CoveragePlan CoveragePlanner::createPlan(unsigned int speed, bool are_stripes_vertical) const {
+    if (speed == 0) {
+        throw CoveragePlanError("Speed of a coverage plan must be greater than 0.");
+    }
+
+    double along_length = are_stripes_vertical ? lawn_.getLength() : lawn_.getWidth();
+    double across_length = are_stripes_vertical ? lawn_.getWidth() : lawn_.getLength();
+    vector<double> stripe_positions = calculateStripePositions(across_length);
+    double stripe_beginning = calculateStripeBeginning(along_length);
+    double stripe_length = along_length - 2.0 * stripe_beginning;
+
+    CoveragePlan plan;
+    plan.are_stripes_vertical_ = are_stripes_vertical;
+    plan.stripes_number_ = static_cast<unsigned int>(stripe_positions.size());
+    plan.stripe_spacing_ = stripe_positions.size() > 1 ? stripe_positions[1] - stripe_positions[0] : 0.0;
+    plan.starting_point_ = are_stripes_vertical ? make_pair(stripe_positions[0], stripe_beginning)
+        : make_pair(stripe_beginning, stripe_positions[0]);
+    plan.starting_angle_ = are_stripes_vertical ? UP_ANGLE : RIGHT_ANGLE;
+
+    // turning right from an up stripe, and left from a right stripe, leads to the next stripe
+    short turn = are_stripes_vertical ? QUARTER_TURN : -QUARTER_TURN;
+    plan.commands_.reserve(4 * stripe_positions.size() + 1);
+    plan.commands_.emplace_back(ScenarioCommandType::MOWING_ON);
+    if (stripe_length > 0.0) {
+        plan.commands_.emplace_back(ScenarioCommandType::MOVE, stripe_length);
+    }
+    for (size_t i = 1; i < stripe_positions.size(); ++i) {
+        plan.commands_.emplace_back(ScenarioCommandType::ROTATE, turn);
+        plan.commands_.emplace_back(ScenarioCommandType::MOVE, stripe_positions[i] - stripe_positions[i - 1]);
+        plan.commands_.emplace_back(ScenarioCommandType::ROTATE, turn);
+        if (stripe_length > 0.0) {
+            plan.commands_.emplace_back(ScenarioCommandType::MOVE, stripe_length);
+        }
+        plan.turns_number_ += 2;
+        turn = -turn;
+    }
+    plan.commands_.emplace_back(ScenarioCommandType::MOWING_OFF);
+
+    calculatePrediction(plan, speed);
+    return plan;
+}
+
+// The mower drives to the beginning of the plan with the blade off. Then it drives along the first stripe
+// as a polyline, which turns the mower exactly along the stripe whatever its angle was.
+void CoveragePlanner::emitPlan(const CoveragePlan& plan, MowerController& controller) {
+    controller.setMowing(false);
+    controller.moveAlongPolyline({plan.starting_point_});
+
+    bool is_first_move = true;
+    for (const ScenarioCommand& command : plan.commands_) {
+        switch (command.getType()) {
+            case ScenarioCommandType::MOVE:
+                if (is_first_move) {
+                    double angle = MathHelper::convertDegreesToRadians(plan.starting_angle_);
+                    controller.moveAlongPolyline({{plan.starting_point_.first + sin(angle) * command.getValue(0),
+                        plan.starting_point_.second + cos(angle) * command.getValue(0)}});
+                    is_first_move = false;
+                } else {
+                    controller.move(command.getValue(0));
+                }
+                break;
+            case ScenarioCommandType::ROTATE:
+                is_first_move = false;
+                controller.rotate(static_cast<short>(command.getValue(0)));
+                break;
+            case ScenarioCommandType::MOWING_ON:
+                controller.setMowing(true);
+                break;
+            case ScenarioCommandType::MOWING_OFF:
+                controller.setMowing(false);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// The scenario starts in the beginning of the plan, so it does not need to drive there.
+void CoveragePlanner::writeScenario(const CoveragePlan& plan, const string& path, ScenarioParameters parameters,
+    ScenarioFormat format) {
+    parameters.starting_x_ = plan.starting_point_.first;
+    parameters.starting_y_ = plan.starting_point_.second;
+    parameters.starting_angle_ = plan.starting_angle_;
+
+    ScenarioWriter writer(path, parameters, format);
+    for (const ScenarioCommand& command : plan.commands_) {
+        writer.write(command);
+    }
+    writer.close();
+}
+
+// The outer stripes touch the edges of the lawn with the edge of the blade. Stripes between them are spread
+// evenly, so their spacing is not longer than the spacing allowed by the overlap.
+vector<double> CoveragePlanner::calculateStripePositions(double across_length) const {
+    double blade_diameter = static_cast<double>(blade_diameter_);
+    if (across_length <= blade_diameter) {
+        return {across_length / 2.0};
+    }
+
+    double max_spacing = blade_diameter * (1.0 - overlap_);
+    double stripes_area = across_length - blade_diameter;
+    size_t stripes_number = static_cast<size_t>(ceil(stripes_area / max_spacing - SPACING_TOLERANCE)) + 1;
+    double spacing = stripes_area / static_cast<double>(stripes_number - 1);
+
+    vector<double> positions(stripes_number);
+    for (size_t i = 0; i < stripes_number; ++i) {
+        positions[i] = blade_diameter / 2.0 + spacing * static_cast<double>(i);
+    }
+    return positions;
+}
+
+double CoveragePlanner::calculateStripeBeginning(double along_length) const {
+    return min(static_cast<double>(blade_diameter_) / 2.0, along_length / 2.0);
+}
+
+// Follows the commands of the plan like the simulation does: moves take distance / speed, rotations take
+// angle / ROTATION_SPEED, and every move with the blade on marks fields of the section in an empty grid
+// of the lawn size. The lawn itself is only read, fields covered by its obstacles are never marked.
+void CoveragePlanner::calculatePrediction(CoveragePlan& plan, unsigned int speed) const {
+    const FieldGrid& obstacle_fields = lawn_.getObstacleFields();
+    FieldGrid mowed_fields(lawn_.getFieldGrid().getColumnsNumber(), lawn_.getFieldGrid().getRowsNumber());
+    vector<pair<unsigned int, unsigned int>> section_fields;
+    pair<double, double> position = plan.starting_point_;
+    short angle = static_cast<short>(plan.starting_angle_);
+    bool is_mowing = false;
+    double rotation_time = 0.0;
+    plan.path_length_ = 0.0;
+
+    for (const ScenarioCommand& command : plan.commands_) {
+        switch (command.getType()) {
+            case ScenarioCommandType::MOVE: {
+                double distance = command.getValue(0);
+                double radians = MathHelper::convertDegreesToRadians(static_cast<unsigned short>(angle));
+                pair<double, double> ending = make_pair(position.first + sin(radians) * distance,
+                    position.second + cos(radians) * distance);
+                if (is_mowing) {
+                    section_fields.clear();
+                    lawn_.collectGrassSection(position, blade_diameter_, ending, static_cast<unsigned short>(angle),
+                        section_fields);
+                    for (const pair<unsigned int, unsigned int>& indexes : section_fields) {
+                        if (obstacle_fields.isEmpty() || !obstacle_fields.isFieldCut(indexes.first, indexes.second)) {
+                            mowed_fields.cutField(indexes.first, indexes.second);
+                        }
+                    }
+                }
+                plan.path_length_ += distance;
+                position = ending;
+                break;
+            }
+            case ScenarioCommandType::ROTATE:
+                angle = static_cast<short>(MathHelper::normalizeAngle(angle + command.getValue(0)));
+                rotation_time += abs(command.getValue(0)) / static_cast<double>(Constants::ROTATION_SPEED);
+                break;
+            case ScenarioCommandType::MOWING_ON:
+                is_mowing = true;
+                break;
+            case ScenarioCommandType::MOWING_OFF:
+                is_mowing = false;
+                break;
+            default:
+                break;
+        }
+    }
+
+    plan.predicted_time_ = plan.path_length_ / static_cast<double>(speed) + rotation_time;
+    size_t fields_number = static_cast<size_t>(mowed_fields.getColumnsNumber()) * mowed_fields.getRowsNumber()
+        - (obstacle_fields.isEmpty() ? 0 : obstacle_fields.countCutFields());
+    plan.predicted_coverage_ = fields_number > 0
+        ? static_cast<double>(mowed_fields.countCutFields()) / static_cast<double>(fields_number) : 0.0;
+}
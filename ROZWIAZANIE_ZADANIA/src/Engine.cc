@@ -3,6 +3,7 @@
     Implementation of the simulation Engine
 */
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <thread>
@@ -13,19 +14,21 @@
 using namespace std::chrono;
 
 namespace {
-    constexpr double FIXED_TIMESTEP_SECONDS = 0.02;
     constexpr int TARGET_VISUALIZATION_FPS = 60;
     constexpr double MAX_FRAME_TIME_SECONDS = 0.25;
-    constexpr int CPU_YIELD_SLEEP_MS = 1;
+    constexpr double TICKS_PER_SECOND_WINDOW_SECONDS = 0.5;
+    constexpr double TICK_METRICS_SMOOTHING = 0.1;
 }
 
 Engine::Engine(StateSimulation& simulation, 
                std::function<void(StateSimulation&, double)> user_logic,
-               std::function<void(const std::string&)> error_callback)
+               std::function<void(const std::string&)> error_callback,
+               double fixed_timestep)
     : simulation_(simulation)
     , running_(false)
     , speed_multiplier_(1.0)
-    , fixed_timestep_(FIXED_TIMESTEP_SECONDS)
+    , fixed_timestep_(std::clamp(fixed_timestep, Constants::MIN_TIMESTEP, Constants::MAX_TIMESTEP))
+    , max_frame_time_(std::max(MAX_FRAME_TIME_SECONDS, fixed_timestep_))
     , user_simulation_callback_(user_logic ? user_logic : defaultSimulationLogic)
     , error_callback_(error_callback)
 {
@@ -47,10 +50,14 @@ void Engine::start() {
     simulation_thread_ = std::thread(&Engine::runSimulation, this);
 }
 
-// Safely shuts down the simulation thread. Waits for the thread
-// to finish before returning to prevent crashes.
+// Safely shuts down the simulation thread. Wakes it up if it is waiting for the next step
+// and waits for the thread to finish before returning to prevent crashes.
 void Engine::stop() {
-    running_ = false;
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        running_ = false;
+    }
+    wake_condition_.notify_all();
 
     if (simulation_thread_.joinable()) {
         simulation_thread_.join();
@@ -61,11 +68,22 @@ bool Engine::isRunning() const {
     return running_.load();
 }
 
+// Interrupts waiting for the next step, so the simulation thread recalculates when the next step is due.
+// Should be called when something changes the schedule, e.g. new commands were queued.
+void Engine::wakeUp() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_requested_ = true;
+    }
+    wake_condition_.notify_all();
+}
+
 void Engine::setSimulationSpeed(double multiplier) {
     if (multiplier > 0) {
         speed_multiplier_ = multiplier;
     }
     state_interpolator_.setSimulationSpeedMultiplier(multiplier);
+    wakeUp();
 }
 
 double Engine::getSpeedMultiplier() const {
@@ -84,6 +102,19 @@ void Engine::setOnErrorCallback(std::function<void(const std::string&)> callback
     error_callback_ = callback;
 }
 
+// The provider is called on the simulation thread after every step, while the state is locked.
+void Engine::setCommandQueueDepthProvider(std::function<size_t()> provider) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    command_queue_depth_provider_ = provider;
+}
+
+// Replaces snapshots of the simulation passed to the constructor, e.g. with snapshots of a whole fleet.
+// The provider is called on the simulation thread after every step, while the state is locked.
+void Engine::setSnapshotProvider(std::function<SimulationSnapshot()> provider) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    snapshot_provider_ = provider;
+}
+
 void Engine::defaultSimulationLogic(StateSimulation& simulation, double dt) {
     // by default the mower is doing nothing
 }
@@ -92,26 +123,38 @@ double Engine::getSimulationTime() const {
     return static_cast<double>(simulation_.getTime());
 }
 
+// Length of a single simulation step in seconds. Values outside the allowed range are clamped.
+double Engine::getFixedTimestep() const {
+    return fixed_timestep_;
+}
+
 StateInterpolator& Engine::getStateInterpolator() {
     return state_interpolator_;
 }
 
+const PerformanceMetrics& Engine::getPerformanceMetrics() const {
+    return metrics_;
+}
+
 // Main simulation loop running in a separate thread. Uses "fixed timestep" which means
-// the simulation always advances by exactly 0.02 seconds per step, regardless of how
+// the simulation always advances by exactly the same time per step, regardless of how
 // fast or slow the computer is. This keeps physics consistent and predictable.
 // The "accumulator" collects real time that has passed and converts it into fixed steps.
+// After the due steps are done the thread sleeps until the next one.
 void Engine::runSimulation() {
     using Clock = std::chrono::steady_clock;
     auto previous_time = Clock::now();
     double accumulator = 0.0;
+    measurement_start_ = previous_time;
+    ticks_in_measurement_ = 0;
 
     while (running_) {
         auto current_time = Clock::now();
         duration<double> frame_time = current_time - previous_time;
         previous_time = current_time;
 
-        if (frame_time.count() > MAX_FRAME_TIME_SECONDS) {
-            frame_time = duration<double>(MAX_FRAME_TIME_SECONDS);
+        if (frame_time.count() > max_frame_time_) {
+            frame_time = duration<double>(max_frame_time_);
         }
 
         accumulator += frame_time.count() * speed_multiplier_.load();
@@ -120,47 +163,127 @@ void Engine::runSimulation() {
             try {
                 updateSimulation(fixed_timestep_);
             } catch (const MoveOutsideLawnError& e) {
-                std::cerr << "[Engine] Simulation stopped: " << e.what() << std::endl;
-                running_ = false;
-                if (error_callback_) {
-                    error_callback_(e.what());
-                }
+                stopWithError(e.what());
+                break;
+            } catch (const ObstacleCollisionError& e) {
+                stopWithError(e.what());
+                break;
+            } catch (const ScenarioFormatError& e) {
+                stopWithError(e.what());
                 break;
             }
             accumulator -= fixed_timestep_;
         }
+        updateTicksPerSecond(Clock::now());
+
+        if (running_ && waitForNextStep(accumulator)) {
+            previous_time = Clock::now();
+        }
+    }
+}
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(CPU_YIELD_SLEEP_MS));
+// Errors of the mower or of the scenario stop the simulation thread, the owner is informed by the error callback.
+void Engine::stopWithError(const std::string& message) {
+    std::cerr << "[Engine] Simulation stopped: " << message << std::endl;
+    running_ = false;
+    if (error_callback_) {
+        error_callback_(message);
     }
 }
 
+// Sleeps until the accumulator will be full enough for the next step at the current speed.
+// When all queued commands are finished, steps would not change anything, so the thread sleeps
+// until it is woken up. Returns true if the thread was idle, so the idle time is not simulated.
+bool Engine::waitForNextStep(double accumulator) {
+    bool is_idle = hasNoPendingCommands();
+
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    auto wake_condition = [this]() {
+        return !running_ || wake_requested_;
+    };
+
+    if (is_idle) {
+        wake_condition_.wait(lock, wake_condition);
+    } else {
+        double seconds_to_next_step = (fixed_timestep_ - accumulator) / speed_multiplier_.load();
+        auto next_step_time = steady_clock::now() + duration_cast<steady_clock::duration>(
+            duration<double>(std::max(0.0, seconds_to_next_step)));
+        wake_condition_.wait_until(lock, next_step_time, wake_condition);
+    }
+    wake_requested_ = false;
+    return is_idle;
+}
+
+// The engine knows about pending commands only when the command queue depth provider is set.
+// Without it the user logic may do something in every step, so the engine never goes idle.
+bool Engine::hasNoPendingCommands() {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    return command_queue_depth_provider_ && command_queue_depth_provider_() == 0;
+}
+
 // Executes one simulation step: runs user logic, saves logs, and creates
-// a snapshot for smooth rendering. Thread-safe with mutex lock.
+// a snapshot for smooth rendering. Thread-safe with mutex lock, the snapshot is built under it too, because
+// its provider can be replaced by another thread. Logs are saved after the lock is released, logs are used only
+// by the simulation thread.
 void Engine::updateSimulation(double dt) {
+    auto tick_start = steady_clock::now();
+    double cutting_time_before_ms = simulation_.getCuttingTimeMs();
+    SimulationSnapshot snapshot;
     {
         std::lock_guard<std::mutex> lock(state_mutex_);
         if (user_simulation_callback_) {
             user_simulation_callback_(simulation_, dt);
         }
-        processLogs();
+        if (command_queue_depth_provider_) {
+            metrics_.command_queue_depth_ = command_queue_depth_provider_();
+        }
+        snapshot = snapshot_provider_ ? snapshot_provider_() : simulation_.buildSimulationSnapshot();
     }
-    state_interpolator_.addSimulationSnapshot(simulation_.buildSimulationSnapshot());
+    processLogs();
+    state_interpolator_.addSimulationSnapshot(snapshot);
     state_interpolator_.setSimulationSpeedMultiplier(speed_multiplier_.load());
+
+    duration<double, std::milli> tick_time = steady_clock::now() - tick_start;
+    updateTickMetrics(tick_time.count(), simulation_.getCuttingTimeMs() - cutting_time_before_ms);
+}
+
+// Publishes the duration of the last step and the time spent on cutting the lawn in it.
+// Both values are smoothed with an exponential moving average, so the HUD is readable.
+void Engine::updateTickMetrics(double tick_time_ms, double cutting_time_ms) {
+    ++ticks_in_measurement_;
+    metrics_.simulation_ticks_.fetch_add(1, std::memory_order_relaxed);
+
+    double average_tick_time = metrics_.tick_time_ms_.load(std::memory_order_relaxed);
+    double average_cutting_time = metrics_.cutting_time_per_tick_ms_.load(std::memory_order_relaxed);
+    metrics_.tick_time_ms_.store(average_tick_time + (tick_time_ms - average_tick_time) * TICK_METRICS_SMOOTHING,
+        std::memory_order_relaxed);
+    metrics_.cutting_time_per_tick_ms_.store(
+        average_cutting_time + (cutting_time_ms - average_cutting_time) * TICK_METRICS_SMOOTHING,
+        std::memory_order_relaxed);
 }
 
+// Counts steps done in a short window of real time. At speed 1 it should be 1 / fixed timestep,
+// a lower value means that the simulation thread cannot keep up.
+void Engine::updateTicksPerSecond(steady_clock::time_point now) {
+    duration<double> elapsed = now - measurement_start_;
+    if (elapsed.count() < TICKS_PER_SECOND_WINDOW_SECONDS) {
+        return;
+    }
+    metrics_.ticks_per_second_.store(ticks_in_measurement_ / elapsed.count(), std::memory_order_relaxed);
+    ticks_in_measurement_ = 0;
+    measurement_start_ = now;
+}
+
+// Saves logs collected during the step. When the file logger writes asynchronously,
+// saving only queues the logs, so the step does not wait for the disk.
 void Engine::processLogs() {
-    Logger& logger = simulation_.getLogger();
-    std::queue<Log> logsQueue = logger.getLogs();
-    if (logsQueue.empty()) {
+    simulation_.getLogger().drainInto(drained_logs_);
+    if (drained_logs_.empty()) {
         return;
     }
 
     const FileLogger& fileLogger = simulation_.getFileLogger();
-    
-    while (!logsQueue.empty()) {
-        fileLogger.saveLog(logsQueue.front());
-        logsQueue.pop();
+    for (const Log& log : drained_logs_) {
+        fileLogger.saveLog(log);
     }
-
-    logger.clear();
 }
@@ -27,3 +27,39 @@ const char* RotationAngleOutOfRangeError::what() const noexcept {
     return msg.c_str();
 }
 
+
+
+ScenarioFormatError::ScenarioFormatError(const string& message)
+    : msg(message) {}
+
+
+const char* ScenarioFormatError::what() const noexcept {
+    return msg.c_str();
+}
+
+
+CoveragePlanError::CoveragePlanError(const string& message)
+    : msg(message) {}
+
+
+const char* CoveragePlanError::what() const noexcept {
+    return msg.c_str();
+}
+
+
+InvalidObstacleError::InvalidObstacleError(const string& message)
+    : msg(message) {}
+
+
+const char* InvalidObstacleError::what() const noexcept {
+    return msg.c_str();
+}
+
+
+ObstacleCollisionError::ObstacleCollisionError(const string& message)
+    : msg(message) {}
+
+
+const char* ObstacleCollisionError::what() const noexcept {
+    return msg.c_str();
+}
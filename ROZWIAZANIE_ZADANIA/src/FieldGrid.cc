@@ -0,0 +1,118 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Implementation of FieldGrid.
+*/
+
+#include "FieldGrid.h"
+
+using namespace std;
+
+
+namespace {
+    unsigned int countBits(uint32_t word) {
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_popcount(word));
+#else
+        unsigned int counter = 0;
+        while (word != 0) {
+            word &= word - 1;
+            counter ++;
+        }
+        return counter;
+#endif
+    }
+}
+
+
+FieldGrid::FieldGrid(const unsigned int& columns_number, const unsigned int& rows_number)
+    : columns_number_(columns_number), rows_number_(rows_number), 
+    words_per_row_((columns_number + BITS_PER_WORD - 1) / BITS_PER_WORD),
+    words_(static_cast<size_t>(words_per_row_) * rows_number, 0) {}
+
+
+bool FieldGrid::operator==(const FieldGrid& other) const {
+    return columns_number_ == other.columns_number_ && rows_number_ == other.rows_number_ && 
+        words_ == other.words_;
+}
+
+
+bool FieldGrid::operator!=(const FieldGrid& other) const {
+    return !((*this) == other);
+}
+
+
+unsigned int FieldGrid::getColumnsNumber() const {
+    return columns_number_;
+}
+
+
+unsigned int FieldGrid::getRowsNumber() const {
+    return rows_number_;
+}
+
+
+unsigned int FieldGrid::getWordsPerRow() const {
+    return words_per_row_;
+}
+
+
+const vector<uint32_t>& FieldGrid::getWords() const {
+    return words_;
+}
+
+
+bool FieldGrid::isEmpty() const {
+    return columns_number_ == 0 || rows_number_ == 0;
+}
+
+
+bool FieldGrid::isFieldCut(const unsigned int& column, const unsigned int& row) const {
+    size_t index = static_cast<size_t>(row) * words_per_row_ + column / BITS_PER_WORD;
+    return (words_[index] >> (column % BITS_PER_WORD)) & 1u;
+}
+
+
+void FieldGrid::cutField(const unsigned int& column, const unsigned int& row) {
+    /* Mark field as cut. Fields outside the grid are ignored, because setting padding bits at the end
+        of the row would make them counted as cut fields. */
+
+    if (column >= columns_number_ || row >= rows_number_) return;
+
+    size_t index = static_cast<size_t>(row) * words_per_row_ + column / BITS_PER_WORD;
+    words_[index] |= 1u << (column % BITS_PER_WORD);
+}
+
+
+void FieldGrid::clearField(const unsigned int& column, const unsigned int& row) {
+    // Mark field as not cut. Fields outside the grid are ignored
+
+    if (column >= columns_number_ || row >= rows_number_) return;
+
+    size_t index = static_cast<size_t>(row) * words_per_row_ + column / BITS_PER_WORD;
+    words_[index] &= ~(1u << (column % BITS_PER_WORD));
+}
+
+
+size_t FieldGrid::countCutFields() const {
+    // Count cut fields word by word. Padding bits are never set, so they do not have to be masked.
+
+    size_t counter = 0;
+    for (uint32_t word : words_) {
+        counter += countBits(word);
+    }
+    return counter;
+}
+
+
+vector<vector<bool>> FieldGrid::toVectors() const {
+    // Convert grid to 2-dimensional vector, outer vector represents rows, inner represents columns
+
+    vector<vector<bool>> fields(rows_number_, vector<bool>(columns_number_, false));
+    for (unsigned int row = 0; row < rows_number_; row ++) {
+        for (unsigned int column = 0; column < columns_number_; column ++) {
+            fields[row][column] = isFieldCut(column, row);
+        }
+    }
+    return fields;
+}
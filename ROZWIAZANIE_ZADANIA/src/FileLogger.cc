@@ -5,42 +5,205 @@
 */
 
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <mutex>
+#include <vector>
 #include "FileLogger.h"
 
 
 using namespace std;
 
 
-FileLogger::FileLogger(const string& file_path) : file_path_(file_path) {}
+struct FileLogger::LogFile {
+    string path_;
+    LogFileFormat format_;
+    mutex mutex_;
+    vector<char> buffer_;
+    ofstream stream_; // declared after the buffer, so it is flushed and closed before the buffer is freed
+    bool is_open_ = false;
+    chrono::steady_clock::time_point last_flush_time_;
+    atomic<AsyncLogWriter*> async_writer_{nullptr};
+    unique_ptr<AsyncLogWriter> async_writer_owner_; // declared last, so queued logs are written before closing
+
+    LogFile(const string& path, const LogFileFormat& format) : path_(path), format_(format) {}
+
+    bool open();
+    void flushIfDue();
+    void writeRecord(const LogRecord& record);
+    void flush();
+};
+
+
+bool FileLogger::LogFile::open() {
+    /* Open the file at the first write. The buffer has to be set before the file is opened.
+        Header is written only to new binary logs, so logs of next runs can be appended.
+        Must be called with the file mutex locked */
+
+    if (is_open_) return true;
+
+    buffer_.resize(BUFFER_SIZE);
+    stream_.rdbuf()->pubsetbuf(buffer_.data(), buffer_.size());
+    if (format_ == LogFileFormat::BINARY) {
+        stream_.open(path_, ios::app | ios::ate | ios::binary);
+        if (stream_.is_open() && stream_.tellp() == 0) {
+            LogRecord::writeBinaryHeader(stream_);
+        }
+    } else {
+        stream_.open(path_, ios::app);
+    }
+    is_open_ = stream_.is_open();
+    last_flush_time_ = chrono::steady_clock::now();
+    return is_open_;
+}
+
+
+void FileLogger::LogFile::flushIfDue() {
+    /* Write the buffer to the file if the last flush was long ago, so the logs of a slow simulation
+        do not wait in the buffer until it is full. Must be called with the file mutex locked */
+
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    if (now - last_flush_time_ >= chrono::milliseconds(FLUSH_INTERVAL_MS)) {
+        stream_.flush();
+        last_flush_time_ = now;
+    }
+}
 
 
-FileLogger::FileLogger(const FileLogger& other) : file_path_(other.getFilePath()) {}
+void FileLogger::LogFile::writeRecord(const LogRecord& record) {
+    // Write record in the format of the file. Text records are written the same way as logs and messages
+
+    lock_guard<mutex> lock(mutex_);
+    if (!open()) return;
+
+    if (format_ == LogFileFormat::BINARY) {
+        record.writeBinary(stream_);
+    } else {
+        record.writeTextLine(stream_);
+    }
+    flushIfDue();
+}
+
+
+void FileLogger::LogFile::flush() {
+    lock_guard<mutex> lock(mutex_);
+    if (is_open_) {
+        stream_.flush();
+        last_flush_time_ = chrono::steady_clock::now();
+    }
+}
+
+
+FileLogger::FileLogger(const string& file_path, const LogFileFormat& format) :
+    log_file_(make_shared<LogFile>(file_path, format)), filter_(make_shared<LogFilter>()) {}
+
+
+FileLogger::FileLogger(const FileLogger& other) : log_file_(other.log_file_), filter_(other.filter_) {}
 
 
 const string& FileLogger::getFilePath() const {
-    return file_path_;
+    return log_file_->path_;
+}
+
+
+LogFileFormat FileLogger::getFormat() const {
+    return log_file_->format_;
+}
+
+
+LogFilter& FileLogger::getFilter() const {
+    return *filter_;
+}
+
+
+void FileLogger::enableAsyncWriting(const size_t& capacity, const LogOverflowPolicy& overflow_policy) {
+    /* Start background writer shared by all copies of the logger. It writes through the stream of the shared file,
+        which outlives it, so logs saved before the call stay before the queued ones. Enabling it again
+        keeps the running writer */
+
+    LogFile* log_file = log_file_.get();
+    lock_guard<mutex> lock(log_file->mutex_);
+    if (log_file->async_writer_owner_) return;
+
+    log_file->async_writer_owner_ = make_unique<AsyncLogWriter>(
+        [log_file](const LogRecord& record) { log_file->writeRecord(record); },
+        [log_file]() { log_file->flush(); },
+        capacity, overflow_policy);
+    log_file->async_writer_.store(log_file->async_writer_owner_.get(), memory_order_release);
+}
+
+
+bool FileLogger::isAsyncWritingEnabled() const {
+    return getAsyncWriter() != nullptr;
+}
+
+
+AsyncLogWriter* FileLogger::getAsyncWriter() const {
+    return log_file_->async_writer_.load(memory_order_acquire);
 }
 
 
 void FileLogger::saveLog(const Log& log) const {
     // Save log to the logs file
 
-    ofstream file(file_path_, ios::app);
-    if (file.is_open()) {
-        file << "Time: "<< log.getTime() << ": " << log.getMessage() << endl;
+    if (!filter_->isEnabled(LogEventType::TEXT_LOG)) return;
+
+    if (AsyncLogWriter* async_writer = getAsyncWriter()) {
+        async_writer->pushLog(log);
+        return;
+    }
+    if (log_file_->format_ == LogFileFormat::BINARY) {
+        log_file_->writeRecord(LogRecord(LogEventType::TEXT_LOG, log.getTime(), log.getMessage()));
+        return;
+    }
+
+    lock_guard<mutex> lock(log_file_->mutex_);
+    if (log_file_->open()) {
+        log_file_->stream_ << "Time: "<< log.getTime() << ": " << log.getMessage() << '\n';
+        log_file_->flushIfDue();
     }
-    file.close();
 }
 
 
 void FileLogger::saveMessage(const string& message) const {
     // Save message to the logs file
 
-    ofstream file(file_path_, ios::app);
+    if (AsyncLogWriter* async_writer = getAsyncWriter()) {
+        async_writer->pushMessage(message);
+        return;
+    }
+    if (log_file_->format_ == LogFileFormat::BINARY) {
+        log_file_->writeRecord(LogRecord(LogEventType::TEXT_MESSAGE, 0, message));
+        return;
+    }
+
+    lock_guard<mutex> lock(log_file_->mutex_);
+    if (log_file_->open()) {
+        log_file_->stream_ << message << '\n';
+        log_file_->flushIfDue();
+    }
+}
+
+
+void FileLogger::saveRecord(const LogRecord& record) const {
+    // Save structured record to the logs file
+
+    if (!filter_->isEnabled(record.getType())) return;
+
+    if (AsyncLogWriter* async_writer = getAsyncWriter()) {
+        async_writer->pushRecord(record);
+        return;
+    }
+    log_file_->writeRecord(record);
+}
+
+
+void FileLogger::flush() const {
+    // Write all logs saved before the call to the file
 
-    if (file.is_open()) {
-        file << message << endl;
+    if (AsyncLogWriter* async_writer = getAsyncWriter()) {
+        async_writer->flush();
     }
-    file.close();
+    log_file_->flush();
 }
@@ -0,0 +1,170 @@
+/* 
+    Author: Maciej Cieslik, Hanna Biegacz
+    
+    Implements FleetSimulation class.
+*/
+
+#include <algorithm>
+#include <exception>
+#include "FleetSimulation.h"
+#include "Exceptions.h"
+
+using namespace std;
+
+
+FleetSimulation::FleetMower::FleetMower(Lawn& lawn, const Mower& mower_template, const string& log_path) 
+    : mower_(mower_template.getWidth(), mower_template.getLength(), mower_template.getBladeDiameter(), 
+        mower_template.getSpeed()), 
+    file_logger_(createFileLogger(log_path)), simulation_(lawn, mower_, logger_, file_logger_) {
+    
+    mower_.setX(mower_template.getX());
+    mower_.setY(mower_template.getY());
+    mower_.setAngle(mower_template.getAngle());
+    if (!mower_template.getIsMowing()) {
+        mower_.turnOffMowing();
+    }
+    simulation_.setCuttingDeferred(true);
+}
+
+
+FileLogger FleetSimulation::FleetMower::createFileLogger(const string& log_path) {
+    // Logs of every mower are written by a background thread, so the step does not wait for the disk
+
+    FileLogger file_logger(log_path);
+    file_logger.enableAsyncWriting();
+    return file_logger;
+}
+
+
+FleetSimulation::FleetSimulation(Lawn& lawn, const string& log_path, const size_t& threads_number) 
+    : lawn_(lawn), log_path_(log_path), thread_pool_(threads_number) {}
+
+
+unsigned int FleetSimulation::addMower(const Mower& mower_template) {
+    /* Add mower with the dimensions, speed and pose of the template. The template is only copied, 
+        the fleet owns its mowers. Returns index of the new mower */
+
+    unsigned int mower_index = static_cast<unsigned int>(mowers_.size());
+    mowers_.push_back(make_unique<FleetMower>(lawn_, mower_template, createMowerLogPath(log_path_, mower_index)));
+    return mower_index;
+}
+
+
+unsigned int FleetSimulation::getMowersNumber() const {
+    return static_cast<unsigned int>(mowers_.size());
+}
+
+
+const Lawn& FleetSimulation::getLawn() const {
+    return lawn_;
+}
+
+
+StateSimulation& FleetSimulation::getSimulation(const unsigned int& mower_index) {
+    return mowers_.at(mower_index)->simulation_;
+}
+
+
+const StateSimulation& FleetSimulation::getSimulation(const unsigned int& mower_index) const {
+    return mowers_.at(mower_index)->simulation_;
+}
+
+
+MowerController& FleetSimulation::getController(const unsigned int& mower_index) {
+    return mowers_.at(mower_index)->controller_;
+}
+
+
+size_t FleetSimulation::getQueueSize() const {
+    // Count commands queued for all mowers
+
+    size_t queue_size = 0;
+    for (const unique_ptr<FleetMower>& fleet_mower : mowers_) {
+        queue_size += fleet_mower->controller_.getQueueSize();
+    }
+    return queue_size;
+}
+
+
+void FleetSimulation::update(const double& dt) {
+    /* Step all mowers in parallel. Fields collected by the mowers are cut even if one of the mowers failed,
+        because the other mowers have already moved. After that the error of the mower is passed on */
+
+    exception_ptr step_error;
+    try {
+        thread_pool_.runForEach(mowers_.size(), [this, dt](size_t mower_index) {
+            FleetMower& fleet_mower = *mowers_[mower_index];
+            fleet_mower.controller_.update(fleet_mower.simulation_, dt);
+        });
+    } catch (...) {
+        step_error = current_exception();
+    }
+
+    cutCollectedFields();
+    processLogs();
+
+    if (step_error) {
+        rethrow_exception(step_error);
+    }
+}
+
+
+void FleetSimulation::cutCollectedFields() {
+    /* Cut fields collected by all mowers during the step. Every mower cuts its fields as a part of its own pass,
+        so a field mowed by two mowers is counted as mowed twice */
+
+    for (const unique_ptr<FleetMower>& fleet_mower : mowers_) {
+        fleet_mower->simulation_.cutPendingFields();
+    }
+}
+
+
+void FleetSimulation::processLogs() {
+    // Save logs of all mowers to their files
+
+    for (const unique_ptr<FleetMower>& fleet_mower : mowers_) {
+        fleet_mower->logger_.drainInto(drained_logs_);
+        for (const Log& log : drained_logs_) {
+            fleet_mower->file_logger_.saveLog(log);
+        }
+    }
+}
+
+
+SimulationSnapshot FleetSimulation::buildSimulationSnapshot() const {
+    /* Build snapshot of the first mower and add poses of the other mowers. Points of all mowers are shown.
+        Mowers may finish their commands at different times, so the latest simulation time is used */
+
+    if (mowers_.empty()) return SimulationSnapshot();
+
+    SimulationSnapshot sim_snapshot = mowers_.front()->simulation_.buildSimulationSnapshot();
+
+    for (size_t i = 1; i < mowers_.size(); i ++) {
+        const StateSimulation& simulation = mowers_[i]->simulation_;
+        const Mower& mower = simulation.getMower();
+        sim_snapshot.other_mowers_.push_back(MowerPose{mower.getX(), mower.getY(), 
+            static_cast<double>(mower.getAngle())});
+        sim_snapshot.points_.insert(sim_snapshot.points_.end(), simulation.getPoints().begin(), 
+            simulation.getPoints().end());
+        sim_snapshot.simulation_time_ = max(sim_snapshot.simulation_time_, static_cast<double>(simulation.getTime()));
+    }
+
+    return sim_snapshot;
+}
+
+
+string FleetSimulation::createMowerLogPath(const string& log_path, const unsigned int& mower_index) {
+    /* The first mower uses the given path. Other mowers get the index of the mower before the extension,
+        for example: logs.log, logs_mower1.log, logs_mower2.log */
+
+    if (mower_index == 0) return log_path;
+
+    string suffix = "_mower" + to_string(mower_index);
+    size_t extension_position = log_path.find_last_of('.');
+    size_t directory_position = log_path.find_last_of('/');
+    bool has_extension = extension_position != string::npos && 
+        (directory_position == string::npos || extension_position > directory_position + 1);
+
+    if (!has_extension) return log_path + suffix;
+    return log_path.substr(0, extension_position) + suffix + log_path.substr(extension_position);
+}
@@ -0,0 +1,61 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of FrameStatistics.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "FrameStatistics.h"
+
+using namespace std;
+
+FrameStatistics::FrameStatistics(size_t capacity)
+    : capacity_(max<size_t>(1, capacity)) {
+    frame_times_ms_.reserve(capacity_);
+}
+
+// Stores frame time in a ring buffer, so the oldest frame time is replaced when the buffer is full.
+void FrameStatistics::addFrameTime(double frame_time_ms) {
+    if (frame_times_ms_.size() < capacity_) {
+        frame_times_ms_.push_back(frame_time_ms);
+    } else {
+        frame_times_sum_ms_ -= frame_times_ms_[next_index_];
+        frame_times_ms_[next_index_] = frame_time_ms;
+    }
+    frame_times_sum_ms_ += frame_time_ms;
+    next_index_ = (next_index_ + 1) % capacity_;
+}
+
+void FrameStatistics::clear() {
+    frame_times_ms_.clear();
+    next_index_ = 0;
+    frame_times_sum_ms_ = 0.0;
+}
+
+size_t FrameStatistics::getSamplesCount() const {
+    return frame_times_ms_.size();
+}
+
+double FrameStatistics::getAverageFrameTimeMs() const {
+    if (frame_times_ms_.empty()) return 0.0;
+    return frame_times_sum_ms_ / frame_times_ms_.size();
+}
+
+double FrameStatistics::getFramesPerSecond() const {
+    double average = getAverageFrameTimeMs();
+    if (average <= 0.0) return 0.0;
+    return 1000.0 / average;
+}
+
+// Returns the frame time below which the given percent of frames fit (nearest-rank method).
+// The samples are copied, because partial sorting changes their order.
+double FrameStatistics::getPercentileFrameTimeMs(double percentile) const {
+    if (frame_times_ms_.empty()) return 0.0;
+
+    vector<double> sorted_times = frame_times_ms_;
+    double rank = ceil(clamp(percentile, 0.0, 100.0) / 100.0 * sorted_times.size());
+    size_t index = static_cast<size_t>(max(1.0, rank)) - 1;
+
+    nth_element(sorted_times.begin(), sorted_times.begin() + index, sorted_times.end());
+    return sorted_times[index];
+}
@@ -4,8 +4,10 @@
     Describes Lawn, on which mower is cutting grass.
 */
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <thread>
 #include "Lawn.h"
 #include "MathHelper.h"
 #include "Config.h"
@@ -14,16 +16,17 @@ using namespace std;
 
 
 Lawn::Lawn(const unsigned int& lawn_width, const unsigned int& lawn_length)
-    : width_(lawn_width), length_(lawn_length)
+    : width_(lawn_width), length_(lawn_length), obstacle_map_(lawn_width, lawn_length), obstacle_fields_number_(0),
+    pass_id_(FIRST_PASS_ID), last_pass_id_(FIRST_PASS_ID), cutting_threads_number_(0), min_parallel_fields_(DEFAULT_MIN_PARALLEL_FIELDS)
     {
         Config::initializeRuntimeConstants(width_, length_);
-        fields_.resize(Config::VERTICAL_FIELDS_NUMBER, std::vector<bool>(Config::HORIZONTAL_FIELDS_NUMBER, false));
+        fields_ = FieldGrid(Config::HORIZONTAL_FIELDS_NUMBER, Config::VERTICAL_FIELDS_NUMBER);
     }
 
 
 bool Lawn::operator==(const Lawn& other) const {
     return this->width_ == other.getWidth() && this->length_ == other.getLength() && 
-        this->fields_ == other.getFields();
+        this->fields_ == other.getFieldGrid();
 }
 
 
@@ -43,6 +46,11 @@ unsigned int Lawn::getLength() const {
 
 
 std::vector<std::vector<bool>> Lawn::getFields() const {
+    return fields_.toVectors();
+}
+
+
+const FieldGrid& Lawn::getFieldGrid() const {
     return fields_;
 }
 
@@ -68,8 +76,8 @@ bool Lawn::countIfCoordInSection(const unsigned int& section_length,
 pair<unsigned int, unsigned int> Lawn::calculateFieldIndexes(const double& x, const double& y) const {
     // Calculate index of the field located inside the lawn
 
-    unsigned int x_index = Lawn::calculateIndexInSection(width_, x, fields_[0].size());
-    unsigned int y_index = Lawn::calculateIndexInSection(length_, y, fields_.size());
+    unsigned int x_index = Lawn::calculateIndexInSection(width_, x, fields_.getColumnsNumber());
+    unsigned int y_index = Lawn::calculateIndexInSection(length_, y, fields_.getRowsNumber());
 
     pair<unsigned int, unsigned int> field_indexes = pair<unsigned int, unsigned int>(x_index, y_index);
 
@@ -88,35 +96,323 @@ unsigned int Lawn::calculateIndexInSection(const unsigned int& section_length, c
 
 
 void Lawn::cutGrassOnField(const pair<unsigned int, unsigned int>& indexes) {
-    // Change field state to mowed 
+    // Change field state to mowed. Fields covered by obstacles are skipped
+
+    if (obstacle_fields_number_ > 0 && isObstacleField(indexes)) return;
 
-    fields_[indexes.second][indexes.first] = true;
+    fields_.cutField(indexes.first, indexes.second);
+
+    if (!pass_counts_.empty()) {
+        countPass(indexes);
+    }
 }
 
 
-double Lawn::calculateShavedArea() const {
-    // Calculate shaved area of the field as ratio of mowed fields to not mowed fields
+const std::vector<uint8_t>& Lawn::getPassCounts() const {
+    return pass_counts_;
+}
 
-    int64_t all_fields_number = static_cast<int64_t>(Config::HORIZONTAL_FIELDS_NUMBER) * 
-        static_cast<int64_t>(Config::VERTICAL_FIELDS_NUMBER);
-    int64_t shaved_fields_number = 0;
 
-    for (const std::vector<bool>& shavedRow : getFields()) {
-        for (bool field : shavedRow) {
-            if (field) shaved_fields_number ++;
+bool Lawn::isPassCountingEnabled() const {
+    return !pass_counts_.empty();
+}
+
+
+void Lawn::enablePassCounting() {
+    /* Allocate pass counters for all fields. Fields which are already mowed are counted as mowed once.
+        Pass ids start from FIRST_PASS_ID, so no pass has cut the fields yet */
+
+    if (isPassCountingEnabled()) return;
+
+    size_t columns_number = fields_.getColumnsNumber();
+    size_t fields_number = columns_number * fields_.getRowsNumber();
+    pass_counts_.assign(fields_number, 0);
+    last_pass_ids_.assign(fields_number, 0);
+
+    for (unsigned int row = 0; row < fields_.getRowsNumber(); row ++) {
+        for (unsigned int col = 0; col < fields_.getColumnsNumber(); col ++) {
+            if (fields_.isFieldCut(col, row)) pass_counts_[row * columns_number + col] = 1;
+        }
+    }
+}
+
+
+void Lawn::setParallelCutting(const unsigned int& threads_number, const size_t& min_parallel_fields) {
+    /* Configure cutting in bands of rows. Cuts which cover fewer fields than min_parallel_fields are done
+        on the calling thread. 0 threads means all hardware threads, 1 thread disables parallel cutting */
+
+    if (threads_number != cutting_threads_number_) {
+        cutting_pool_.reset();
+    }
+    cutting_threads_number_ = threads_number;
+    min_parallel_fields_ = min_parallel_fields;
+}
+
+
+unsigned int Lawn::getCuttingThreadsNumber() const {
+    return cutting_threads_number_;
+}
+
+
+size_t Lawn::getMinParallelFields() const {
+    return min_parallel_fields_;
+}
+
+
+const ObstacleMap& Lawn::getObstacleMap() const {
+    return obstacle_map_;
+}
+
+
+const FieldGrid& Lawn::getObstacleFields() const {
+    return obstacle_fields_;
+}
+
+
+unsigned int Lawn::addCircleObstacle(const pair<double, double>& middle, const double& radius, 
+    const ObstacleType& type) {
+    // Add circular obstacle or no-go zone and mark fields under it. Returns index of the obstacle
+
+    unsigned int obstacle_index = obstacle_map_.addCircle(middle, radius, type);
+    markObstacleFields(obstacle_index);
+    return obstacle_index;
+}
+
+
+unsigned int Lawn::addPolygonObstacle(const vector<pair<double, double>>& vertices, const ObstacleType& type) {
+    // Add polygonal obstacle or no-go zone and mark fields under it. Returns index of the obstacle
+
+    unsigned int obstacle_index = obstacle_map_.addPolygon(vertices, type);
+    markObstacleFields(obstacle_index);
+    return obstacle_index;
+}
+
+
+bool Lawn::isObstacleField(const pair<unsigned int, unsigned int>& indexes) const {
+    // Check if the field is covered by an obstacle. Indexes outside the lawn are never covered
+
+    if (obstacle_fields_.isEmpty() || indexes.first >= obstacle_fields_.getColumnsNumber() || 
+        indexes.second >= obstacle_fields_.getRowsNumber()) {
+        return false;
+    }
+    return obstacle_fields_.isFieldCut(indexes.first, indexes.second);
+}
+
+
+void Lawn::markObstacleFields(const unsigned int& obstacle_index) {
+    /* Mark fields, which middles lie inside the obstacle. Only fields of the obstacle bounding box are checked.
+        Fields mowed before the obstacle was added are restored, because obstacle fields are never mowed */
+
+    double HALF_FIELD = Config::FIELD_WIDTH / 2.0;
+    if (obstacle_fields_.isEmpty()) {
+        obstacle_fields_ = FieldGrid(fields_.getColumnsNumber(), fields_.getRowsNumber());
+    }
+
+    const Obstacle& obstacle = obstacle_map_.getObstacles()[obstacle_index];
+    double last_column = static_cast<double>(fields_.getColumnsNumber()) - 1.0;
+    double last_row = static_cast<double>(fields_.getRowsNumber()) - 1.0;
+    double first_col = max(0.0, floor(obstacle.left_down_corner_.first / Config::FIELD_WIDTH));
+    double end_col = min(last_column, floor(obstacle.right_up_corner_.first / Config::FIELD_WIDTH));
+    double first_row = max(0.0, floor(obstacle.left_down_corner_.second / Config::FIELD_WIDTH));
+    double end_row = min(last_row, floor(obstacle.right_up_corner_.second / Config::FIELD_WIDTH));
+
+    for (double row = first_row; row <= end_row; row ++) {
+        for (double col = first_col; col <= end_col; col ++) {
+            unsigned int column_index = static_cast<unsigned int>(col);
+            unsigned int row_index = static_cast<unsigned int>(row);
+            if (obstacle_fields_.isFieldCut(column_index, row_index) || !obstacle_map_.isPointInObstacle(
+                obstacle_index, col * Config::FIELD_WIDTH + HALF_FIELD, row * Config::FIELD_WIDTH + HALF_FIELD)) {
+                continue;
+            }
+
+            obstacle_fields_.cutField(column_index, row_index);
+            obstacle_fields_number_ ++;
+            fields_.clearField(column_index, row_index);
+            if (!pass_counts_.empty()) {
+                pass_counts_[static_cast<size_t>(row_index) * fields_.getColumnsNumber() + column_index] = 0;
+            }
         }
     }
+}
+
+
+ThreadPool* Lawn::getCuttingPool() {
+    /* Create the pool on the first big cut, so lawns which only get small cuts do not start any threads.
+        The calling thread cuts one of the bands as well, so the pool has one thread less than requested */
+
+    unsigned int threads_number = cutting_threads_number_;
+    if (threads_number == 0) {
+        threads_number = max(1u, thread::hardware_concurrency());
+    }
+    if (threads_number <= 1) return nullptr;
+
+    if (!cutting_pool_) {
+        cutting_pool_ = make_unique<ThreadPool>(threads_number - 1);
+    }
+    return cutting_pool_.get();
+}
+
+
+bool Lawn::isRowInBand(const double& y, const RowBand& band) const {
+    // Check if fields with the given y coordinate belong to the band. Coordinates below the lawn belong to row 0
+
+    unsigned int row = y > 0.0 ? static_cast<unsigned int>(y / Config::FIELD_WIDTH) : 0;
+    return band.first_row_ <= row && row < band.end_row_;
+}
+
+
+void Lawn::cutInRowBands(const pair<double, double>& blade_middle_beginning, const unsigned int& blade_diameter,
+    const pair<double, double>& blade_middle_ending, const function<void(const RowBand&)>& cut_band) {
+    /* Cut the area covered by the blade moving between two points. The number of fields is estimated from 
+        the bounding box of the area. Big areas are split into bands of rows, which are cut in parallel. 
+        Bands cover all rows of the lawn, so the estimation does not have to be exact */
+
+    size_t BANDS_PER_THREAD = 4;
+    double DIAMETER_TO_RADIUS_FACTOR = 2.0;
+    double blade_radius = blade_diameter / DIAMETER_TO_RADIUS_FACTOR;
+
+    double left_side_x = min(blade_middle_beginning.first, blade_middle_ending.first) - blade_radius;
+    double right_side_x = max(blade_middle_beginning.first, blade_middle_ending.first) + blade_radius;
+    double down_side_y = min(blade_middle_beginning.second, blade_middle_ending.second) - blade_radius;
+    double up_side_y = max(blade_middle_beginning.second, blade_middle_ending.second) + blade_radius;
+    double fields_number = (right_side_x - left_side_x) * (up_side_y - down_side_y) / 
+        (Config::FIELD_WIDTH * Config::FIELD_WIDTH);
+
+    ThreadPool* cutting_pool = fields_number >= static_cast<double>(min_parallel_fields_) ? getCuttingPool() : nullptr;
+    if (cutting_pool == nullptr) {
+        cut_band(RowBand());
+        return;
+    }
+
+    size_t bands_number = (cutting_pool->getThreadsNumber() + 1) * BANDS_PER_THREAD;
+    vector<RowBand> bands = splitIntoRowBands(down_side_y, up_side_y, bands_number);
+    cutting_pool->runForEach(bands.size(), [&](size_t band_index) {
+        cut_band(bands[band_index]);
+    });
+}
+
+
+vector<Lawn::RowBand> Lawn::splitIntoRowBands(const double& down_side_y, const double& up_side_y, 
+    const size_t& bands_number) const {
+    /* Split rows between down_side_y and up_side_y into bands of equal height. The first band also contains 
+        all rows below and the last band all rows above, so the bands cover the whole lawn */
+
+    double first_row = max(0.0, floor(down_side_y / Config::FIELD_WIDTH));
+    double end_row = min(static_cast<double>(fields_.getRowsNumber()), ceil(up_side_y / Config::FIELD_WIDTH));
+    unsigned int rows_number = end_row > first_row ? static_cast<unsigned int>(end_row - first_row) : 0;
+    unsigned int band_height = max(1u, static_cast<unsigned int>((rows_number + bands_number - 1) / bands_number));
+
+    vector<RowBand> bands;
+    for (unsigned int row = static_cast<unsigned int>(first_row); row < end_row; row += band_height) {
+        RowBand band;
+        band.first_row_ = bands.empty() ? 0 : row;
+        band.end_row_ = row + band_height;
+        bands.push_back(band);
+    }
+
+    if (bands.empty()) {
+        bands.push_back(RowBand());
+    }
+    bands.back().end_row_ = UINT_MAX;
+    return bands;
+}
+
+
+uint32_t Lawn::beginPass(const pair<double, double>& blade_middle, const unsigned int& blade_diameter) {
+    /* Start a new pass of the blade and return its id. Fields under the blade in blade_middle were cut by 
+        the previous pass, which goes on into the new one without lifting the blade, so they are not
+        counted again. Any other field cut by the new pass counts as a new pass over it */
+
+    uint32_t previous_pass_id = pass_id_;
+    last_pass_id_ ++;
+    pass_id_ = last_pass_id_;
+    if (!isPassCountingEnabled()) return pass_id_;
+
+    size_t columns_number = fields_.getColumnsNumber();
+    auto continue_pass = [&](const pair<unsigned int, unsigned int>& indexes) {
+        size_t index = static_cast<size_t>(indexes.second) * columns_number + indexes.first;
+        if (last_pass_ids_[index] == previous_pass_id) last_pass_ids_[index] = pass_id_;
+    };
+    visitCircleFields(blade_middle, blade_diameter, RowBand(), continue_pass);
+    return pass_id_;
+}
+
+
+uint32_t Lawn::getPassId() const {
+    return pass_id_;
+}
+
+
+void Lawn::setPassId(const uint32_t& pass_id) {
+    // Go back to a pass started earlier, used when several mowers cut the lawn by turns
+
+    pass_id_ = pass_id;
+}
+
+
+void Lawn::countPass(const pair<unsigned int, unsigned int>& indexes) {
+    /* Count a new pass over the field. The field already cut by the current pass was counted before,
+        the field cut by any other pass is passed over again */
+
+    uint8_t MAX_PASS_COUNT = UINT8_MAX;
+    size_t index = static_cast<size_t>(indexes.second) * fields_.getColumnsNumber() + indexes.first;
+
+    if (last_pass_ids_[index] == pass_id_) {
+        return;
+    }
+    if (pass_counts_[index] < MAX_PASS_COUNT) {
+        pass_counts_[index] ++;
+    }
+    last_pass_ids_[index] = pass_id_;
+}
+
+
+double Lawn::calculateOverlapRatio() const {
+    /* Calculate ratio of repeated passes to all passes. 0 means that every field was mowed at most once,
+        0.5 means that half of mowing work was spent on already mowed fields */
+
+    int64_t all_passes = 0;
+    int64_t repeated_passes = 0;
+
+    for (uint8_t passes : pass_counts_) {
+        all_passes += passes;
+        if (passes > 1) repeated_passes += passes - 1;
+    }
+
+    if (all_passes == 0) return 0.0;
+    return static_cast<double>(repeated_passes) / static_cast<double>(all_passes);
+}
+
+
+double Lawn::calculateShavedArea() const {
+    /* Calculate shaved area of the field as ratio of mowed fields to all fields, which can be mowed.
+        Fields covered by obstacles are never mowed, so they are not counted */
+
+    int64_t all_fields_number = static_cast<int64_t>(Config::HORIZONTAL_FIELDS_NUMBER) * 
+        static_cast<int64_t>(Config::VERTICAL_FIELDS_NUMBER) - static_cast<int64_t>(obstacle_fields_number_);
+    int64_t shaved_fields_number = static_cast<int64_t>(fields_.countCutFields());
+    if (all_fields_number <= 0) return 0.0;
 
     return static_cast<double>(shaved_fields_number) / static_cast<double>(all_fields_number);
 }
 
 
 void Lawn::cutGrass(const pair<double, double>& blade_middle, const unsigned int& blade_diameter) {
-    /* Cut grass in circle shape. Iterates over all fields of minimal square in which all circle can be fit.
-        Each field is checked if it is in circle. If field is both in the circle and in the lawn as well, the field
-        is mowed. Otherwise the field is not mowed. */
+    // Cut grass in circle shape as a separate cut
+
+    auto cut_field = [this](const pair<unsigned int, unsigned int>& indexes) { cutGrassOnField(indexes); };
+    cutInRowBands(blade_middle, blade_diameter, blade_middle, [&](const RowBand& band) {
+        visitCircleFields(blade_middle, blade_diameter, band, cut_field);
+    });
+}
 
-    double DIAMETER_TO_RADIUS_DIVISION_FACTOR = 2.0;
+
+template <typename FieldVisitor>
+void Lawn::visitCircleFields(const pair<double, double>& blade_middle, const unsigned int& blade_diameter,
+    const RowBand& band, FieldVisitor& visitor) const {
+    /* Visit fields of circle shape. Iterates over all fields of minimal square in which all circle can be fit.
+        Each field is checked if it is in circle. If field is both in the circle and in the lawn as well, the field
+        is visited (mowed). Otherwise the field is not visited. */
 
     pair<double, double> first_coords = calculateFirstMowingFieldCoords(blade_middle, blade_diameter);
     pair<unsigned int, unsigned int> first_indexes = calculateFieldIndexes(first_coords.first, first_coords.second);
@@ -128,10 +424,11 @@ void Lawn::cutGrass(const pair<double, double>& blade_middle, const unsigned int
     double current_x = beginning_x;
 
     while (current_y < ending_y) {
-        while (current_x < ending_x) {
+        bool is_row_in_band = isRowInBand(current_y, band);
+        while (is_row_in_band && current_x < ending_x) {
             if (isFieldInMowingArea(current_x, current_y, blade_middle, blade_diameter)) {
                 pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(current_x, current_y);
-                cutGrassOnField(indexes);
+                visitor(indexes);
             }
             current_x = current_x + Config::FIELD_WIDTH;
         }
@@ -212,31 +509,80 @@ void Lawn::cutGrassSection(const std::pair<double, double>& blade_middle_beginni
     const std::pair<double, double>& blade_middle_ending, const unsigned short& angle) {
     // Cuts grass area, which contsists of two circles and one rectangle
  
-    cutGrass(blade_middle_beginning, blade_diameter);
-    cutRectangularGrass(blade_middle_beginning, blade_diameter, blade_middle_ending, angle);
-    cutGrass(blade_middle_ending, blade_diameter);
+    auto cut_field = [this](const pair<unsigned int, unsigned int>& indexes) { cutGrassOnField(indexes); };
+    cutInRowBands(blade_middle_beginning, blade_diameter, blade_middle_ending, [&](const RowBand& band) {
+        visitSectionFields(blade_middle_beginning, blade_diameter, blade_middle_ending, angle, band, cut_field);
+    });
+}
+
+
+void Lawn::collectGrassSection(const std::pair<double, double>& blade_middle_beginning, 
+    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
+    const unsigned short& angle, vector<pair<unsigned int, unsigned int>>& out_fields) const {
+    /* Collect indexes of fields, which would be cut by cutGrassSection, without changing the lawn.
+        Fields are appended to out_fields and may repeat, cutting a field twice in one cut has no extra effect */
+
+    auto collect_field = [&out_fields](const pair<unsigned int, unsigned int>& indexes) {
+        out_fields.push_back(indexes); 
+    };
+    visitSectionFields(blade_middle_beginning, blade_diameter, blade_middle_ending, angle, RowBand(), collect_field);
+}
+
+
+void Lawn::cutFields(const vector<pair<unsigned int, unsigned int>>& fields) {
+    // Cut previously collected fields as a part of the current cut. Does not begin a new cut
+
+    for (const pair<unsigned int, unsigned int>& indexes : fields) {
+        cutGrassOnField(indexes);
+    }
+}
+
+
+template <typename FieldVisitor>
+void Lawn::visitSectionFields(const std::pair<double, double>& blade_middle_beginning, 
+    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
+    const unsigned short& angle, const RowBand& band, FieldVisitor& visitor) const {
+    // Visit fields of the area, which contsists of two circles and one rectangle
+
+    visitCircleFields(blade_middle_beginning, blade_diameter, band, visitor);
+    visitRectangleFields(blade_middle_beginning, blade_diameter, blade_middle_ending, angle, band, visitor);
+    visitCircleFields(blade_middle_ending, blade_diameter, band, visitor);
 }
 
 
 void Lawn::cutRectangularGrass(const std::pair<double, double>& blade_middle_beginning, 
     const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
     const unsigned short& angle) {
-    // Cuts rectangular shaped grass. Provides correct mowing mode, depends on the position of rectangle
+    // Cuts rectangular shaped grass as a separate cut
+
+    auto cut_field = [this](const pair<unsigned int, unsigned int>& indexes) { cutGrassOnField(indexes); };
+    cutInRowBands(blade_middle_beginning, blade_diameter, blade_middle_ending, [&](const RowBand& band) {
+        visitRectangleFields(blade_middle_beginning, blade_diameter, blade_middle_ending, angle, band, cut_field);
+    });
+}
+
+
+template <typename FieldVisitor>
+void Lawn::visitRectangleFields(const std::pair<double, double>& blade_middle_beginning, 
+    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
+    const unsigned short& angle, const RowBand& band, FieldVisitor& visitor) const {
+    // Visits rectangular shaped grass. Provides correct mowing mode, depends on the position of rectangle
 
-    
     if (angle % 90 == 0) {
-        cutVerticalRectangle(blade_middle_beginning, blade_diameter, blade_middle_ending);
+        visitVerticalRectangleFields(blade_middle_beginning, blade_diameter, blade_middle_ending, band, visitor);
     }
     else {
-        cutTiltedRectangle(blade_middle_beginning, blade_diameter, blade_middle_ending, angle);
+        visitTiltedRectangleFields(blade_middle_beginning, blade_diameter, blade_middle_ending, angle, band, 
+            visitor);
     }
 }
 
 
-void Lawn::cutTiltedRectangle(const std::pair<double, double>& blade_middle_beginning, 
+template <typename FieldVisitor>
+void Lawn::visitTiltedRectangleFields(const std::pair<double, double>& blade_middle_beginning, 
     const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
-    const unsigned short& angle) {
-    /* Cuts grass in tilted rectangular shape. Iterates through fields which are located inside the big 
+    const unsigned short& angle, const RowBand& band, FieldVisitor& visitor) const {
+    /* Visits grass in tilted rectangular shape. Iterates through fields which are located inside the big 
     not tilted rectangle, which is the minimal rectangle, in which mowing rectangular area can be fit. 
     If field is both in big rectangle and small rectangle it is mowed.*/ 
 
@@ -285,9 +631,10 @@ void Lawn::cutTiltedRectangle(const std::pair<double, double>& blade_middle_begi
     while ((addition_factors.second > 0 && current_y <= end_y) ||
         (addition_factors.second < 0 && current_y >= end_y)) {
         double current_x = start_x;
+        bool is_row_in_band = isRowInBand(current_y, band);
 
-        while ((addition_factors.first > 0 && current_x <= end_x) ||
-            (addition_factors.first < 0 && current_x >= end_x)) {
+        while (is_row_in_band && ((addition_factors.first > 0 && current_x <= end_x) ||
+            (addition_factors.first < 0 && current_x >= end_x))) {
             double b_horizontal = current_y - a_perpendicular * current_x;
             double b_vertical = current_y - a_mower_path * current_x;
 
@@ -296,7 +643,7 @@ void Lawn::cutTiltedRectangle(const std::pair<double, double>& blade_middle_begi
                 isPointInLawn(current_x, current_y)) {
 
                 pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(current_x, current_y);
-                cutGrassOnField(indexes); 
+                visitor(indexes); 
             }
             current_x += addition_factors.first;
         }
@@ -305,7 +652,7 @@ void Lawn::cutTiltedRectangle(const std::pair<double, double>& blade_middle_begi
 }
 
 
-pair<double, double> Lawn::calculateAdditionFactors(const unsigned short& angle) {
+pair<double, double> Lawn::calculateAdditionFactors(const unsigned short& angle) const {
     // Calculate addition factor for fields for iteration in nested loop, depending on angle.
 
     double x_addition_factor = Config::FIELD_WIDTH;
@@ -326,9 +673,11 @@ pair<double, double> Lawn::calculateAdditionFactors(const unsigned short& angle)
 }
 
 
-void Lawn::cutVerticalRectangle(const std::pair<double, double>& blade_middle_beginning, 
-    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending) {
-    // Cut grass in not tilted rectangular shape. Simplified version of default tilted rectangle mowing 
+template <typename FieldVisitor>
+void Lawn::visitVerticalRectangleFields(const std::pair<double, double>& blade_middle_beginning, 
+    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
+    const RowBand& band, FieldVisitor& visitor) const {
+    // Visit grass in not tilted rectangular shape. Simplified version of default tilted rectangle mowing 
 
     double DIAMETER_TO_RADIUS_FACTOR = 2;
     double blade_radius = blade_diameter / DIAMETER_TO_RADIUS_FACTOR;
@@ -342,7 +691,8 @@ void Lawn::cutVerticalRectangle(const std::pair<double, double>& blade_middle_be
     double down_side_y;
     double right_side_x;
     double up_side_y;
-    if (beginning_x - ending_x == 0) {
+    // sin and cos of multiples of 90 degrees are not exact, so the direction is taken from the longer difference
+    if (abs(beginning_x - ending_x) <= abs(beginning_y - ending_y)) {
         left_side_x = max(beginning_x - blade_radius, 0.0);
         down_side_y = max(min(beginning_y, ending_y), 0.0);
         right_side_x = min(double(width_), beginning_x + blade_radius);
@@ -360,9 +710,187 @@ void Lawn::cutVerticalRectangle(const std::pair<double, double>& blade_middle_be
     beginning_y = indexes.second * Config::FIELD_WIDTH + Config::FIELD_WIDTH / 2;
 
     for (double current_y = beginning_y; current_y <= up_side_y; current_y += Config::FIELD_WIDTH) {
+        if (!isRowInBand(current_y, band)) continue;
+
         for (double current_x = beginning_x; current_x <= right_side_x; current_x += Config::FIELD_WIDTH) {
             pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(current_x, current_y);
-            cutGrassOnField(indexes);
+            visitor(indexes);
+        }
+    }
+}
+
+
+void Lawn::cutGrassArc(const pair<double, double>& arc_middle, const double& radius, const double& beginning_angle,
+    const double& sweep_angle, const unsigned int& blade_diameter) {
+    /* Cut the area swept by the blade, which middle moves along an arc, as a separate cut. Angles are measured 
+        like the angle of the mower (0 degrees meaning up, clockwise), positive sweep angle means clockwise arc */
+
+    auto cut_field = [this](const pair<unsigned int, unsigned int>& indexes) { cutGrassOnField(indexes); };
+    ArcSection arc = createArcSection(arc_middle, radius, beginning_angle, sweep_angle);
+    pair<pair<double, double>, pair<double, double>> bounds = calculateArcBounds(arc);
+    cutInRowBands(bounds.first, blade_diameter, bounds.second, [&](const RowBand& band) {
+        visitArcFields(arc, blade_diameter, band, cut_field);
+    });
+}
+
+
+void Lawn::collectGrassArc(const pair<double, double>& arc_middle, const double& radius, 
+    const double& beginning_angle, const double& sweep_angle, const unsigned int& blade_diameter,
+    vector<pair<unsigned int, unsigned int>>& out_fields) const {
+    // Collect indexes of fields, which would be cut by cutGrassArc, without changing the lawn
+
+    auto collect_field = [&out_fields](const pair<unsigned int, unsigned int>& indexes) {
+        out_fields.push_back(indexes); 
+    };
+    ArcSection arc = createArcSection(arc_middle, radius, beginning_angle, sweep_angle);
+    visitArcFields(arc, blade_diameter, RowBand(), collect_field);
+}
+
+
+Lawn::ArcSection Lawn::createArcSection(const pair<double, double>& arc_middle, const double& radius,
+    const double& beginning_angle, const double& sweep_angle) const {
+    // Precompute ends of the arc, so checking fields does not need trigonometric functions
+
+    double FULL_ANGLE = 360.0;
+    double HALF_ANGLE = 180.0;
+
+    double beginning_radians = MathHelper::convertFractionalDegreesToRadians(beginning_angle);
+    double ending_radians = MathHelper::convertFractionalDegreesToRadians(beginning_angle + sweep_angle);
+
+    ArcSection arc;
+    arc.arc_middle_ = arc_middle;
+    arc.radius_ = radius;
+    arc.beginning_direction_ = pair<double, double>(sin(beginning_radians), cos(beginning_radians));
+    arc.ending_direction_ = pair<double, double>(sin(ending_radians), cos(ending_radians));
+    arc.beginning_point_ = pair<double, double>(arc_middle.first + radius * arc.beginning_direction_.first,
+        arc_middle.second + radius * arc.beginning_direction_.second);
+    arc.ending_point_ = pair<double, double>(arc_middle.first + radius * arc.ending_direction_.first,
+        arc_middle.second + radius * arc.ending_direction_.second);
+    arc.orientation_ = sweep_angle >= 0.0 ? -1.0 : 1.0;
+    arc.is_longer_than_half_circle_ = abs(sweep_angle) > HALF_ANGLE;
+    arc.is_full_circle_ = abs(sweep_angle) >= FULL_ANGLE;
+    return arc;
+}
+
+
+bool Lawn::isDirectionInArc(const double& dx, const double& dy, const ArcSection& arc) const {
+    /* Check if the direction from the middle of the arc lies between directions of its ends. Signs of cross
+        products tell on which side of the end directions the point is. An arc longer than a half of the circle
+        contains every direction, which is not strictly inside the remaining part of the circle */
+
+    if (arc.is_full_circle_) return true;
+
+    double beginning_cross = arc.orientation_ * 
+        (arc.beginning_direction_.first * dy - arc.beginning_direction_.second * dx);
+    double ending_cross = arc.orientation_ * 
+        (dx * arc.ending_direction_.second - dy * arc.ending_direction_.first);
+
+    if (arc.is_longer_than_half_circle_) {
+        return !(beginning_cross < 0.0 && ending_cross < 0.0);
+    }
+    return beginning_cross >= 0.0 && ending_cross >= 0.0;
+}
+
+
+bool Lawn::isPointInArcArea(const double& x, const double& y, const ArcSection& arc, 
+    const double& blade_radius) const {
+    /* Check if the point is in range of the blade moving along the arc. Next to the arc the distance to the arc
+        is measured along the radius, beyond its ends the point must be in range of the blade at one of the ends */
+
+    double dx = x - arc.arc_middle_.first;
+    double dy = y - arc.arc_middle_.second;
+
+    if (isDirectionInArc(dx, dy, arc)) {
+        return abs(sqrt(dx * dx + dy * dy) - arc.radius_) <= blade_radius;
+    }
+    return calculateDistanceBetweenPoints(x, y, arc.beginning_point_) <= blade_radius || 
+        calculateDistanceBetweenPoints(x, y, arc.ending_point_) <= blade_radius;
+}
+
+
+bool Lawn::isFieldInArcArea(const double& x, const double& y, const ArcSection& arc, 
+    const double& blade_radius) const {
+    /* Same rule as for the circle: 3 corners in range, or 2 corners and the middle of the field in range.
+        The whole area lies in the ring around the arc, so fields far from the ring are rejected at once */
+
+    double HALF_DIAGONAL_FACTOR = sqrt(2.0) / 2.0;
+
+    double middle_dx = x + Config::FIELD_WIDTH / 2.0 - arc.arc_middle_.first;
+    double middle_dy = y + Config::FIELD_WIDTH / 2.0 - arc.arc_middle_.second;
+    double ring_distance = abs(sqrt(middle_dx * middle_dx + middle_dy * middle_dy) - arc.radius_);
+    if (ring_distance > blade_radius + Config::FIELD_WIDTH * HALF_DIAGONAL_FACTOR) {
+        return false;
+    }
+
+    pair<double, double> points[4] = {
+        {x, y},
+        {x + Config::FIELD_WIDTH, y},
+        {x + Config::FIELD_WIDTH, y + Config::FIELD_WIDTH},
+        {x, y + Config::FIELD_WIDTH}
+    };
+
+    unsigned int counter = 0;
+    for (pair<double, double> point : points) {
+        if (isPointInArcArea(point.first, point.second, arc, blade_radius)) {
+            counter ++;
+        }
+    }
+
+    if (counter > 2) {
+        return true;
+    }
+    else if (counter == 2) {
+        return isPointInArcArea(x + Config::FIELD_WIDTH / 2.0, y + Config::FIELD_WIDTH / 2.0, arc, blade_radius);
+    }
+    return false;
+}
+
+
+pair<pair<double, double>, pair<double, double>> Lawn::calculateArcBounds(const ArcSection& arc) const {
+    /* Calculate the left down and the right up corner of the smallest rectangle containing the arc. Besides the ends,
+        the arc can reach the extreme points of its circle (up, right, down and left of the middle) */
+
+    double left_x = min(arc.beginning_point_.first, arc.ending_point_.first);
+    double right_x = max(arc.beginning_point_.first, arc.ending_point_.first);
+    double down_y = min(arc.beginning_point_.second, arc.ending_point_.second);
+    double up_y = max(arc.beginning_point_.second, arc.ending_point_.second);
+
+    if (isDirectionInArc(0.0, 1.0, arc)) up_y = arc.arc_middle_.second + arc.radius_;
+    if (isDirectionInArc(1.0, 0.0, arc)) right_x = arc.arc_middle_.first + arc.radius_;
+    if (isDirectionInArc(0.0, -1.0, arc)) down_y = arc.arc_middle_.second - arc.radius_;
+    if (isDirectionInArc(-1.0, 0.0, arc)) left_x = arc.arc_middle_.first - arc.radius_;
+
+    return pair<pair<double, double>, pair<double, double>>(pair<double, double>(left_x, down_y), 
+        pair<double, double>(right_x, up_y));
+}
+
+
+template <typename FieldVisitor>
+void Lawn::visitArcFields(const ArcSection& arc, const unsigned int& blade_diameter, const RowBand& band,
+    FieldVisitor& visitor) const {
+    // Visit fields in range of the blade moving along the arc. Only fields around the arc are checked
+
+    double DIAMETER_TO_RADIUS_FACTOR = 2.0;
+    double blade_radius = blade_diameter / DIAMETER_TO_RADIUS_FACTOR;
+
+    pair<pair<double, double>, pair<double, double>> bounds = calculateArcBounds(arc);
+    double left_side_x = max(bounds.first.first - blade_radius, 0.0);
+    double down_side_y = max(bounds.first.second - blade_radius, 0.0);
+    double right_side_x = min(bounds.second.first + blade_radius, static_cast<double>(width_));
+    double up_side_y = min(bounds.second.second + blade_radius, static_cast<double>(length_));
+    if (left_side_x >= right_side_x || down_side_y >= up_side_y) return;
+
+    pair<unsigned int, unsigned int> first_indexes = calculateFieldIndexes(left_side_x, down_side_y);
+    double beginning_x = static_cast<double>(first_indexes.first) * Config::FIELD_WIDTH;
+    double beginning_y = static_cast<double>(first_indexes.second) * Config::FIELD_WIDTH;
+
+    for (double current_y = beginning_y; current_y < up_side_y; current_y += Config::FIELD_WIDTH) {
+        if (!isRowInBand(current_y, band)) continue;
+
+        for (double current_x = beginning_x; current_x < right_side_x; current_x += Config::FIELD_WIDTH) {
+            if (isFieldInArcArea(current_x, current_y, arc, blade_radius)) {
+                visitor(calculateFieldIndexes(current_x, current_y));
+            }
         }
     }
 }
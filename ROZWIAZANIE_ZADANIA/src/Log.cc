@@ -9,19 +9,7 @@
 using namespace std;
 
 
-Log::Log(const u_int64_t& time, const string& message) : time_(time), message_(message) {}
-
-
-Log::Log(const Log& other) : time_(other.getTime()), message_(other.getMessage()) {}
-
-
-Log& Log::operator=(const Log& other) {
-    if (this != &other) {
-        time_ = other.getTime();
-        message_ = other.getMessage();
-    }
-    return *this;
-}
+Log::Log(const u_int64_t& time, string message) : time_(time), message_(std::move(message)) {}
 
 
 u_int64_t Log::getTime() const {
@@ -29,7 +17,7 @@ u_int64_t Log::getTime() const {
 }
 
 
-string Log::getMessage() const {
+const string& Log::getMessage() const {
     return message_;
 }
 
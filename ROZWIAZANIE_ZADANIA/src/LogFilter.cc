@@ -0,0 +1,46 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Implements LogFilter class.
+*/
+
+#include "LogFilter.h"
+
+using namespace std;
+
+
+LogFilter::LogFilter() : min_level_(static_cast<uint8_t>(LogLevel::DEBUG)), disabled_categories_(0) {}
+
+
+LogLevel LogFilter::getMinLevel() const {
+    return static_cast<LogLevel>(min_level_.load(memory_order_relaxed));
+}
+
+
+void LogFilter::setMinLevel(const LogLevel& level) {
+    min_level_.store(static_cast<uint8_t>(level), memory_order_relaxed);
+}
+
+
+bool LogFilter::isCategoryEnabled(const LogCategory& category) const {
+    uint32_t category_bit = 1u << static_cast<uint8_t>(category);
+    return (disabled_categories_.load(memory_order_relaxed) & category_bit) == 0;
+}
+
+
+void LogFilter::setCategoryEnabled(const LogCategory& category, const bool& enable) {
+    uint32_t category_bit = 1u << static_cast<uint8_t>(category);
+    if (enable) {
+        disabled_categories_.fetch_and(~category_bit, memory_order_relaxed);
+    } else {
+        disabled_categories_.fetch_or(category_bit, memory_order_relaxed);
+    }
+}
+
+
+bool LogFilter::isEnabled(const LogEventType& type) const {
+    if (type == LogEventType::TEXT_MESSAGE) return true;
+
+    return static_cast<uint8_t>(LogRecord::getLevel(type)) >= min_level_.load(memory_order_relaxed) && 
+        isCategoryEnabled(LogRecord::getCategory(type));
+}
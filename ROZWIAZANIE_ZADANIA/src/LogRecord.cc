@@ -0,0 +1,289 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Implements LogRecord class.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include "LogRecord.h"
+
+using namespace std;
+
+
+constexpr char LogRecord::BINARY_LOG_MAGIC[];
+
+
+LogRecord::LogRecord() : type_(LogEventType::TEXT_MESSAGE), time_(0), values_({0.0, 0.0, 0.0}) {}
+
+
+LogRecord::LogRecord(const LogEventType& type, const u_int64_t& time, const double& value_0, 
+    const double& value_1, const double& value_2) : type_(type), time_(time), values_({value_0, value_1, value_2}) {}
+
+
+LogRecord::LogRecord(const LogEventType& type, const u_int64_t& time, const string& text) : type_(type), 
+    time_(time), values_({0.0, 0.0, 0.0}), text_(text) {}
+
+
+bool LogRecord::operator==(const LogRecord& other) const {
+    return type_ == other.getType() && time_ == other.getTime() && values_ == other.values_ && 
+        text_ == other.getText();
+}
+
+
+bool LogRecord::operator!=(const LogRecord& other) const {
+    return !((*this) == other);
+}
+
+
+LogEventType LogRecord::getType() const {
+    return type_;
+}
+
+
+u_int64_t LogRecord::getTime() const {
+    return time_;
+}
+
+
+double LogRecord::getValue(const unsigned int& index) const {
+    return values_.at(index);
+}
+
+
+const string& LogRecord::getText() const {
+    return text_;
+}
+
+
+unsigned int LogRecord::getValuesNumber(const LogEventType& type) {
+    // Number of values, which are meaningful for given event type and are saved in the binary log
+
+    switch (type) {
+        case LogEventType::MOVED:
+        case LogEventType::ROUTE_OPTIMIZED:
+            return 3;
+        case LogEventType::ROTATED:
+        case LogEventType::POINT_NOT_FOUND:
+        case LogEventType::MOVING_TO_POINT:
+        case LogEventType::POINT_NOT_DELETED:
+        case LogEventType::POINT_ARRIVED:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+
+bool LogRecord::isTextType(const LogEventType& type) {
+    return type == LogEventType::TEXT_LOG || type == LogEventType::TEXT_MESSAGE;
+}
+
+
+LogLevel LogRecord::getLevel(const LogEventType& type) {
+    // Logs from the Logger (text logs) describe errors. Unknown events are not treated as errors
+
+    switch (type) {
+        case LogEventType::MOVED:
+        case LogEventType::ROTATED:
+            return LogLevel::DEBUG;
+        case LogEventType::TEXT_LOG:
+        case LogEventType::MOVED_OUTSIDE_LAWN:
+        case LogEventType::INVALID_ROTATION_ANGLE:
+        case LogEventType::POINT_NOT_FOUND:
+        case LogEventType::MOVED_INTO_OBSTACLE:
+        case LogEventType::POINT_OUTSIDE_LAWN:
+        case LogEventType::POINT_NOT_DELETED:
+        case LogEventType::NO_POINTS_FOUND:
+            return LogLevel::ERROR;
+        default:
+            return LogLevel::INFO;
+    }
+}
+
+
+LogCategory LogRecord::getCategory(const LogEventType& type) {
+    switch (type) {
+        case LogEventType::MOVED:
+            return LogCategory::MOVEMENT;
+        case LogEventType::ROTATED:
+            return LogCategory::ROTATION;
+        case LogEventType::MOWING_ON:
+        case LogEventType::MOWING_OFF:
+            return LogCategory::MOWING;
+        case LogEventType::MOVING_TO_POINT:
+        case LogEventType::POINT_ARRIVED:
+        case LogEventType::ROUTE_OPTIMIZED:
+            return LogCategory::POINTS;
+        case LogEventType::TEXT_LOG:
+        case LogEventType::MOVED_OUTSIDE_LAWN:
+        case LogEventType::INVALID_ROTATION_ANGLE:
+        case LogEventType::POINT_NOT_FOUND:
+        case LogEventType::MOVED_INTO_OBSTACLE:
+        case LogEventType::POINT_OUTSIDE_LAWN:
+        case LogEventType::POINT_NOT_DELETED:
+        case LogEventType::NO_POINTS_FOUND:
+            return LogCategory::ERRORS;
+        default:
+            return LogCategory::GENERAL;
+    }
+}
+
+
+string LogRecord::formatMessage() const {
+    ostringstream stream;
+    writeMessage(stream);
+    return stream.str();
+}
+
+
+string LogRecord::formatLine() const {
+    // Build the line of the text log (without the new line character)
+
+    string line = "";
+    if (type_ != LogEventType::TEXT_MESSAGE) {
+        line = "Time: " + to_string(time_) + ": ";
+    }
+    return line + formatMessage();
+}
+
+
+void LogRecord::writeTextLine(ostream& stream) const {
+    // Write the line of the text log directly to the stream, so no temporary strings are allocated
+
+    if (type_ != LogEventType::TEXT_MESSAGE) {
+        stream << "Time: " << time_ << ": ";
+    }
+    writeMessage(stream);
+    stream << '\n';
+}
+
+
+void LogRecord::writeMessage(ostream& stream) const {
+    // Write the same message, which the simulation used to write for the event
+
+    switch (type_) {
+        case LogEventType::MOVED:
+            stream << "Distance moved: ";
+            writeDouble(stream, values_[0]);
+            stream << "from point x: ";
+            writeDouble(stream, values_[1]);
+            stream << ", y: ";
+            writeDouble(stream, values_[2]);
+            break;
+        case LogEventType::MOVED_OUTSIDE_LAWN:
+            stream << "Attempted to move outside the lawn.";
+            break;
+        case LogEventType::ROTATED:
+            stream << "Rotated: " << static_cast<short>(values_[0]) << " degrees.";
+            break;
+        case LogEventType::INVALID_ROTATION_ANGLE:
+            stream << "Invalid angle. Rotation angle must be in [-360; 360] range.";
+            break;
+        case LogEventType::MOWING_ON:
+            stream << "Mowing mode: on";
+            break;
+        case LogEventType::MOWING_OFF:
+            stream << "Mowing mode: off";
+            break;
+        case LogEventType::POINT_NOT_FOUND:
+            stream << "Unable to find point in the lawn. Incorrect point's id " << static_cast<unsigned int>(values_[0]);
+            break;
+        case LogEventType::MOVING_TO_POINT:
+            stream << "Moving to point with id:  " << static_cast<unsigned int>(values_[0]);
+            break;
+        case LogEventType::MOVED_INTO_OBSTACLE:
+            stream << "Attempted to move into an obstacle.";
+            break;
+        case LogEventType::POINT_OUTSIDE_LAWN:
+            stream << "Unable to add point outside the lawn.";
+            break;
+        case LogEventType::POINT_NOT_DELETED:
+            stream << "Unable to delete point from lawn. Incorrect point's id: " << static_cast<unsigned int>(values_[0]);
+            break;
+        case LogEventType::POINT_ARRIVED:
+            stream << "Arrived at point with id:  " << static_cast<unsigned int>(values_[0]);
+            break;
+        case LogEventType::NO_POINTS_FOUND:
+            stream << "Unable to find the nearest point. There are no points in the lawn.";
+            break;
+        case LogEventType::ROUTE_OPTIMIZED:
+            stream << "Route through " << static_cast<unsigned int>(values_[0]) << " points: ";
+            writeDouble(stream, values_[1]);
+            stream << " s in given order, ";
+            writeDouble(stream, values_[2]);
+            stream << " s optimized, ";
+            writeDouble(stream, values_[1] - values_[2]);
+            stream << " s saved.";
+            break;
+        default:
+            stream << text_;
+    }
+}
+
+
+void LogRecord::writeDouble(ostream& stream, const double& value) {
+    // Write the number in the same format as to_string does, but without allocating a string
+
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%f", value);
+    if (length >= 0 && static_cast<size_t>(length) < sizeof(buffer)) {
+        stream.write(buffer, length);
+    } else {
+        stream << to_string(value);
+    }
+}
+
+
+void LogRecord::writeBinaryHeader(ostream& stream) {
+    stream.write(BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+}
+
+
+bool LogRecord::readBinaryHeader(istream& stream) {
+    char magic[sizeof(BINARY_LOG_MAGIC)];
+    stream.read(magic, sizeof(magic));
+    return stream.good() && memcmp(magic, BINARY_LOG_MAGIC, sizeof(magic)) == 0;
+}
+
+
+void LogRecord::writeBinary(ostream& stream) const {
+    /* Record consists of the event type, the time and the values used by the event type.
+        Text records store length of the text and the text instead of values */
+
+    uint8_t type = static_cast<uint8_t>(type_);
+    stream.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    stream.write(reinterpret_cast<const char*>(&time_), sizeof(time_));
+
+    if (isTextType(type_)) {
+        uint32_t text_length = static_cast<uint32_t>(text_.size());
+        stream.write(reinterpret_cast<const char*>(&text_length), sizeof(text_length));
+        stream.write(text_.data(), text_length);
+        return;
+    }
+    stream.write(reinterpret_cast<const char*>(values_.data()), getValuesNumber(type_) * sizeof(double));
+}
+
+
+bool LogRecord::readBinary(istream& stream) {
+    // Read next record. Returns false at the end of the log or when the record is damaged
+
+    uint8_t type;
+    if (!stream.read(reinterpret_cast<char*>(&type), sizeof(type))) return false;
+    if (type >= static_cast<uint8_t>(LogEventType::EVENT_TYPES_NUMBER)) return false;
+
+    type_ = static_cast<LogEventType>(type);
+    values_ = {0.0, 0.0, 0.0};
+    text_.clear();
+    if (!stream.read(reinterpret_cast<char*>(&time_), sizeof(time_))) return false;
+
+    if (isTextType(type_)) {
+        uint32_t text_length;
+        if (!stream.read(reinterpret_cast<char*>(&text_length), sizeof(text_length))) return false;
+        text_.resize(text_length);
+        return static_cast<bool>(stream.read(&text_[0], text_length));
+    }
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(values_.data()), 
+        getValuesNumber(type_) * sizeof(double)));
+}
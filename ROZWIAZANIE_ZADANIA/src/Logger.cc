@@ -4,25 +4,38 @@
     Implements Logger class.
 */
 
-#include <queue>
 #include "Logger.h"
 
 using namespace std;
 
 
-Logger::Logger() : logs_(queue<Log>()) {}
+Logger::Logger() : logs_(vector<Log>()) {}
 
 
-const queue<Log>& Logger::getLogs() const {
-    return std::move(logs_);
+const vector<Log>& Logger::getLogs() const {
+    return logs_;
 }
 
 
 void Logger::push(const Log& log) {
-    logs_.push(log);
+    logs_.push_back(log);
+}
+
+
+void Logger::push(Log&& log) {
+    logs_.push_back(std::move(log));
+}
+
+
+void Logger::drainInto(vector<Log>& buffer) {
+    /* Replace contents of the buffer with the collected logs. Logs left in the buffer from the previous
+        drain are removed, and the memory of the buffer is reused for the next logs */
+
+    buffer.clear();
+    logs_.swap(buffer);
 }
 
 
 void Logger::clear() {
-    logs_ = queue<Log>();
+    logs_.clear();
 }
@@ -6,12 +6,17 @@
     
     Configuration: Allows the user to define simulation constants (lawn size, mower speed, etc.).
     Custom Logic: The 'customUserLogic' function is where the user programs the mower's path.
+    Settings: Optional features (scenarios, coverage planning, fleets, logging) are switched in 'SimulationSettings'.
+    Scenarios: A scenario file (given as the first argument or in scenario_path_) defines the parameters and the path
+    without recompiling, it is used instead of 'customUserLogic'.
+    Obstacles: Trees, flower beds and other no-go zones of the lawn are added in 'customLawnObstacles'.
+    Coverage: When plan_coverage_ is set, the whole lawn is mowed in stripes planned by the CoveragePlanner.
 */
 
 #include <QApplication>
 #include <iostream>
-#include <QTimer>
 #include <cmath>
+#include <memory>
 #include "Lawn.h"
 #include "Mower.h"
 #include "Config.h"
@@ -21,6 +26,10 @@
 #include "Engine.h"
 #include "Visualizer.h"
 #include "MowerController.h"
+#include "FleetSimulation.h"
+#include "ScenarioReader.h"
+#include "CoveragePlanner.h"
+#include "Exceptions.h"
 
 using namespace std;
 
@@ -36,6 +45,20 @@ using namespace std;
     constexpr int          TARGET_FPS = 100;
     constexpr int          RENDER_INTERVAL_MS = 1000 / TARGET_FPS;
 
+// HERE THE USER CAN SWITCH OPTIONAL FEATURES OF THE SIMULATION
+struct SimulationSettings {
+    const char*   scenario_path_ = ""; // text or binary scenario used instead of customUserLogic
+    bool          plan_coverage_ = false; // mows the whole lawn in planned stripes instead of customUserLogic
+    double        coverage_overlap_ = 0.1; // part of the blade diameter mowed again by the next stripe
+    unsigned int  fleet_mowers_number_ = 1; // more than 1 simulates a fleet using customFleetLogic
+    bool          fast_forward_moves_ = false; // straight moves are simulated as single segments
+    bool          count_repeated_passes_ = false; // enables heatmap of repeated passes (H key)
+    double        simulation_timestep_s_ = 0.02; // longer steps are faster, shorter are more accurate
+    LogFileFormat log_file_format_ = LogFileFormat::TEXT; // BINARY logs are rendered by the LogFormatter tool
+    LogLevel      log_min_level_ = LogLevel::DEBUG; // ERROR saves only errors, for example moves outside the lawn
+};
+    constexpr SimulationSettings SETTINGS;
+
 
 void customUserLogic(MowerController& controller) {
     
@@ -80,47 +103,161 @@ void customUserLogic(MowerController& controller) {
 }
 
 
+// Used instead of customUserLogic when fleet_mowers_number_ is greater than 1. Mowers start next to each other
+// at the bottom of the lawn, every mower has its own controller.
+void customFleetLogic(MowerController& controller) {
+    // every mower mows its own stripe of the lawn
+    controller.setMowing(true);
+    controller.move(LAWN_LENGTH_CM - MOWER_LENGTH_CM);
+}
+
+
+// Obstacles and no-go zones are added before the simulation starts. Fields under them are never mowed,
+// and a move which would hit them stops the simulation.
+// Examples of trees and flower beds are in README.md.
+void customLawnObstacles(Lawn& lawn) {
+
+}
+
+
 // USERS SHOULD NOT HAVE TO CHANGE BELOW THIS LINE
 
+unique_ptr<FleetSimulation> createFleet(Lawn& lawn) {
+    auto fleet = make_unique<FleetSimulation>(lawn, LOG_PATH);
+    double stripe_width = static_cast<double>(LAWN_WIDTH_CM) / SETTINGS.fleet_mowers_number_;
+
+    for (unsigned int i = 0; i < SETTINGS.fleet_mowers_number_; ++i) {
+        Mower mower_template(MOWER_WIDTH_CM, MOWER_LENGTH_CM, BLADE_DIAMETER_CM, MOWER_SPEED_CM_S);
+        mower_template.setX(stripe_width * (i + 0.5));
+        mower_template.setY(MOWER_LENGTH_CM / 2.0);
+        unsigned int mower_index = fleet->addMower(mower_template);
+        customFleetLogic(fleet->getController(mower_index));
+    }
+    return fleet;
+}
+
+void planCoverage(const Lawn& lawn, const ScenarioParameters& parameters, MowerController& controller) {
+    CoveragePlan plan = CoveragePlanner(lawn, parameters.blade_diameter_, SETTINGS.coverage_overlap_)
+        .createPlan(parameters.speed_);
+    cout << "[Main] Coverage plan: " << plan.stripes_number_ << (plan.are_stripes_vertical_ ? " vertical" 
+        : " horizontal") << " stripes, " << plan.turns_number_ << " turns, predicted time " 
+        << plan.predicted_time_ << " s (without rounding steps up to 10 ms), predicted coverage " 
+        << plan.predicted_coverage_ * 100.0 << "%" << endl;
+    CoveragePlanner::emitPlan(plan, controller);
+}
+
 int main(int argc, char *argv[]) {
     QApplication app(argc, argv);
     cout << "[Main] Initializing components..." << endl;
+
+    ScenarioParameters parameters;
+    parameters.lawn_width_ = LAWN_WIDTH_CM;
+    parameters.lawn_length_ = LAWN_LENGTH_CM;
+    parameters.mower_width_ = MOWER_WIDTH_CM;
+    parameters.mower_length_ = MOWER_LENGTH_CM;
+    parameters.blade_diameter_ = BLADE_DIAMETER_CM;
+    parameters.speed_ = MOWER_SPEED_CM_S;
+    unique_ptr<ScenarioReader> scenario_reader;
+    const char* scenario_path = argc > 1 ? argv[1] : SETTINGS.scenario_path_;
+    if (scenario_path[0] != '\0') {
+        cout << "[Main] Loading scenario " << scenario_path << endl;
+        try {
+            scenario_reader = make_unique<ScenarioReader>(scenario_path);
+        } catch (const ScenarioFormatError& error) {
+            cerr << "[Main] " << error.what() << endl;
+            return 1;
+        }
+        parameters = scenario_reader->getParameters();
+    }
     
-    cout << "[Main] Creating lawn: " << LAWN_WIDTH_CM << "x" << LAWN_LENGTH_CM << " cm" << endl;
-    Lawn lawn(LAWN_WIDTH_CM, LAWN_LENGTH_CM);
+    cout << "[Main] Creating lawn: " << parameters.lawn_width_ << "x" << parameters.lawn_length_ << " cm" << endl;
+    Lawn lawn(parameters.lawn_width_, parameters.lawn_length_);
+    if (SETTINGS.count_repeated_passes_) {
+        lawn.enablePassCounting();
+    }
+    customLawnObstacles(lawn);
 
     cout << "[Main] Creating Mower" << endl;
-    Mower mower(MOWER_WIDTH_CM, MOWER_LENGTH_CM, BLADE_DIAMETER_CM, MOWER_SPEED_CM_S); 
+    if (scenario_reader) {
+        Config::initializeMowerConstants(parameters.mower_width_, parameters.mower_length_, 
+            parameters.starting_x_, parameters.starting_y_, parameters.starting_angle_);
+    }
+    Mower mower(parameters.mower_width_, parameters.mower_length_, parameters.blade_diameter_, parameters.speed_); 
     
     cout << "[Main] Creating Loggers" << endl;
     Logger logger; 
-    FileLogger fileLogger(LOG_PATH);
+    FileLogger fileLogger(LOG_PATH, SETTINGS.log_file_format_);
+    fileLogger.getFilter().setMinLevel(SETTINGS.log_min_level_);
+    fileLogger.enableAsyncWriting();
     
     cout << "[Main] Creating StateSimulation" << endl;
     StateSimulation simulation(lawn, mower, logger, fileLogger);
     
     cout << "[Main] Setting up MowerController and user logic" << endl;
     MowerController controller;
-    customUserLogic(controller);
+    unique_ptr<FleetSimulation> fleet;
+    if (scenario_reader) {
+        // commands are read in batches while the simulation runs
+        scenario_reader->feedController(controller);
+    } else if (SETTINGS.fleet_mowers_number_ > 1) {
+        cout << "[Main] Creating fleet of " << SETTINGS.fleet_mowers_number_ << " mowers" << endl;
+        fleet = createFleet(lawn);
+    } else if (SETTINGS.plan_coverage_) {
+        planCoverage(lawn, parameters, controller);
+    } else {
+        customUserLogic(controller);
+    }
 
     cout << "[Main] Initializing Engine" << endl;
-    Engine engine(simulation, 
-        [&controller](StateSimulation& sim, double dt) {
-            controller.update(sim, dt);
+    Engine engine(fleet ? fleet->getSimulation(0) : simulation, 
+        [&controller, &fleet, &scenario_reader](StateSimulation& sim, double dt) {
+            if (fleet) {
+                fleet->update(dt);
+            } else {
+                controller.update(sim, dt);
+                if (scenario_reader) {
+                    scenario_reader->feedController(controller);
+                }
+            }
         }, 
         [&app](const string& error) {
             QMetaObject::invokeMethod(&app, "quit", Qt::QueuedConnection);
-        }
+        },
+        SETTINGS.simulation_timestep_s_
     ); 
     engine.setSimulationSpeed(SIMULATION_SPEED_MULTIPLIER);
+    if (SETTINGS.fast_forward_moves_ && !fleet) {
+        simulation.setFastForward(true);
+        simulation.setSnapshotCallback([&engine](const SimulationSnapshot& sim_snapshot) {
+            engine.getStateInterpolator().addSimulationSnapshot(sim_snapshot);
+        });
+    }
+    if (fleet) {
+        engine.setSnapshotProvider([&fleet]() {
+            return fleet->buildSimulationSnapshot();
+        });
+        engine.setCommandQueueDepthProvider([&fleet]() {
+            return fleet->getQueueSize();
+        });
+        for (unsigned int i = 0; i < fleet->getMowersNumber(); ++i) {
+            fleet->getController(i).setCommandAddedCallback([&engine]() {
+                engine.wakeUp();
+            });
+        }
+    } else {
+        engine.setCommandQueueDepthProvider([&controller]() {
+            return controller.getQueueSize();
+        });
+        controller.setCommandAddedCallback([&engine]() {
+            engine.wakeUp();
+        });
+    }
     
     cout << "[Main] Creating window" << endl;
     Visualizer visualizer(engine.getStateInterpolator()); 
     visualizer.setWindowTitle("Lawn Mower Simulator");    
-
-    QTimer renderTimer;
-    QObject::connect(&renderTimer, &QTimer::timeout, &visualizer, QOverload<>::of(&Visualizer::update));
-    renderTimer.start(RENDER_INTERVAL_MS);
+    visualizer.setFrameInterval(RENDER_INTERVAL_MS);
+    visualizer.setPerformanceMetrics(&engine.getPerformanceMetrics());
     visualizer.show();
     engine.start();
     
@@ -129,5 +266,9 @@ int main(int argc, char *argv[]) {
     
     cout << "[Main] Stopping simulation" << endl;
     engine.stop();
+    cout << "[Main] Mowed area: " << lawn.calculateShavedArea() * 100.0 << "%" << endl;
+    if (lawn.isPassCountingEnabled()) {
+        cout << "[Main] Overlap ratio: " << lawn.calculateOverlapRatio() * 100.0 << "% of mowing was repeated" << endl;
+    }
     return result;
 }
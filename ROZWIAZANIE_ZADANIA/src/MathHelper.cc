@@ -25,6 +25,26 @@ double MathHelper::convertRadiansToDegrees(const double& angle) {
 }
 
 
+double MathHelper::convertFractionalDegreesToRadians(const double& angle) {
+    // Convert angles, which are not whole degrees, for example headings along curves
+
+    double RADIAN_FACTOR = 180.0;
+    return angle * Constants::PI / RADIAN_FACTOR;
+}
+
+
+double MathHelper::normalizeAngle(const double& angle) {
+    // Bring the angle to [0; 360) range
+
+    double FULL_ANGLE = 360.0;
+    double normalized_angle = fmod(angle, FULL_ANGLE);
+    if (normalized_angle < 0.0) {
+        normalized_angle += FULL_ANGLE;
+    }
+    return normalized_angle >= FULL_ANGLE ? 0.0 : normalized_angle;
+}
+
+
 double MathHelper::calculateAParameter(const unsigned short& angle) {
     // Calculate 'a' parameter for linear function
 
@@ -107,6 +107,70 @@ void Mower::move(const double& distance, const unsigned int& lawn_width, const u
 }
 
 
+void Mower::moveToPose(const double& x, const double& y, const unsigned short& angle, 
+    const unsigned int& lawn_width, const unsigned int& lawn_length) {
+    /* Place the mower in the given point with the given angle. Used by curved moves, which calculate
+        the point on the curve themselves. Throws MoveOutsideLawnError when the point is outside the lawn */
+
+    if (!calculateIfXAccessible(x, lawn_width) || !calculateIfYAccessible(y, lawn_length)) {
+        throw MoveOutsideLawnError("Attempted to move outside the lawn.");
+    }
+    setX(x);
+    setY(y);
+    setAngle(angle);
+}
+
+
+void Mower::move(const double& distance, const Lawn& lawn) {
+    /* Move the mower on the lawn with obstacles. Throws MoveOutsideLawnError when destination point is outside
+        the lawn and ObstacleCollisionError when the mower would hit an obstacle on its way */
+
+    pair<double, double> final_point = calculateFinalPoint(distance);
+    if (!calculateIfXAccessible(final_point.first, lawn.getWidth()) || 
+        !calculateIfYAccessible(final_point.second, lawn.getLength())) {
+        throw MoveOutsideLawnError("Attempted to move outside the lawn.");
+    }
+    checkObstacleCollision(final_point, lawn);
+    setX(final_point.first);
+    setY(final_point.second);
+}
+
+
+void Mower::moveToPose(const double& x, const double& y, const unsigned short& angle, const Lawn& lawn) {
+    /* Place the mower in the given point on the lawn with obstacles. The way to the point is checked as 
+        a straight line, curved moves are split into short parts by the simulation */
+
+    if (!calculateIfXAccessible(x, lawn.getWidth()) || !calculateIfYAccessible(y, lawn.getLength())) {
+        throw MoveOutsideLawnError("Attempted to move outside the lawn.");
+    }
+    checkObstacleCollision(pair<double, double>(x, y), lawn);
+    setX(x);
+    setY(y);
+    setAngle(angle);
+}
+
+
+bool Mower::isPointAccessible(const double& x, const double& y, const Lawn& lawn) const {
+    // Check if the mower can stand in the given point of the lawn
+
+    return calculateIfXAccessible(x, lawn.getWidth()) && calculateIfYAccessible(y, lawn.getLength());
+}
+
+
+void Mower::checkObstacleCollision(const pair<double, double>& final_point, const Lawn& lawn) const {
+    // Throw ObstacleCollisionError when the way from the current point to the final point is blocked
+
+    double DIAMETER_TO_RADIUS_FACTOR = 2.0;
+    const ObstacleMap& obstacle_map = lawn.getObstacleMap();
+    if (obstacle_map.isEmpty()) return;
+
+    pair<double, double> current_point = pair<double, double>(getX(), getY());
+    if (obstacle_map.isSegmentBlocked(current_point, final_point, blade_diameter_ / DIAMETER_TO_RADIUS_FACTOR)) {
+        throw ObstacleCollisionError("Attempted to move into an obstacle.");
+    }
+}
+
+
 pair<double, double> Mower::calculateFinalPoint(const double& distance) const {
     // Calculate final point for mower movement
 
@@ -3,61 +3,171 @@
     Implementation of MowerController class.
 */
 
+#include <cmath>
 #include "MowerController.h"
+#include "commands/MoveToNearestPointCommand.h"
+#include "commands/VisitPointsCommand.h"
 
-// Executes the front command in the queue. Commands run over multiple frames
+// Executes commands from the front of the queue. Commands run over multiple frames
 // until they return true (finished). Only then does the queue move to the next command.
 // This ensures commands execute in order without overlapping.
+// Instantaneous commands do not use any time, so all of them at the front of the queue are executed
+// in one step. When a command finishes before the end of the step, the unused time is passed to the next command.
+// The queue stays locked for the whole step, so commands pushed by other threads wait until it ends.
+// A command which takes time begins a new pass of the blade before it is executed for the first time.
 void MowerController::update(StateSimulation& sim, double dt) {
-    if (command_queue_.empty()) {
-        return;
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    double time_left = dt;
+    while (!command_queue_.isEmpty()) {
+        if (command_queue_.isFrontInstantaneous()) {
+            command_queue_.executeFront(sim, 0.0);
+            command_queue_.popFront();
+            continue;
+        }
+        if (time_left <= MIN_COMMAND_TIME) {
+            return;
+        }
+        if (!is_front_started_) {
+            sim.beginPass();
+            is_front_started_ = true;
+        }
+        if (!executeFrontCommand(sim, time_left)) {
+            return;
+        }
+        command_queue_.popFront();
+        is_front_started_ = false;
     }
+}
+
+// When the step is longer than the command allows, it is split into equal substeps,
+// so the result depends only on the step length and not on the timing of the frames.
+// Returns true when the command is finished, time_left is then set to the time not used by the command.
+bool MowerController::executeFrontCommand(StateSimulation& sim, double& time_left) {
+    int substeps_number = calculateSubstepsNumber(command_queue_.getFrontMaxTimestep(sim), time_left);
+    double substep = time_left / substeps_number;
 
-    if (command_queue_.front()->execute(sim, dt)) {
-        command_queue_.pop();
+    for (int i = 0; i < substeps_number; ++i) {
+        if (command_queue_.executeFront(sim, substep)) {
+            time_left = substep * (substeps_number - i - 1) + command_queue_.getFrontUnusedTime();
+            return true;
+        }
     }
+    return false;
+}
+
+int MowerController::calculateSubstepsNumber(double max_timestep, double dt) {
+    if (max_timestep <= 0.0 || dt <= max_timestep) {
+        return 1;
+    }
+    return static_cast<int>(std::ceil(dt / max_timestep - SUBSTEP_TOLERANCE));
 }
 
 void MowerController::move(double cm) {
-    command_queue_.push(std::make_unique<MoveCommand>(cm));
+    pushCommand<MoveCommand>(cm);
 }
 
 void MowerController::move(const double* distance_ptr, double scale) {
-    command_queue_.push(std::make_unique<MoveCommand>(distance_ptr, scale));
+    pushCommand<MoveCommand>(distance_ptr, scale);
 }
 
 void MowerController::rotate(short deg) {
-    command_queue_.push(std::make_unique<RotateCommand>(deg));
+    pushCommand<RotateCommand>(deg);
+}
+
+// Positive angles turn right, e.g. moveAlongArc(100, 360) drives a full circle of radius 1 m.
+void MowerController::moveAlongArc(double radius, double angle) {
+    pushCommand<ArcCommand>(radius, angle);
+}
+
+void MowerController::moveAlongPolyline(std::vector<std::pair<double, double>> points) {
+    pushCommand<PolylineCommand>(std::move(points));
+}
+
+void MowerController::moveAlongSpline(std::vector<std::pair<double, double>> points) {
+    pushCommand<SplineCommand>(std::move(points));
 }
 
 void MowerController::setMowing(bool enable) {
-    command_queue_.push(std::make_unique<MowingOptionCommand>(enable));
+    pushCommand<MowingOptionCommand>(enable);
 }
 
 void MowerController::addPoint(double x, double y) {
-    command_queue_.push(std::make_unique<AddPointCommand>(x, y));
+    pushCommand<AddPointCommand>(x, y);
 }
 
 void MowerController::deletePoint(unsigned int id) {
-    command_queue_.push(std::make_unique<DeletePointCommand>(id));
+    pushCommand<DeletePointCommand>(id);
 }
 
 void MowerController::moveToPoint(unsigned int point_id) {
-    command_queue_.push(std::make_unique<MoveToPointCommand>(point_id));
+    pushCommand<MoveToPointCommand>(point_id);
+}
+
+// With delete_point_on_arrival the visited point is deleted, so repeating the command visits all points,
+// always going to the nearest unvisited one.
+void MowerController::moveToNearestPoint(bool delete_point_on_arrival) {
+    addCommand(std::make_unique<MoveToNearestPointCommand>(delete_point_on_arrival));
+}
+
+// Scripts visiting many points push moveToPoint for each of them and then call optimizeRoute. The moves
+// at the end of the queue are replaced with one command, which orders the points into a shorter route
+// and logs the predicted saving when it starts. The time budget (s) limits improving the route.
+void MowerController::optimizeRoute(double time_budget) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        std::vector<unsigned int> point_ids = command_queue_.takePendingPointMoves();
+        if (point_ids.empty()) {
+            return;
+        }
+        command_queue_.push(std::make_unique<VisitPointsCommand>(std::move(point_ids), time_budget));
+    }
+    notifyCommandAdded();
 }
 
 void MowerController::getDistanceToPoint(unsigned int point_id, double& out_distance) {
-    command_queue_.push(std::make_unique<GetDistanceToPointCommand>(point_id, out_distance));
+    pushCommand<GetDistanceToPointCommand>(point_id, out_distance);
 }
 
 void MowerController::rotateTowardsPoint(unsigned int point_id) {
-    command_queue_.push(std::make_unique<RotateTowardsPointCommand>(point_id));
+    pushCommand<RotateTowardsPointCommand>(point_id);
 }
 
 void MowerController::getCurrentAngle(unsigned short& out_angle) {
-    command_queue_.push(std::make_unique<GetCurrentAngleCommand>(out_angle));
+    pushCommand<GetCurrentAngleCommand>(out_angle);
 }
 
 void MowerController::getCurrentPosition(double& out_x, double& out_y) {
-    command_queue_.push(std::make_unique<GetCurrentPositionCommand>(out_x, out_y));
+    pushCommand<GetCurrentPositionCommand>(out_x, out_y);
+}
+
+void MowerController::addCommand(std::unique_ptr<ICommand> command) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        command_queue_.push(std::move(command));
+    }
+    notifyCommandAdded();
+}
+
+// Useful before pushing a long generated script, e.g. drawing a circle with hundreds of moves.
+void MowerController::reserveCommands(size_t commands_number) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    command_queue_.reserve(commands_number);
+}
+
+size_t MowerController::getQueueSize() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return command_queue_.getSize();
+}
+
+// The callback lets the Engine know that there is new work, so it does not wait
+// for the next step when it was idle. It is called after the queue is unlocked and should be set
+// before the Engine starts.
+void MowerController::setCommandAddedCallback(std::function<void()> callback) {
+    command_added_callback_ = callback;
+}
+
+void MowerController::notifyCommandAdded() {
+    if (command_added_callback_) {
+        command_added_callback_();
+    }
 }
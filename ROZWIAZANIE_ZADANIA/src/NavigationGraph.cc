@@ -0,0 +1,426 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of NavigationGraph class.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include "NavigationGraph.h"
+#include "ObstacleMap.h"
+
+using namespace std;
+
+namespace {
+    constexpr double EDGE_MARGIN = NavigationGraph::NAVIGATION_MARGIN / 2.0;
+    constexpr double MIN_BISECTOR_COSINE = 0.25; // limits the offset of nodes at very sharp vertices
+    constexpr unsigned int NO_NODE = numeric_limits<unsigned int>::max();
+    constexpr double PI = 3.14159265358979323846;
+
+    bool areAreasOverlapping(const pair<double, double>& first_left_down, const pair<double, double>& first_right_up,
+        const pair<double, double>& second_left_down, const pair<double, double>& second_right_up) {
+        return first_left_down.first <= second_right_up.first && second_left_down.first <= first_right_up.first &&
+            first_left_down.second <= second_right_up.second && second_left_down.second <= first_right_up.second;
+    }
+}
+
+// Clearance is the distance kept from physical obstacles, usually the radius of the blade.
+NavigationGraph::NavigationGraph(const ObstacleMap& obstacle_map, unsigned int lawn_width, unsigned int lawn_length,
+    double clearance)
+    : obstacle_map_(obstacle_map), lawn_width_(lawn_width), lawn_length_(lawn_length), clearance_(clearance) {
+    update();
+}
+
+// Brings the graph up to date with obstacles added to the map since the last update. Nodes and cached edges
+// are changed only near the new obstacles.
+void NavigationGraph::update() {
+    const vector<Obstacle>& obstacles = obstacle_map_.getObstacles();
+    if (known_obstacles_number_ == obstacles.size()) {
+        return;
+    }
+
+    double range = clearance_ + NAVIGATION_MARGIN;
+    vector<pair<pair<double, double>, pair<double, double>>> changed_areas;
+    for (size_t i = known_obstacles_number_; i < obstacles.size(); i ++) {
+        pair<double, double> left_down_corner(obstacles[i].left_down_corner_.first - range,
+            obstacles[i].left_down_corner_.second - range);
+        pair<double, double> right_up_corner(obstacles[i].right_up_corner_.first + range,
+            obstacles[i].right_up_corner_.second + range);
+        refreshNodesNear(left_down_corner, right_up_corner);
+        changed_areas.emplace_back(left_down_corner, right_up_corner);
+    }
+    removeEdgesNear(changed_areas);
+
+    for (size_t i = known_obstacles_number_; i < obstacles.size(); i ++) {
+        addCornerNodes(obstacles[i]);
+    }
+    known_obstacles_number_ = obstacles.size();
+}
+
+// Points are goals of the paths. Indexes of deleted points are used again by next points.
+void NavigationGraph::addPoint(unsigned int point_id, const pair<double, double>& position) {
+    removePoint(point_id);
+
+    Node node;
+    node.position_ = position;
+    node.type_ = NodeType::POINT;
+    node.is_active_ = isNodeAccessible(node);
+
+    unsigned int node_index;
+    if (free_point_nodes_.empty()) {
+        node_index = static_cast<unsigned int>(nodes_.size());
+        nodes_.push_back(node);
+    }
+    else {
+        node_index = free_point_nodes_.back();
+        free_point_nodes_.pop_back();
+        nodes_[node_index] = node;
+    }
+    point_nodes_[point_id] = node_index;
+}
+
+void NavigationGraph::removePoint(unsigned int point_id) {
+    auto iterator = point_nodes_.find(point_id);
+    if (iterator == point_nodes_.end()) {
+        return;
+    }
+
+    unsigned int node_index = iterator->second;
+    removeEdgesOfNode(node_index);
+    nodes_[node_index].is_active_ = false;
+    free_point_nodes_.push_back(node_index);
+    point_nodes_.erase(iterator);
+}
+
+// Returns corners of the shortest path from start to goal, without the start and ending with the goal.
+// Returns an empty path when obstacles separate the goal from the start.
+vector<pair<double, double>> NavigationGraph::findPath(const pair<double, double>& start,
+    const pair<double, double>& goal) {
+    update();
+
+    Node goal_node;
+    goal_node.position_ = goal;
+    goal_node.type_ = NodeType::TEMPORARY;
+    goal_node.is_active_ = isNodeAccessible(goal_node);
+    if (!goal_node.is_active_) {
+        return {};
+    }
+
+    Node start_node;
+    start_node.position_ = start;
+    start_node.type_ = NodeType::TEMPORARY;
+    nodes_.push_back(start_node);
+    nodes_.push_back(goal_node);
+    unsigned int goal_index = static_cast<unsigned int>(nodes_.size() - 1);
+
+    vector<pair<double, double>> path = searchPath(goal_index - 1, goal_index);
+    nodes_.pop_back();
+    nodes_.pop_back();
+    return path;
+}
+
+// The same as findPath, but edges going to the point stay cached for the next paths to it.
+vector<pair<double, double>> NavigationGraph::findPathToPoint(const pair<double, double>& start,
+    unsigned int point_id) {
+    update();
+
+    auto iterator = point_nodes_.find(point_id);
+    if (iterator == point_nodes_.end() || !nodes_[iterator->second].is_active_) {
+        return {};
+    }
+
+    Node start_node;
+    start_node.position_ = start;
+    start_node.type_ = NodeType::TEMPORARY;
+    nodes_.push_back(start_node);
+
+    vector<pair<double, double>> path = searchPath(static_cast<unsigned int>(nodes_.size() - 1), iterator->second);
+    nodes_.pop_back();
+    return path;
+}
+
+size_t NavigationGraph::getActiveNodesNumber() const {
+    return static_cast<size_t>(count_if(nodes_.begin(), nodes_.end(),
+        [](const Node& node) { return node.is_active_; }));
+}
+
+size_t NavigationGraph::getCachedEdgesNumber() const {
+    return visibility_cache_.size();
+}
+
+// Corner nodes keep the clearance and the navigation margin from their obstacle.
+void NavigationGraph::addCornerNodes(const Obstacle& obstacle) {
+    double distance = (obstacle.type_ == ObstacleType::OBSTACLE ? clearance_ : 0.0) + NAVIGATION_MARGIN;
+
+    if (obstacle.shape_ == ObstacleShape::CIRCLE) {
+        addCircleNodes(obstacle, distance);
+    }
+    else {
+        addPolygonNodes(obstacle, distance);
+    }
+}
+
+// Nodes are corners of a regular polygon circumscribed about the circle enlarged by the distance, so edges
+// between neighbouring nodes do not come closer to the circle than the distance.
+void NavigationGraph::addCircleNodes(const Obstacle& obstacle, double distance) {
+    double step = 2.0 * PI / CIRCLE_NODES_NUMBER;
+    double nodes_radius = (obstacle.radius_ + distance) / cos(step / 2.0);
+
+    for (unsigned int i = 0; i < CIRCLE_NODES_NUMBER; i ++) {
+        double angle = step * i;
+        addCornerNode(pair<double, double>(obstacle.middle_.first + nodes_radius * cos(angle),
+            obstacle.middle_.second + nodes_radius * sin(angle)));
+    }
+}
+
+// Only convex vertices get nodes, the shortest paths never bend at concave ones. A node lies on the bisector
+// of the outer angle, so edges parallel to the sides of the polygon keep the distance from them.
+void NavigationGraph::addPolygonNodes(const Obstacle& obstacle, double distance) {
+    const vector<pair<double, double>>& vertices = obstacle.vertices_;
+    size_t vertices_number = vertices.size();
+
+    double doubled_area = 0.0;
+    for (size_t i = 0; i < vertices_number; i ++) {
+        const pair<double, double>& next = vertices[(i + 1) % vertices_number];
+        doubled_area += vertices[i].first * next.second - next.first * vertices[i].second;
+    }
+    double orientation = doubled_area > 0.0 ? 1.0 : -1.0; // 1 for counterclockwise vertices
+
+    for (size_t i = 0; i < vertices_number; i ++) {
+        const pair<double, double>& previous = vertices[(i + vertices_number - 1) % vertices_number];
+        const pair<double, double>& vertex = vertices[i];
+        const pair<double, double>& next = vertices[(i + 1) % vertices_number];
+
+        double first_dx = vertex.first - previous.first;
+        double first_dy = vertex.second - previous.second;
+        double second_dx = next.first - vertex.first;
+        double second_dy = next.second - vertex.second;
+        double first_length = hypot(first_dx, first_dy);
+        double second_length = hypot(second_dx, second_dy);
+        double cross_product = first_dx * second_dy - first_dy * second_dx;
+        if (first_length == 0.0 || second_length == 0.0 || cross_product * orientation <= 0.0) {
+            continue;
+        }
+
+        // outer normals of both sides
+        double first_normal_x = orientation * first_dy / first_length;
+        double first_normal_y = -orientation * first_dx / first_length;
+        double second_normal_x = orientation * second_dy / second_length;
+        double second_normal_y = -orientation * second_dx / second_length;
+
+        double bisector_x = first_normal_x + second_normal_x;
+        double bisector_y = first_normal_y + second_normal_y;
+        double bisector_length = hypot(bisector_x, bisector_y);
+        bisector_x /= bisector_length;
+        bisector_y /= bisector_length;
+
+        double bisector_cosine = max(MIN_BISECTOR_COSINE, bisector_x * first_normal_x + bisector_y * first_normal_y);
+        double offset = distance / bisector_cosine;
+        addCornerNode(pair<double, double>(vertex.first + bisector_x * offset, vertex.second + bisector_y * offset));
+    }
+}
+
+void NavigationGraph::addCornerNode(const pair<double, double>& position) {
+    Node node;
+    node.position_ = position;
+    node.type_ = NodeType::CORNER;
+    node.is_active_ = isNodeAccessible(node);
+
+    corner_nodes_.push_back(static_cast<unsigned int>(nodes_.size()));
+    nodes_.push_back(node);
+}
+
+// Switches off nodes covered by a new obstacle. Nodes switched off once never come back, as obstacles
+// are never removed.
+void NavigationGraph::refreshNodesNear(const pair<double, double>& left_down_corner,
+    const pair<double, double>& right_up_corner) {
+    for (Node& node : nodes_) {
+        if (node.is_active_ && areAreasOverlapping(node.position_, node.position_, left_down_corner,
+            right_up_corner)) {
+            node.is_active_ = isNodeAccessible(node);
+        }
+    }
+}
+
+// Removes cached visible edges which pass through any of the areas. Blocked edges stay blocked.
+void NavigationGraph::removeEdgesNear(const vector<pair<pair<double, double>, pair<double, double>>>& areas) {
+    for (auto iterator = visibility_cache_.begin(); iterator != visibility_cache_.end(); ) {
+        bool is_changed = false;
+        if (iterator->second) {
+            const pair<double, double>& first = nodes_[static_cast<unsigned int>(iterator->first >> 32)].position_;
+            const pair<double, double>& second = nodes_[static_cast<unsigned int>(iterator->first)].position_;
+            pair<double, double> left_down_corner(min(first.first, second.first), min(first.second, second.second));
+            pair<double, double> right_up_corner(max(first.first, second.first), max(first.second, second.second));
+            for (const auto& area : areas) {
+                if (areAreasOverlapping(left_down_corner, right_up_corner, area.first, area.second)) {
+                    is_changed = true;
+                    break;
+                }
+            }
+        }
+
+        if (is_changed) {
+            iterator = visibility_cache_.erase(iterator);
+        }
+        else {
+            ++iterator;
+        }
+    }
+}
+
+// Points remember ends of their cached edges, so deleting a point does not scan the whole cache.
+void NavigationGraph::removeEdgesOfNode(unsigned int node_index) {
+    for (unsigned int neighbour_index : nodes_[node_index].cached_neighbours_) {
+        visibility_cache_.erase(calculateEdgeKey(node_index, neighbour_index));
+    }
+    nodes_[node_index].cached_neighbours_.clear();
+}
+
+// The middle of the mower has to stay on the lawn. Corner nodes also keep the margin from other obstacles.
+bool NavigationGraph::isNodeAccessible(const Node& node) const {
+    const pair<double, double>& position = node.position_;
+    if (position.first < 0.0 || position.first > lawn_width_ || position.second < 0.0 ||
+        position.second > lawn_length_) {
+        return false;
+    }
+
+    double margin = node.type_ == NodeType::CORNER ? EDGE_MARGIN : 0.0;
+    return !obstacle_map_.isSegmentBlocked(position, position, clearance_, margin);
+}
+
+// Edges of the start and of the goal of a single search are checked every time, other edges are cached.
+bool NavigationGraph::isVisible(unsigned int first_index, unsigned int second_index) {
+    const Node& first = nodes_[first_index];
+    const Node& second = nodes_[second_index];
+    bool is_cacheable = first.type_ != NodeType::TEMPORARY && second.type_ != NodeType::TEMPORARY;
+
+    uint64_t key = calculateEdgeKey(first_index, second_index);
+    if (is_cacheable) {
+        auto iterator = visibility_cache_.find(key);
+        if (iterator != visibility_cache_.end()) {
+            return iterator->second;
+        }
+    }
+
+    bool are_corners = first.type_ == NodeType::CORNER && second.type_ == NodeType::CORNER;
+    double margin = are_corners ? EDGE_MARGIN : 0.0;
+    bool is_visible = !obstacle_map_.isSegmentBlocked(first.position_, second.position_, clearance_, margin);
+    if (is_cacheable) {
+        visibility_cache_.emplace(key, is_visible);
+        if (first.type_ == NodeType::POINT) {
+            nodes_[first_index].cached_neighbours_.push_back(second_index);
+        }
+        if (second.type_ == NodeType::POINT) {
+            nodes_[second_index].cached_neighbours_.push_back(first_index);
+        }
+    }
+    return is_visible;
+}
+
+// Lazy A* search over corner nodes. Neighbours of a node are all other nodes, so the edge to a neighbour is not
+// checked when the node is expanded, only when the neighbour is taken from the queue. When this edge is blocked,
+// the neighbour gets the shortest visible way from already closed nodes and goes back to the queue. This way
+// only edges which can be a part of the shortest path are checked. The straight way to the goal is the first one
+// taken from the queue, so a free straight way is found with a single check.
+vector<pair<double, double>> NavigationGraph::searchPath(unsigned int start_index, unsigned int goal_index) {
+    typedef tuple<double, double, unsigned int> QueueEntry; // estimated length of the path, length, node index
+
+    size_t nodes_number = nodes_.size();
+    vector<double> lengths(nodes_number, numeric_limits<double>::infinity());
+    vector<unsigned int> previous_nodes(nodes_number, NO_NODE);
+    vector<bool> is_checked(nodes_number, false); // the edge from the previous node is visible
+    vector<bool> is_closed(nodes_number, false);
+    vector<unsigned int> closed_nodes;
+    priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> queue;
+
+    lengths[start_index] = 0.0;
+    is_checked[start_index] = true;
+    queue.emplace(calculateDistance(start_index, goal_index), 0.0, start_index);
+
+    auto visit = [&](unsigned int current_index, unsigned int next_index) {
+        if (is_closed[next_index] || !nodes_[next_index].is_active_) {
+            return;
+        }
+        double length = lengths[current_index] + calculateDistance(current_index, next_index);
+        if (length >= lengths[next_index]) {
+            return;
+        }
+        lengths[next_index] = length;
+        previous_nodes[next_index] = current_index;
+        is_checked[next_index] = false;
+        queue.emplace(length + calculateDistance(next_index, goal_index), length, next_index);
+    };
+
+    auto findVisibleClosedNode = [&](unsigned int node_index) {
+        vector<pair<double, unsigned int>> ways; // length of the way through the closed node, closed node index
+        ways.reserve(closed_nodes.size());
+        for (unsigned int closed_index : closed_nodes) {
+            ways.emplace_back(lengths[closed_index] + calculateDistance(closed_index, node_index), closed_index);
+        }
+        sort(ways.begin(), ways.end());
+
+        lengths[node_index] = numeric_limits<double>::infinity();
+        previous_nodes[node_index] = NO_NODE;
+        for (const pair<double, unsigned int>& way : ways) {
+            if (isVisible(way.second, node_index)) {
+                lengths[node_index] = way.first;
+                previous_nodes[node_index] = way.second;
+                is_checked[node_index] = true;
+                queue.emplace(way.first + calculateDistance(node_index, goal_index), way.first, node_index);
+                return;
+            }
+        }
+    };
+
+    while (!queue.empty()) {
+        unsigned int current_index = get<2>(queue.top());
+        double length = get<1>(queue.top());
+        queue.pop();
+        if (is_closed[current_index] || length != lengths[current_index]) {
+            continue;
+        }
+        if (!is_checked[current_index]) {
+            if (isVisible(previous_nodes[current_index], current_index)) {
+                is_checked[current_index] = true;
+            }
+            else {
+                findVisibleClosedNode(current_index);
+                continue;
+            }
+        }
+        if (current_index == goal_index) {
+            break;
+        }
+        is_closed[current_index] = true;
+        closed_nodes.push_back(current_index);
+
+        visit(current_index, goal_index);
+        for (unsigned int corner_index : corner_nodes_) {
+            visit(current_index, corner_index);
+        }
+    }
+
+    vector<pair<double, double>> path;
+    if (!is_checked[goal_index] || previous_nodes[goal_index] == NO_NODE) {
+        return path;
+    }
+    for (unsigned int node_index = goal_index; node_index != start_index; node_index = previous_nodes[node_index]) {
+        path.push_back(nodes_[node_index].position_);
+    }
+    reverse(path.begin(), path.end());
+    return path;
+}
+
+double NavigationGraph::calculateDistance(unsigned int first_index, unsigned int second_index) const {
+    return hypot(nodes_[first_index].position_.first - nodes_[second_index].position_.first,
+        nodes_[first_index].position_.second - nodes_[second_index].position_.second);
+}
+
+uint64_t NavigationGraph::calculateEdgeKey(unsigned int first_index, unsigned int second_index) {
+    uint64_t lower_index = min(first_index, second_index);
+    uint64_t higher_index = max(first_index, second_index);
+    return (lower_index << 32) | higher_index;
+}
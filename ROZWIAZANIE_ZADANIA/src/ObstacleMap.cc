@@ -0,0 +1,323 @@
+/*
+    Author: Maciej Cieslik
+
+    Implements ObstacleMap class.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "ObstacleMap.h"
+#include "Exceptions.h"
+
+using namespace std;
+
+
+ObstacleMap::ObstacleMap(const unsigned int& lawn_width, const unsigned int& lawn_length)
+    : width_(lawn_width), length_(lawn_length) {
+    /* Buckets are at least MIN_BUCKET_SIZE wide. On big lawns they are wider, so the number of buckets
+        does not grow over MAX_BUCKETS_PER_SIDE in each direction */
+
+    double longer_side = static_cast<double>(max(width_, length_));
+    bucket_size_ = max(MIN_BUCKET_SIZE, longer_side / MAX_BUCKETS_PER_SIDE);
+    columns_number_ = max(1u, static_cast<unsigned int>(ceil(width_ / bucket_size_)));
+    rows_number_ = max(1u, static_cast<unsigned int>(ceil(length_ / bucket_size_)));
+    buckets_.resize(static_cast<size_t>(columns_number_) * rows_number_);
+}
+
+
+const vector<Obstacle>& ObstacleMap::getObstacles() const {
+    return obstacles_;
+}
+
+
+bool ObstacleMap::isEmpty() const {
+    return obstacles_.empty();
+}
+
+
+double ObstacleMap::getBucketSize() const {
+    return bucket_size_;
+}
+
+
+unsigned int ObstacleMap::addCircle(const pair<double, double>& middle, const double& radius,
+    const ObstacleType& type) {
+    // Add circular obstacle and return its index. Throws InvalidObstacleError when the radius is not positive
+
+    if (!(radius > 0.0) || !isfinite(radius)) {
+        throw InvalidObstacleError("Radius of an obstacle must be greater than 0.");
+    }
+
+    Obstacle obstacle;
+    obstacle.type_ = type;
+    obstacle.shape_ = ObstacleShape::CIRCLE;
+    obstacle.middle_ = middle;
+    obstacle.radius_ = radius;
+    obstacle.left_down_corner_ = pair<double, double>(middle.first - radius, middle.second - radius);
+    obstacle.right_up_corner_ = pair<double, double>(middle.first + radius, middle.second + radius);
+    return addObstacle(obstacle);
+}
+
+
+unsigned int ObstacleMap::addPolygon(const vector<pair<double, double>>& vertices, const ObstacleType& type) {
+    /* Add polygonal obstacle and return its index. Vertices can be given clockwise or counterclockwise,
+        the last vertex is connected with the first one. Throws InvalidObstacleError for less than 3 vertices */
+
+    size_t MIN_VERTICES_NUMBER = 3;
+    if (vertices.size() < MIN_VERTICES_NUMBER) {
+        throw InvalidObstacleError("Polygonal obstacle must have at least 3 vertices.");
+    }
+
+    Obstacle obstacle;
+    obstacle.type_ = type;
+    obstacle.shape_ = ObstacleShape::POLYGON;
+    obstacle.vertices_ = vertices;
+    obstacle.left_down_corner_ = vertices[0];
+    obstacle.right_up_corner_ = vertices[0];
+    for (const pair<double, double>& vertex : vertices) {
+        obstacle.left_down_corner_.first = min(obstacle.left_down_corner_.first, vertex.first);
+        obstacle.left_down_corner_.second = min(obstacle.left_down_corner_.second, vertex.second);
+        obstacle.right_up_corner_.first = max(obstacle.right_up_corner_.first, vertex.first);
+        obstacle.right_up_corner_.second = max(obstacle.right_up_corner_.second, vertex.second);
+    }
+    return addObstacle(obstacle);
+}
+
+
+unsigned int ObstacleMap::addObstacle(Obstacle& obstacle) {
+    // Store the obstacle and put its index into all buckets overlapped by its bounding box
+
+    unsigned int obstacle_index = static_cast<unsigned int>(obstacles_.size());
+    pair<unsigned int, unsigned int> first_bucket = calculateBucketIndexes(obstacle.left_down_corner_.first,
+        obstacle.left_down_corner_.second);
+    pair<unsigned int, unsigned int> last_bucket = calculateBucketIndexes(obstacle.right_up_corner_.first,
+        obstacle.right_up_corner_.second);
+
+    for (unsigned int row = first_bucket.second; row <= last_bucket.second; row ++) {
+        for (unsigned int col = first_bucket.first; col <= last_bucket.first; col ++) {
+            buckets_[static_cast<size_t>(row) * columns_number_ + col].push_back(obstacle_index);
+        }
+    }
+    obstacles_.push_back(move(obstacle));
+    return obstacle_index;
+}
+
+
+pair<unsigned int, unsigned int> ObstacleMap::calculateBucketIndexes(const double& x, const double& y) const {
+    /* Calculate indexes of the bucket containing the point. Points outside the lawn belong to the closest
+        bucket at the border, so obstacles and queries outside the lawn still meet in the same buckets */
+
+    double column = max(0.0, min(floor(x / bucket_size_), static_cast<double>(columns_number_ - 1)));
+    double row = max(0.0, min(floor(y / bucket_size_), static_cast<double>(rows_number_ - 1)));
+    return pair<unsigned int, unsigned int>(static_cast<unsigned int>(column), static_cast<unsigned int>(row));
+}
+
+
+template <typename ObstacleCheck>
+bool ObstacleMap::isAnyObstacleInArea(const pair<double, double>& left_down_corner,
+    const pair<double, double>& right_up_corner, ObstacleCheck& check) const {
+    /* Check obstacles from buckets overlapped by the area until the check returns true. An obstacle
+        overlapping several buckets may be checked more than once, which is cheaper than remembering
+        checked obstacles and keeps queries free of shared state */
+
+    pair<unsigned int, unsigned int> first_bucket = calculateBucketIndexes(left_down_corner.first,
+        left_down_corner.second);
+    pair<unsigned int, unsigned int> last_bucket = calculateBucketIndexes(right_up_corner.first,
+        right_up_corner.second);
+
+    for (unsigned int row = first_bucket.second; row <= last_bucket.second; row ++) {
+        for (unsigned int col = first_bucket.first; col <= last_bucket.first; col ++) {
+            for (unsigned int obstacle_index : buckets_[static_cast<size_t>(row) * columns_number_ + col]) {
+                if (check(obstacles_[obstacle_index])) return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+template <typename ObstacleCheck>
+bool ObstacleMap::isAnyObstacleNearSegment(const pair<double, double>& beginning, const pair<double, double>& ending,
+    const double& range, ObstacleCheck& check) const {
+    /* Check obstacles from buckets closer to the segment than range until the check returns true. Buckets are
+        visited row by row, and in every row only columns reached by the part of the segment lying in this row
+        (widened by range) are checked, so long diagonal segments do not check their whole bounding boxes */
+
+    double dx = ending.first - beginning.first;
+    double dy = ending.second - beginning.second;
+    unsigned int first_row = calculateBucketIndexes(0.0, min(beginning.second, ending.second) - range).second;
+    unsigned int last_row = calculateBucketIndexes(0.0, max(beginning.second, ending.second) + range).second;
+
+    for (unsigned int row = first_row; row <= last_row; row ++) {
+        // rows at the borders also hold obstacles lying outside the lawn
+        double row_bottom = row == 0 ? -INFINITY : row * bucket_size_ - range;
+        double row_top = row == rows_number_ - 1 ? INFINITY : (row + 1) * bucket_size_ + range;
+        double first_progress = 0.0;
+        double last_progress = 1.0;
+        if (dy != 0.0) {
+            double bottom_progress = (row_bottom - beginning.second) / dy;
+            double top_progress = (row_top - beginning.second) / dy;
+            first_progress = max(0.0, min(bottom_progress, top_progress));
+            last_progress = min(1.0, max(bottom_progress, top_progress));
+            if (first_progress > last_progress) continue;
+        }
+
+        double first_x = beginning.first + dx * first_progress;
+        double last_x = beginning.first + dx * last_progress;
+        unsigned int first_column = calculateBucketIndexes(min(first_x, last_x) - range, 0.0).first;
+        unsigned int last_column = calculateBucketIndexes(max(first_x, last_x) + range, 0.0).first;
+        for (unsigned int col = first_column; col <= last_column; col ++) {
+            for (unsigned int obstacle_index : buckets_[static_cast<size_t>(row) * columns_number_ + col]) {
+                if (check(obstacles_[obstacle_index])) return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+bool ObstacleMap::isPointInObstacle(const unsigned int& obstacle_index, const double& x, const double& y) const {
+    return isPointInShape(obstacles_[obstacle_index], x, y);
+}
+
+
+bool ObstacleMap::isPointInShape(const Obstacle& obstacle, const double& x, const double& y) {
+    // Check if the point lies inside the obstacle. Points on the border of a circle are outside
+
+    if (obstacle.shape_ == ObstacleShape::CIRCLE) {
+        double dx = x - obstacle.middle_.first;
+        double dy = y - obstacle.middle_.second;
+        return dx * dx + dy * dy < obstacle.radius_ * obstacle.radius_;
+    }
+    return isPointInPolygon(obstacle.vertices_, x, y);
+}
+
+
+bool ObstacleMap::isPointBlocked(const double& x, const double& y) const {
+    // Check if the point lies inside any obstacle
+
+    auto contains_point = [&](const Obstacle& obstacle) { return isPointInShape(obstacle, x, y); };
+    pair<double, double> point(x, y);
+    return isAnyObstacleInArea(point, point, contains_point);
+}
+
+
+bool ObstacleMap::isSegmentBlocked(const pair<double, double>& beginning, const pair<double, double>& ending,
+    const double& blade_radius, const double& margin) const {
+    /* Check if the middle of the mower moving straight from beginning to ending would hit an obstacle.
+        Physical obstacles are hit when the blade touches them, no-go zones when the middle enters them.
+        The margin is added to the distance kept from both kinds of obstacles, planners use it to leave room
+        for small errors of the mower following the planned path */
+
+    auto is_hit = [&](const Obstacle& obstacle) {
+        double clearance = (obstacle.type_ == ObstacleType::OBSTACLE ? blade_radius : 0.0) + margin;
+        return isSegmentInObstacleRange(obstacle, beginning, ending, clearance);
+    };
+    return isAnyObstacleNearSegment(beginning, ending, blade_radius + margin, is_hit);
+}
+
+
+bool ObstacleMap::isSegmentInObstacleRange(const Obstacle& obstacle, const pair<double, double>& beginning,
+    const pair<double, double>& ending, const double& clearance) const {
+    /* Check if any point of the segment is closer to the obstacle than clearance. Segments which only touch
+        the border are not in range, so the mower standing at the border can still move away */
+
+    if (obstacle.shape_ == ObstacleShape::CIRCLE) {
+        return calculateDistanceToSegment(obstacle.middle_, beginning, ending) < obstacle.radius_ + clearance;
+    }
+    if (isSegmentCrossingPolygon(obstacle.vertices_, beginning, ending)) {
+        return true;
+    }
+    return clearance > 0.0 && calculateDistanceToPolygonEdges(obstacle.vertices_, beginning, ending) < clearance;
+}
+
+
+bool ObstacleMap::isSegmentCrossingPolygon(const vector<pair<double, double>>& vertices,
+    const pair<double, double>& beginning, const pair<double, double>& ending) const {
+    /* Check if the segment enters the polygon. It does when its ending or its middle is inside, or when it crosses
+        an edge. Crossing needs the ends of both segments to lie on different sides of the other one. The beginning
+        is not checked, so the mower standing on the border can move away */
+
+    double HALF = 0.5;
+    pair<double, double> segment_middle((beginning.first + ending.first) * HALF,
+        (beginning.second + ending.second) * HALF);
+    if (isPointInPolygon(vertices, ending.first, ending.second) ||
+        isPointInPolygon(vertices, segment_middle.first, segment_middle.second)) {
+        return true;
+    }
+
+    for (size_t i = 0; i < vertices.size(); i ++) {
+        const pair<double, double>& edge_beginning = vertices[i];
+        const pair<double, double>& edge_ending = vertices[(i + 1) % vertices.size()];
+        double beginning_side = calculateCrossProduct(edge_beginning, edge_ending, beginning);
+        double ending_side = calculateCrossProduct(edge_beginning, edge_ending, ending);
+        double edge_beginning_side = calculateCrossProduct(beginning, ending, edge_beginning);
+        double edge_ending_side = calculateCrossProduct(beginning, ending, edge_ending);
+        if (beginning_side * ending_side < 0.0 && edge_beginning_side * edge_ending_side < 0.0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+double ObstacleMap::calculateDistanceToPolygonEdges(const vector<pair<double, double>>& vertices,
+    const pair<double, double>& beginning, const pair<double, double>& ending) const {
+    /* Calculate distance between the segment and the closest edge of the polygon, which the segment does not
+        cross. The distance between two segments is reached at one of their ends */
+
+    double distance = INFINITY;
+    for (size_t i = 0; i < vertices.size(); i ++) {
+        const pair<double, double>& edge_beginning = vertices[i];
+        const pair<double, double>& edge_ending = vertices[(i + 1) % vertices.size()];
+        distance = min({distance, calculateDistanceToSegment(edge_beginning, beginning, ending),
+            calculateDistanceToSegment(edge_ending, beginning, ending),
+            calculateDistanceToSegment(beginning, edge_beginning, edge_ending),
+            calculateDistanceToSegment(ending, edge_beginning, edge_ending)});
+    }
+    return distance;
+}
+
+
+bool ObstacleMap::isPointInPolygon(const vector<pair<double, double>>& vertices, const double& x, const double& y) {
+    // Count crossings of the polygon edges with the horizontal ray going right from the point
+
+    bool is_inside = false;
+    for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i ++) {
+        const pair<double, double>& a = vertices[i];
+        const pair<double, double>& b = vertices[j];
+        if ((a.second > y) != (b.second > y) &&
+            x < (b.first - a.first) * (y - a.second) / (b.second - a.second) + a.first) {
+            is_inside = !is_inside;
+        }
+    }
+    return is_inside;
+}
+
+
+double ObstacleMap::calculateDistanceToSegment(const pair<double, double>& point, const pair<double, double>& beginning,
+    const pair<double, double>& ending) {
+    // Calculate distance between the point and its projection on the segment, limited to the ends of the segment
+
+    double dx = ending.first - beginning.first;
+    double dy = ending.second - beginning.second;
+    double length_squared = dx * dx + dy * dy;
+    double progress = 0.0;
+    if (length_squared > 0.0) {
+        progress = ((point.first - beginning.first) * dx + (point.second - beginning.second) * dy) / length_squared;
+        progress = max(0.0, min(1.0, progress));
+    }
+
+    double closest_x = beginning.first + dx * progress;
+    double closest_y = beginning.second + dy * progress;
+    return hypot(point.first - closest_x, point.second - closest_y);
+}
+
+
+double ObstacleMap::calculateCrossProduct(const pair<double, double>& origin, const pair<double, double>& a,
+    const pair<double, double>& b) {
+    // Positive when b lies on the left side of the line from origin to a, negative on the right side
+
+    return (a.first - origin.first) * (b.second - origin.second) - 
+        (a.second - origin.second) * (b.first - origin.first);
+}
@@ -0,0 +1,162 @@
+/*
+    Author: Maciej Cieslik
+
+    Implements PointIndex class.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "PointIndex.h"
+
+using namespace std;
+
+
+PointIndex::PointIndex(const unsigned int& lawn_width, const unsigned int& lawn_length)
+    : width_(lawn_width), length_(lawn_length), points_number_(0) {
+    /* Buckets are at least MIN_BUCKET_SIZE wide. On big lawns they are wider, so the number of buckets
+        does not grow over MAX_BUCKETS_PER_SIDE in each direction */
+
+    double longer_side = static_cast<double>(max(width_, length_));
+    bucket_size_ = max(MIN_BUCKET_SIZE, longer_side / MAX_BUCKETS_PER_SIDE);
+    columns_number_ = max(1u, static_cast<unsigned int>(ceil(width_ / bucket_size_)));
+    rows_number_ = max(1u, static_cast<unsigned int>(ceil(length_ / bucket_size_)));
+    buckets_.resize(static_cast<size_t>(columns_number_) * rows_number_);
+}
+
+
+size_t PointIndex::getSize() const {
+    return points_number_;
+}
+
+
+double PointIndex::getBucketSize() const {
+    return bucket_size_;
+}
+
+
+void PointIndex::addPoint(const Point& point) {
+    getBucket(point.getX(), point.getY()).push_back(point);
+    points_number_ ++;
+}
+
+
+bool PointIndex::deletePoint(const Point& point) {
+    /* Delete the point with the id of the given point from the bucket of its coordinates. The order of points
+        in a bucket does not matter, so the last point of the bucket takes its place */
+
+    vector<Point>& bucket = getBucket(point.getX(), point.getY());
+    for (Point& bucket_point : bucket) {
+        if (bucket_point.getId() == point.getId()) {
+            bucket_point = bucket.back();
+            bucket.pop_back();
+            points_number_ --;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+optional<Point> PointIndex::findNearestPoint(const double& x, const double& y) const {
+    /* Find the point closest to the given coordinates. Points at the same distance are ordered by ids.
+        Buckets in the ring at distance k from the bucket of the queried point lie at least (k - 1) bucket sizes
+        away, so the search stops when the nearest point found so far is closer */
+
+    const Point* nearest_point = nullptr;
+    double nearest_distance_squared = INFINITY;
+    pair<unsigned int, unsigned int> middle = calculateBucketIndexes(x, y);
+    int middle_column = static_cast<int>(middle.first);
+    int middle_row = static_cast<int>(middle.second);
+    int max_ring = max({middle_column, static_cast<int>(columns_number_) - 1 - middle_column, middle_row,
+        static_cast<int>(rows_number_) - 1 - middle_row});
+
+    for (int ring = 0; ring <= max_ring; ring ++) {
+        double ring_distance = (ring - 1) * bucket_size_;
+        if (nearest_point != nullptr && ring_distance > 0.0 &&
+            nearest_distance_squared < ring_distance * ring_distance) {
+            break;
+        }
+
+        int first_row = max(0, middle_row - ring);
+        int last_row = min(static_cast<int>(rows_number_) - 1, middle_row + ring);
+        for (int row = first_row; row <= last_row; row ++) {
+            bool is_whole_row = row == middle_row - ring || row == middle_row + ring;
+            int column_step = is_whole_row ? 1 : 2 * ring;
+            for (int column = middle_column - ring; column <= middle_column + ring; column += column_step) {
+                if (column < 0 || column >= static_cast<int>(columns_number_)) continue;
+                findNearestPointInBucket(static_cast<unsigned int>(column), static_cast<unsigned int>(row), x, y,
+                    nearest_point, nearest_distance_squared);
+            }
+        }
+    }
+
+    if (nearest_point == nullptr) {
+        return nullopt;
+    }
+    return *nearest_point;
+}
+
+
+vector<Point> PointIndex::findPointsInRadius(const double& x, const double& y, const double& radius) const {
+    // Find points not further from the given coordinates than radius, ordered from the closest one
+
+    vector<pair<double, Point>> found_points;
+    pair<unsigned int, unsigned int> first_bucket = calculateBucketIndexes(x - radius, y - radius);
+    pair<unsigned int, unsigned int> last_bucket = calculateBucketIndexes(x + radius, y + radius);
+    double radius_squared = radius * radius;
+
+    for (unsigned int row = first_bucket.second; row <= last_bucket.second; row ++) {
+        for (unsigned int col = first_bucket.first; col <= last_bucket.first; col ++) {
+            for (const Point& point : buckets_[static_cast<size_t>(row) * columns_number_ + col]) {
+                double dx = point.getX() - x;
+                double dy = point.getY() - y;
+                double distance_squared = dx * dx + dy * dy;
+                if (distance_squared <= radius_squared) {
+                    found_points.emplace_back(distance_squared, point);
+                }
+            }
+        }
+    }
+
+    sort(found_points.begin(), found_points.end(), [](const pair<double, Point>& a, const pair<double, Point>& b) {
+        return a.first < b.first || (a.first == b.first && a.second.getId() < b.second.getId());
+    });
+    vector<Point> points;
+    points.reserve(found_points.size());
+    for (const pair<double, Point>& found_point : found_points) {
+        points.push_back(found_point.second);
+    }
+    return points;
+}
+
+
+pair<unsigned int, unsigned int> PointIndex::calculateBucketIndexes(const double& x, const double& y) const {
+    // Calculate indexes of the bucket containing the point. Points outside the lawn belong to the closest bucket
+
+    double column = max(0.0, min(floor(x / bucket_size_), static_cast<double>(columns_number_ - 1)));
+    double row = max(0.0, min(floor(y / bucket_size_), static_cast<double>(rows_number_ - 1)));
+    return pair<unsigned int, unsigned int>(static_cast<unsigned int>(column), static_cast<unsigned int>(row));
+}
+
+
+vector<Point>& PointIndex::getBucket(const double& x, const double& y) {
+    pair<unsigned int, unsigned int> indexes = calculateBucketIndexes(x, y);
+    return buckets_[static_cast<size_t>(indexes.second) * columns_number_ + indexes.first];
+}
+
+
+void PointIndex::findNearestPointInBucket(const unsigned int& column, const unsigned int& row, const double& x,
+    const double& y, const Point*& nearest_point, double& nearest_distance_squared) const {
+    // Replace the nearest point with a closer point from the bucket
+
+    for (const Point& point : buckets_[static_cast<size_t>(row) * columns_number_ + column]) {
+        double dx = point.getX() - x;
+        double dy = point.getY() - y;
+        double distance_squared = dx * dx + dy * dy;
+        if (distance_squared < nearest_distance_squared || (distance_squared == nearest_distance_squared &&
+            nearest_point != nullptr && point.getId() < nearest_point->getId())) {
+            nearest_point = &point;
+            nearest_distance_squared = distance_squared;
+        }
+    }
+}
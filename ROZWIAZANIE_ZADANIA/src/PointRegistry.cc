@@ -0,0 +1,98 @@
+/*
+    Author: Maciej Cieslik
+
+    Implements PointRegistry class.
+*/
+
+#include "PointRegistry.h"
+
+using namespace std;
+
+
+PointRegistry::PointRegistry() : deleted_points_number_(0) {}
+
+
+const vector<Point>& PointRegistry::getPoints() const {
+    // Return points in the order of adding. Slots of deleted points are removed first
+
+    if (deleted_points_number_ > 0) {
+        compact();
+    }
+    return slots_;
+}
+
+
+size_t PointRegistry::getSize() const {
+    return slots_.size() - deleted_points_number_;
+}
+
+
+bool PointRegistry::isEmpty() const {
+    return getSize() == 0;
+}
+
+
+void PointRegistry::addPoint(const Point& point) {
+    /* Add the point at the end of the order. A point with the same id is replaced in its place,
+        so the order of points does not change */
+
+    unsigned int id = point.getId();
+    if (id >= id_slots_.size()) {
+        id_slots_.resize(static_cast<size_t>(id) + 1, NO_SLOT);
+    }
+
+    if (id_slots_[id] != NO_SLOT) {
+        slots_[id_slots_[id]] = point;
+        return;
+    }
+    id_slots_[id] = static_cast<unsigned int>(slots_.size());
+    slots_.push_back(point);
+}
+
+
+bool PointRegistry::deletePoint(const unsigned int& id) {
+    // Unlink the point from its id. Return false when there is no point with this id
+
+    if (id >= id_slots_.size() || id_slots_[id] == NO_SLOT) {
+        return false;
+    }
+
+    id_slots_[id] = NO_SLOT;
+    deleted_points_number_ ++;
+    return true;
+}
+
+
+const Point* PointRegistry::findPoint(const unsigned int& id) const {
+    // Return the point with the given id or nullptr, when there is no such point
+
+    if (id >= id_slots_.size() || id_slots_[id] == NO_SLOT) {
+        return nullptr;
+    }
+    return &slots_[id_slots_[id]];
+}
+
+
+bool PointRegistry::isSlotUsed(const size_t& slot) const {
+    // Slot is used when the id of its point still leads to it
+
+    return id_slots_[slots_[slot].getId()] == slot;
+}
+
+
+void PointRegistry::compact() const {
+    // Move used slots to the front, keeping their order, and update indexes of their ids
+
+    size_t used_slots_number = 0;
+    for (size_t slot = 0; slot < slots_.size(); slot ++) {
+        if (!isSlotUsed(slot)) continue;
+
+        if (used_slots_number != slot) {
+            slots_[used_slots_number] = slots_[slot];
+            id_slots_[slots_[used_slots_number].getId()] = static_cast<unsigned int>(used_slots_number);
+        }
+        used_slots_number ++;
+    }
+    slots_.erase(slots_.begin() + used_slots_number, slots_.end());
+    deleted_points_number_ = 0;
+}
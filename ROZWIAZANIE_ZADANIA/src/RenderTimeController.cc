@@ -30,6 +30,12 @@ double RenderTimeController::getSmoothedTime() const {
     return smoothed_render_time_;
 }
 
+// Returns how far (in simulation milliseconds) the rendered moment is behind the newest snapshot.
+// Some lag is intended (buffer delay), a growing lag means that the render time cannot keep up.
+double RenderTimeController::getRenderLagMs() const {
+    return state_interpolator_.getSimulationTime() - smoothed_render_time_;
+}
+
 // Calculates where the render time should be. The render time is intentionally kept
 // behind the simulation time by a buffer delay. This gives the interpolator enough
 // snapshot history to blend between, ensuring smooth animation even if frames arrive
@@ -0,0 +1,536 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of RenderWorker.
+*/
+
+#include <QFont>
+#include <QPainter>
+#include <QtEndian>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "RenderWorker.h"
+
+using namespace std;
+using namespace std::chrono;
+
+const QColor RenderWorker::BACKGROUND_COLOR = QColor(239, 239, 239);
+const QColor RenderWorker::UNMOWED_GRASS_COLOR = QColor(75, 187, 103);
+const QColor RenderWorker::MOWED_GRASS_COLOR = QColor(115, 213, 139);
+const QColor RenderWorker::FIRST_OVERLAP_COLOR = QColor(255, 235, 59);
+const QColor RenderWorker::MAX_OVERLAP_COLOR = QColor(183, 28, 28);
+const QColor RenderWorker::OBSTACLE_COLOR = QColor(121, 85, 72);
+const QColor RenderWorker::HUD_BACKGROUND_COLOR = QColor(0, 0, 0, 160);
+const QColor RenderWorker::HUD_TEXT_COLOR = QColor(255, 255, 255);
+
+// Sprites are kept as QImage instead of QPixmap, because QPixmap can be used only on the GUI thread.
+RenderWorker::RenderWorker(StateInterpolator& state_interpolator)
+    : state_interpolator_(state_interpolator), render_time_controller_(state_interpolator),
+    lawn_palette_({UNMOWED_GRASS_COLOR.rgb(), MOWED_GRASS_COLOR.rgb()}),
+    obstacle_palette_({qRgba(0, 0, 0, 0), OBSTACLE_COLOR.rgb()}) {
+    loadMowerImage();
+    loadPointImages();
+    buildHeatmapPalette();
+}
+
+RenderWorker::~RenderWorker() {
+    stop();
+}
+
+void RenderWorker::start() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    has_last_frame_time_ = false;
+
+    render_thread_ = thread(&RenderWorker::runRenderLoop, this);
+}
+
+// Wakes the render thread if it is waiting for the next frame and waits until it finishes.
+void RenderWorker::stop() {
+    {
+        lock_guard<mutex> lock(wake_mutex_);
+        running_ = false;
+    }
+    wake_condition_.notify_all();
+
+    if (render_thread_.joinable()) {
+        render_thread_.join();
+    }
+}
+
+bool RenderWorker::isRunning() const {
+    return running_.load();
+}
+
+// The callback is called from the render thread after every finished frame.
+// It has to be set before the worker is started.
+void RenderWorker::setFrameReadyCallback(function<void()> callback) {
+    frame_ready_callback_ = callback;
+}
+
+void RenderWorker::setFrameInterval(int interval_ms) {
+    if (interval_ms > 0) {
+        frame_interval_ms_ = interval_ms;
+    }
+}
+
+void RenderWorker::setTargetSize(int width_px, int height_px) {
+    {
+        lock_guard<mutex> lock(view_mutex_);
+        target_width_px_ = width_px;
+        target_height_px_ = height_px;
+        viewport_.setScreenSize(width_px, height_px);
+    }
+    requestFrame();
+}
+
+void RenderWorker::zoomAt(double factor, double screen_x, double screen_y) {
+    {
+        lock_guard<mutex> lock(view_mutex_);
+        viewport_.zoomAt(factor, screen_x, screen_y);
+    }
+    requestFrame();
+}
+
+void RenderWorker::pan(double dx_px, double dy_px) {
+    {
+        lock_guard<mutex> lock(view_mutex_);
+        viewport_.pan(dx_px, dy_px);
+    }
+    requestFrame();
+}
+
+void RenderWorker::toggleFollowMode() {
+    {
+        lock_guard<mutex> lock(view_mutex_);
+        viewport_.setMode(viewport_.getMode() == Viewport::Mode::FOLLOW_MOWER
+            ? Viewport::Mode::FREE : Viewport::Mode::FOLLOW_MOWER);
+    }
+    requestFrame();
+}
+
+void RenderWorker::resetView() {
+    {
+        lock_guard<mutex> lock(view_mutex_);
+        viewport_.reset();
+    }
+    requestFrame();
+}
+
+void RenderWorker::toggleHeatmap() {
+    is_heatmap_visible_ = !is_heatmap_visible_.load();
+    requestFrame();
+}
+
+bool RenderWorker::isHeatmapVisible() const {
+    return is_heatmap_visible_.load();
+}
+
+void RenderWorker::toggleHud() {
+    is_hud_visible_ = !is_hud_visible_.load();
+    requestFrame();
+}
+
+bool RenderWorker::isHudVisible() const {
+    return is_hud_visible_.load();
+}
+
+// Metrics are owned by the Engine, which has to outlive the worker. Without them
+// the HUD shows only the values measured by the render thread.
+void RenderWorker::setPerformanceMetrics(const PerformanceMetrics* metrics) {
+    performance_metrics_ = metrics;
+}
+
+// Returns the latest finished frame. QImage is implicitly shared, so only a reference
+// is copied here. The render thread always draws into the other buffer.
+QImage RenderWorker::getLatestFrame() const {
+    lock_guard<mutex> lock(frame_mutex_);
+    return front_buffer_;
+}
+
+double RenderWorker::getLastCompositionTimeMs() const {
+    return last_composition_time_ms_.load();
+}
+
+double RenderWorker::getAverageCompositionTimeMs() const {
+    return average_composition_time_ms_.load();
+}
+
+// Render loop running in a separate thread. Composes one frame per frame interval and
+// sleeps until the next frame is due. User input (zoom, pan, resize) wakes it up earlier,
+// so the view reacts immediately.
+void RenderWorker::runRenderLoop() {
+    auto next_frame_time = steady_clock::now();
+
+    while (running_) {
+        composeFrame();
+        if (frame_ready_callback_) {
+            frame_ready_callback_();
+        }
+
+        next_frame_time += milliseconds(frame_interval_ms_.load());
+        auto now = steady_clock::now();
+        if (next_frame_time < now) {
+            next_frame_time = now;
+        }
+
+        unique_lock<mutex> lock(wake_mutex_);
+        wake_condition_.wait_until(lock, next_frame_time, [this]() {
+            return !running_ || wake_requested_;
+        });
+        wake_requested_ = false;
+    }
+}
+
+void RenderWorker::requestFrame() {
+    {
+        lock_guard<mutex> lock(wake_mutex_);
+        wake_requested_ = true;
+    }
+    wake_condition_.notify_all();
+}
+
+// Composes a single frame: advances render time, fetches the interpolated state, draws
+// the lawn, points and mower into the back buffer and publishes it as the latest frame.
+void RenderWorker::composeFrame() {
+    auto composition_start = steady_clock::now();
+
+    updateRenderTime();
+    SimulationSnapshot sim_snapshot = state_interpolator_.getInterpolatedState(render_time_controller_.getSmoothedTime());
+    StaticSimulationData static_data = state_interpolator_.getStaticSimulationData();
+
+    int width_px = 0;
+    int height_px = 0;
+    Viewport viewport = prepareViewport(sim_snapshot, static_data, width_px, height_px);
+    if (width_px <= 0 || height_px <= 0) return;
+
+    prepareBackBuffer(width_px, height_px);
+    {
+        QPainter painter(&back_buffer_);
+        setupPainter(painter);
+        renderLawn(painter, sim_snapshot, static_data, viewport);
+        renderPoints(painter, sim_snapshot, viewport, height_px);
+        renderMowers(painter, sim_snapshot, static_data, viewport);
+        if (is_hud_visible_) {
+            renderHud(painter);
+        }
+    }
+    publishBackBuffer();
+
+    duration<double, milli> composition_time = steady_clock::now() - composition_start;
+    recordCompositionTime(composition_time.count());
+}
+
+// Tracks time between frames. This time is used by RenderTimeController for smooth animation.
+void RenderWorker::updateRenderTime() {
+    double ms_since_last_frame = 0.0;
+    auto now = steady_clock::now();
+
+    if (has_last_frame_time_) {
+        ms_since_last_frame = duration<double, milli>(now - last_frame_time_).count();
+        frame_statistics_.addFrameTime(ms_since_last_frame);
+    }
+    last_frame_time_ = now;
+    has_last_frame_time_ = true;
+
+    render_time_controller_.update(ms_since_last_frame);
+}
+
+// Updates the shared viewport with the latest lawn size and mower position and returns its copy,
+// so the frame can be drawn without holding the lock.
+Viewport RenderWorker::prepareViewport(const SimulationSnapshot& sim_snapshot, const StaticSimulationData& static_data,
+        int& out_width_px, int& out_height_px) {
+    lock_guard<mutex> lock(view_mutex_);
+    if (static_data.lawn_width_ > 0 && static_data.lawn_length_ > 0) {
+        viewport_.setLawnSize(static_data.lawn_width_, static_data.lawn_length_);
+    }
+    viewport_.followTarget(sim_snapshot.x_, sim_snapshot.y_);
+
+    out_width_px = target_width_px_;
+    out_height_px = target_height_px_;
+    return viewport_;
+}
+
+void RenderWorker::prepareBackBuffer(int width_px, int height_px) {
+    if (back_buffer_.width() != width_px || back_buffer_.height() != height_px) {
+        back_buffer_ = QImage(width_px, height_px, QImage::Format_ARGB32_Premultiplied);
+    }
+    back_buffer_.fill(BACKGROUND_COLOR);
+}
+
+// Swaps the buffers, so the finished frame becomes visible for the GUI thread. If the GUI thread
+// still holds the old front buffer, QImage detaches on the next write instead of drawing into it.
+void RenderWorker::publishBackBuffer() {
+    lock_guard<mutex> lock(frame_mutex_);
+    swap(front_buffer_, back_buffer_);
+}
+
+// Keeps the last composition time and its exponential moving average.
+void RenderWorker::recordCompositionTime(double composition_time_ms) {
+    last_composition_time_ms_ = composition_time_ms;
+    double average = average_composition_time_ms_.load();
+    if (average == 0.0) {
+        average_composition_time_ms_ = composition_time_ms;
+    } else {
+        average_composition_time_ms_ = average + (composition_time_ms - average) * COMPOSITION_TIME_SMOOTHING;
+    }
+}
+
+void RenderWorker::loadMowerImage() {
+    string assets_path = string(ASSETS_PATH);
+    string mower_path = assets_path + "/mower.png";
+    if (!mower_image_.load(mower_path.c_str())) {
+        cerr << "[RenderWorker] Failed to load mower image from file: " << mower_path << endl;
+    }
+}
+
+void RenderWorker::loadPointImages() {
+    string assets_path = string(ASSETS_PATH);
+    vector<string> point_colors = {
+        "0_purple", "1_pink", "2_red", "3_orange", "4_yellow", "5_green", "6_blue", "7_navy"
+    };
+
+    for (const string& color : point_colors) {
+        string path = assets_path + "/point_" + color + ".png";
+        QImage image;
+        if (image.load(path.c_str())) {
+            point_images_.push_back(image);
+        } else {
+            cerr << "[RenderWorker] Failed to load point image: " << path << endl;
+        }
+    }
+}
+
+// Prepares colors for every possible pass count. Fields mowed once use the normal mowed grass color,
+// repeated passes go from yellow to dark red, which is reached at HEATMAP_SATURATION_PASSES.
+void RenderWorker::buildHeatmapPalette() {
+    const int MAX_PASS_COUNT = 255;
+    heatmap_palette_.resize(MAX_PASS_COUNT + 1);
+    heatmap_palette_[0] = UNMOWED_GRASS_COLOR.rgb();
+    heatmap_palette_[1] = MOWED_GRASS_COLOR.rgb();
+
+    for (int passes = 2; passes <= MAX_PASS_COUNT; ++passes) {
+        double alpha = min(1.0, static_cast<double>(passes - 2) / (HEATMAP_SATURATION_PASSES - 2));
+        int red = static_cast<int>(FIRST_OVERLAP_COLOR.red() + (MAX_OVERLAP_COLOR.red() - FIRST_OVERLAP_COLOR.red()) * alpha);
+        int green = static_cast<int>(FIRST_OVERLAP_COLOR.green() + (MAX_OVERLAP_COLOR.green() - FIRST_OVERLAP_COLOR.green()) * alpha);
+        int blue = static_cast<int>(FIRST_OVERLAP_COLOR.blue() + (MAX_OVERLAP_COLOR.blue() - FIRST_OVERLAP_COLOR.blue()) * alpha);
+        heatmap_palette_[passes] = qRgb(red, green, blue);
+    }
+}
+
+void RenderWorker::setupPainter(QPainter& painter) const {
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+}
+
+// Draws the lawn without converting it cell by cell. The bit-packed field grid is wrapped by a
+// Format_MonoLSB image (1 bit per cell) and the pass counts by a Format_Indexed8 image (1 byte per cell),
+// both with a color table instead of 4 bytes per cell. Obstacle fields are drawn over the lawn the same way,
+// with a transparent color for free fields. Only the visible cells are drawn: the source rectangle
+// selects them and they are stretched over the matching part of the frame. Rows of the grid start at
+// the bottom of the lawn, so the painter is flipped vertically. Antialiasing is temporarily
+// disabled to keep grass cells sharp and prevent blending between mowed/unmowed areas.
+void RenderWorker::renderLawn(QPainter& painter, const SimulationSnapshot& sim_snapshot,
+        const StaticSimulationData& static_data, const Viewport& viewport) const {
+    const FieldGrid& fields = sim_snapshot.fields_;
+    if (fields.isEmpty()) return;
+
+    const int num_rows = static_cast<int>(fields.getRowsNumber());
+    const int num_cols = static_cast<int>(fields.getColumnsNumber());
+
+    const CellRange cells = viewport.calculateVisibleCells(num_cols, num_rows);
+    if (cells.isEmpty()) return;
+
+    const auto& pass_counts = sim_snapshot.pass_counts_;
+    const bool use_heatmap = is_heatmap_visible_ && pass_counts.size() == static_cast<size_t>(num_rows) * num_cols;
+    QImage lawn_image = use_heatmap ? wrapPassCounts(pass_counts, num_cols, num_rows)
+        : wrapFieldGrid(fields, lawn_palette_);
+
+    double cell_width_cm = static_cast<double>(static_data.lawn_width_) / num_cols;
+    double cell_length_cm = static_cast<double>(static_data.lawn_length_) / num_rows;
+    pair<double, double> top_left_px = viewport.mapToScreen(cells.first_col_ * cell_width_cm,
+        cells.end_row_ * cell_length_cm);
+    double w_px = cells.getColumnsCount() * cell_width_cm * viewport.getScale();
+    double h_px = cells.getRowsCount() * cell_length_cm * viewport.getScale();
+    QRectF target_rect(top_left_px.first, top_left_px.second, w_px, h_px);
+    QRectF source_rect(cells.first_col_, cells.first_row_, cells.getColumnsCount(), cells.getRowsCount());
+
+    painter.save();
+    painter.setRenderHint(QPainter::Antialiasing, false);
+    painter.translate(0.0, target_rect.top() + target_rect.bottom());
+    painter.scale(1.0, -1.0);
+
+    painter.drawImage(target_rect, lawn_image, source_rect);
+    if (!static_data.obstacle_fields_.isEmpty()) {
+        painter.drawImage(target_rect, wrapFieldGrid(static_data.obstacle_fields_, obstacle_palette_), source_rect);
+    }
+
+    painter.restore();
+}
+
+// Creates a 1-bit image which uses the memory of the grid. Both have LSB-first bit order and 32-bit
+// aligned rows, so on little endian machines nothing is copied. The image is only read while the snapshot
+// is alive, so casting away const is safe, it is needed only to set the color table without detaching.
+QImage RenderWorker::wrapFieldGrid(const FieldGrid& fields, const QVector<QRgb>& palette) const {
+    const int num_cols = static_cast<int>(fields.getColumnsNumber());
+    const int num_rows = static_cast<int>(fields.getRowsNumber());
+    const int bytes_per_line = static_cast<int>(fields.getWordsPerRow() * sizeof(uint32_t));
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    uchar* grid_data = const_cast<uchar*>(reinterpret_cast<const uchar*>(fields.getWords().data()));
+    QImage lawn_image(grid_data, num_cols, num_rows, bytes_per_line, QImage::Format_MonoLSB);
+#else
+    QImage lawn_image(num_cols, num_rows, QImage::Format_MonoLSB);
+    for (int row = 0; row < num_rows; ++row) {
+        qToLittleEndian<quint32>(fields.getWords().data() + static_cast<size_t>(row) * fields.getWordsPerRow(),
+            fields.getWordsPerRow(), lawn_image.scanLine(row));
+    }
+#endif
+
+    lawn_image.setColorTable(palette);
+    return lawn_image;
+}
+
+// Creates an 8-bit indexed image which uses the memory of the pass counts, the heatmap palette is its color table.
+QImage RenderWorker::wrapPassCounts(const vector<uint8_t>& pass_counts, int num_cols, int num_rows) const {
+    uchar* counts_data = const_cast<uchar*>(pass_counts.data());
+    QImage heatmap_image(counts_data, num_cols, num_rows, num_cols, QImage::Format_Indexed8);
+    heatmap_image.setColorTable(heatmap_palette_);
+    return heatmap_image;
+}
+
+// Draws the performance HUD in the top left corner of the frame, on a translucent background.
+void RenderWorker::renderHud(QPainter& painter) const {
+    vector<string> lines = buildHudLines();
+    QRectF background(HUD_MARGIN_PX, HUD_MARGIN_PX, HUD_WIDTH_PX, HUD_LINE_HEIGHT_PX * (lines.size() + 0.5));
+
+    painter.save();
+    painter.fillRect(background, HUD_BACKGROUND_COLOR);
+    QFont font("Monospace");
+    font.setStyleHint(QFont::Monospace);
+    font.setPointSize(HUD_FONT_SIZE);
+    painter.setFont(font);
+    painter.setPen(HUD_TEXT_COLOR);
+
+    for (size_t i = 0; i < lines.size(); ++i) {
+        QPointF position(HUD_MARGIN_PX * 2, HUD_MARGIN_PX + HUD_LINE_HEIGHT_PX * (i + 1));
+        painter.drawText(position, QString::fromStdString(lines[i]));
+    }
+    painter.restore();
+}
+
+// Render thread values are read directly, simulation thread values come from the lock-free PerformanceMetrics.
+vector<string> RenderWorker::buildHudLines() const {
+    vector<string> lines;
+    ostringstream line;
+    line << fixed << setprecision(1);
+
+    line << "FPS: " << frame_statistics_.getFramesPerSecond()
+        << "  compose: " << average_composition_time_ms_.load() << " ms";
+    lines.push_back(line.str());
+    line.str("");
+    line << "frame p50/p95/p99: " << frame_statistics_.getPercentileFrameTimeMs(50.0) << "/"
+        << frame_statistics_.getPercentileFrameTimeMs(95.0) << "/"
+        << frame_statistics_.getPercentileFrameTimeMs(99.0) << " ms";
+    lines.push_back(line.str());
+    line.str("");
+    line << "render lag: " << render_time_controller_.getRenderLagMs() << " ms";
+    lines.push_back(line.str());
+    line.str("");
+    line << "snapshots: " << state_interpolator_.getBufferedSnapshotsCount() << "/"
+        << StateInterpolator::getBufferCapacity();
+    lines.push_back(line.str());
+
+    const PerformanceMetrics* metrics = performance_metrics_.load();
+    if (metrics == nullptr) {
+        return lines;
+    }
+    line.str("");
+    line << "sim ticks/s: " << metrics->ticks_per_second_.load(memory_order_relaxed)
+        << "  tick: " << setprecision(3) << metrics->tick_time_ms_.load(memory_order_relaxed) << " ms";
+    lines.push_back(line.str());
+    line.str("");
+    line << "lawn cutting/tick: " << metrics->cutting_time_per_tick_ms_.load(memory_order_relaxed) << " ms";
+    lines.push_back(line.str());
+    line.str("");
+    line << "command queue: " << metrics->command_queue_depth_.load(memory_order_relaxed);
+    lines.push_back(line.str());
+    return lines;
+}
+
+// Calculates the display size of the mower in pixels. The mower should be at least
+// as wide as its blade diameter for realistic representation so that the mowed path isn't wider than the mower.
+void RenderWorker::calculateMowerRenderSize(const StaticSimulationData& static_data, double scale,
+        double& out_w_px, double& out_h_px) const {
+    if (static_data.width_cm_ <= 0.0) {
+        out_w_px = 0.0;
+        out_h_px = 0.0;
+        return;
+    }
+    double display_width_cm = max(static_data.width_cm_, static_data.blade_diameter_cm);
+
+    double scale_ratio = display_width_cm / static_data.width_cm_;
+    double display_length_cm = static_data.length_cm * scale_ratio;
+
+    out_w_px = display_width_cm * scale;
+    out_h_px = display_length_cm * scale;
+}
+
+// Draws the mower of the snapshot and all other mowers of the fleet. All mowers share the same dimensions.
+void RenderWorker::renderMowers(QPainter& painter, const SimulationSnapshot& sim_snapshot,
+        const StaticSimulationData& static_data, const Viewport& viewport) const {
+    double mower_w_px, mower_h_px;
+    calculateMowerRenderSize(static_data, viewport.getScale(), mower_w_px, mower_h_px);
+
+    renderMower(painter, MowerPose{sim_snapshot.x_, sim_snapshot.y_, sim_snapshot.angle_}, mower_w_px, mower_h_px,
+        viewport);
+    for (const MowerPose& pose : sim_snapshot.other_mowers_) {
+        renderMower(painter, pose, mower_w_px, mower_h_px, viewport);
+    }
+}
+
+void RenderWorker::renderMower(QPainter& painter, const MowerPose& pose, double mower_w_px, double mower_h_px,
+        const Viewport& viewport) const {
+    if (!viewport.isPointVisible(pose.x_, pose.y_, max(mower_w_px, mower_h_px))) return;
+
+    painter.save();
+
+    pair<double, double> center_pos = viewport.mapToScreen(pose.x_, pose.y_);
+    painter.translate(QPointF(center_pos.first, center_pos.second));
+    painter.rotate(pose.angle_);
+
+    QRectF target_rect(-mower_w_px / 2.0, -mower_h_px / 2.0, mower_w_px, mower_h_px);
+
+    painter.drawImage(target_rect, mower_image_, mower_image_.rect());
+    painter.restore();
+}
+
+void RenderWorker::renderPoints(QPainter& painter, const SimulationSnapshot& sim_snapshot, const Viewport& viewport,
+        int height_px) const {
+    if (point_images_.empty()) return;
+
+    const auto& points = sim_snapshot.points_;
+    double point_height = max(height_px * POINT_PROPORTION, MIN_POINT_HEIGHT);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& point = points[i];
+        if (!viewport.isPointVisible(point.getX(), point.getY(), point_height)) continue;
+
+        size_t image_index = i % point_images_.size();
+        const auto& image = point_images_[image_index];
+
+        pair<double, double> screen_pos = viewport.mapToScreen(point.getX(), point.getY());
+
+        double aspect_ratio = static_cast<double>(image.width()) / (image.height() > 0 ? image.height() : 1);
+        double point_width = point_height * aspect_ratio;
+
+        QRectF target_rect(screen_pos.first - point_width / 2.0, screen_pos.second - point_height,
+            point_width, point_height);
+
+        painter.drawImage(target_rect, image, image.rect());
+    }
+}
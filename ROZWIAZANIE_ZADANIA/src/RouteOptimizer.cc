@@ -0,0 +1,222 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of RouteOptimizer class.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "RouteOptimizer.h"
+#include "Constants.h"
+
+using namespace std;
+
+namespace {
+    constexpr double FULL_ANGLE = 360.0;
+    constexpr double HALF_ANGLE = 180.0;
+
+    // Heading of the vector in degrees, 0 is up and the angle grows clockwise, like the angle of the mower.
+    double calculateHeading(const pair<double, double>& from, const pair<double, double>& to) {
+        return atan2(to.first - from.first, to.second - from.second) * HALF_ANGLE / Constants::PI;
+    }
+
+    double calculateAngleDifference(double from_heading, double to_heading) {
+        double difference = fmod(to_heading - from_heading, FULL_ANGLE);
+        if (difference > HALF_ANGLE) difference -= FULL_ANGLE;
+        if (difference < -HALF_ANGLE) difference += FULL_ANGLE;
+        return abs(difference);
+    }
+
+    bool isSamePosition(const pair<double, double>& a, const pair<double, double>& b) {
+        return a.first == b.first && a.second == b.second;
+    }
+}
+
+// Speed is the speed of the mower in cm/s, time budget limits 2-opt improvement in seconds.
+RouteOptimizer::RouteOptimizer(double speed, double time_budget)
+    : speed_(speed), time_budget_(time_budget) {}
+
+// Route starts at the nearest-neighbour order. Every 2-opt move reverses the part of the route between
+// positions first and last, which changes only two legs and the rotations at their ends. Node 0 is the start
+// of the mower, it never moves.
+OptimizedRoute RouteOptimizer::optimize(const pair<double, double>& start, unsigned short start_angle,
+    const vector<Point>& points) const {
+    auto optimization_start = chrono::steady_clock::now();
+    double start_heading = static_cast<double>(start_angle);
+
+    OptimizedRoute result;
+    result.given_order_time_ = calculateRouteTime(start, start_angle, points);
+
+    vector<pair<double, double>> nodes;
+    nodes.reserve(points.size() + 1);
+    nodes.push_back(start);
+    for (const Point& point : points) {
+        nodes.emplace_back(point.getX(), point.getY());
+    }
+    vector<size_t> route = createNearestNeighbourRoute(nodes, start_heading);
+    vector<size_t> route_positions(route.size());
+    for (size_t i = 0; i < route.size(); ++i) {
+        route_positions[route[i]] = i;
+    }
+    vector<vector<size_t>> nearest_nodes = findNearestNodes(nodes);
+
+    // Rotation at the node on position node towards the node on position target, after coming
+    // from the node on position previous. The mower starts with the start angle.
+    auto turn = [&](size_t previous, size_t node, size_t target) {
+        if (node == 0) {
+            return calculateTurnTime(start_heading, nodes[route[0]], nodes[route[target]]);
+        }
+        return calculateTurnTime(nodes[route[previous]], nodes[route[node]], nodes[route[target]]);
+    };
+    auto leg = [&](size_t from, size_t to) {
+        return calculateLegTime(nodes[route[from]], nodes[route[to]]);
+    };
+    size_t last_position = route.size() - 1;
+    auto calculateReversalGain = [&](size_t first, size_t last) {
+        double old_time = leg(first - 1, first) + turn(first - 2, first - 1, first)
+            + turn(first - 1, first, first + 1);
+        double new_time = leg(first - 1, last) + turn(first - 2, first - 1, last)
+            + turn(first - 1, last, last - 1);
+        if (last < last_position) {
+            old_time += leg(last, last + 1) + turn(last - 1, last, last + 1);
+            new_time += leg(first, last + 1) + turn(first + 1, first, last + 1);
+        }
+        if (last + 1 < last_position) {
+            old_time += turn(last, last + 1, last + 2);
+            new_time += turn(first, last + 1, last + 2);
+        }
+        return old_time - new_time;
+    };
+
+    // A move is checked for every near node of the node before position i. Reversing the part after it
+    // or before it makes them neighbours on the route.
+    bool is_improved = true;
+    bool is_budget_used = false;
+    while (is_improved && !is_budget_used) {
+        is_improved = false;
+        for (size_t i = 1; i < last_position; ++i) {
+            chrono::duration<double> elapsed = chrono::steady_clock::now() - optimization_start;
+            if (elapsed.count() > time_budget_) {
+                is_budget_used = true;
+                break;
+            }
+            for (size_t near_node : nearest_nodes[route[i - 1]]) {
+                size_t near_position = route_positions[near_node];
+                size_t first = near_position > i ? i : near_position + 1;
+                size_t last = near_position > i ? near_position : i - 1;
+                if (near_position == i || first >= last || calculateReversalGain(first, last) <= MIN_IMPROVEMENT) {
+                    continue;
+                }
+                reverse(route.begin() + first, route.begin() + last + 1);
+                for (size_t position = first; position <= last; ++position) {
+                    route_positions[route[position]] = position;
+                }
+                result.improvements_number_ ++;
+                is_improved = true;
+            }
+        }
+    }
+    result.is_local_optimum_ = !is_budget_used;
+
+    vector<Point> ordered_points;
+    ordered_points.reserve(points.size());
+    for (size_t i = 1; i < route.size(); ++i) {
+        ordered_points.push_back(points[route[i] - 1]);
+        result.point_ids_.push_back(points[route[i] - 1].getId());
+    }
+    result.predicted_time_ = calculateRouteTime(start, start_angle, ordered_points);
+    return result;
+}
+
+// The mower does not rotate after reaching the last point.
+double RouteOptimizer::calculateRouteTime(const pair<double, double>& start, unsigned short start_angle,
+    const vector<Point>& points) const {
+    double time = 0.0;
+    pair<double, double> previous = start;
+    pair<double, double> current = start;
+    for (size_t i = 0; i < points.size(); ++i) {
+        pair<double, double> next(points[i].getX(), points[i].getY());
+        time += i == 0 ? calculateTurnTime(static_cast<double>(start_angle), current, next)
+            : calculateTurnTime(previous, current, next);
+        time += calculateLegTime(current, next);
+        previous = current;
+        current = next;
+    }
+    return time;
+}
+
+// Chooses the next node reached in the shortest time, counting the rotation towards it. Rotation is checked
+// only for nodes which are close enough to be better than the best node found so far.
+vector<size_t> RouteOptimizer::createNearestNeighbourRoute(const vector<pair<double, double>>& nodes,
+    double start_heading) const {
+    vector<size_t> route = {0};
+    vector<size_t> unvisited_nodes;
+    for (size_t node = 1; node < nodes.size(); ++node) {
+        unvisited_nodes.push_back(node);
+    }
+
+    while (!unvisited_nodes.empty()) {
+        const pair<double, double>& current = nodes[route.back()];
+        size_t best_index = 0;
+        double best_time = INFINITY;
+        for (size_t i = 0; i < unvisited_nodes.size(); ++i) {
+            const pair<double, double>& candidate = nodes[unvisited_nodes[i]];
+            double time = calculateLegTime(current, candidate);
+            if (time >= best_time) continue;
+            time += route.size() == 1 ? calculateTurnTime(start_heading, current, candidate)
+                : calculateTurnTime(nodes[route[route.size() - 2]], current, candidate);
+            if (time < best_time) {
+                best_time = time;
+                best_index = i;
+            }
+        }
+        route.push_back(unvisited_nodes[best_index]);
+        unvisited_nodes[best_index] = unvisited_nodes.back();
+        unvisited_nodes.pop_back();
+    }
+    return route;
+}
+
+// Finds up to NEIGHBOURS_NUMBER closest nodes of every node. The start is a neighbour of points,
+// but points are not checked as its neighbours, because the start never moves.
+vector<vector<size_t>> RouteOptimizer::findNearestNodes(const vector<pair<double, double>>& nodes) {
+    vector<vector<size_t>> nearest_nodes(nodes.size());
+    vector<pair<double, size_t>> distances;
+    for (size_t node = 1; node < nodes.size(); ++node) {
+        distances.clear();
+        for (size_t other = 0; other < nodes.size(); ++other) {
+            if (other == node) continue;
+            double dx = nodes[other].first - nodes[node].first;
+            double dy = nodes[other].second - nodes[node].second;
+            distances.emplace_back(dx * dx + dy * dy, other);
+        }
+        size_t neighbours_number = min(NEIGHBOURS_NUMBER, distances.size());
+        partial_sort(distances.begin(), distances.begin() + neighbours_number, distances.end());
+        for (size_t i = 0; i < neighbours_number; ++i) {
+            nearest_nodes[node].push_back(distances[i].second);
+        }
+    }
+    return nearest_nodes;
+}
+
+double RouteOptimizer::calculateLegTime(const pair<double, double>& from, const pair<double, double>& to) const {
+    return hypot(to.first - from.first, to.second - from.second) / speed_;
+}
+
+// Points at the same position need no rotation, so reversing a part of the route never changes
+// rotations inside it.
+double RouteOptimizer::calculateTurnTime(const pair<double, double>& previous, const pair<double, double>& from,
+    const pair<double, double>& to) {
+    if (isSamePosition(previous, from)) {
+        return 0.0;
+    }
+    return calculateTurnTime(calculateHeading(previous, from), from, to);
+}
+
+double RouteOptimizer::calculateTurnTime(double heading, const pair<double, double>& from,
+    const pair<double, double>& to) {
+    if (isSamePosition(from, to)) {
+        return 0.0;
+    }
+    return calculateAngleDifference(heading, calculateHeading(from, to)) / Constants::ROTATION_SPEED;
+}
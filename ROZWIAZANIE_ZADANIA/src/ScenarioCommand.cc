@@ -0,0 +1,204 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of ScenarioCommand class.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include "ScenarioCommand.h"
+
+using namespace std;
+
+constexpr char ScenarioCommand::BINARY_SCENARIO_MAGIC[];
+
+namespace {
+    template <typename T>
+    void writeValue(ostream& stream, const T& value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // 15 significant digits keep coordinates exact in practice, and short numbers stay short
+    void writeNumber(ostream& stream, double value) {
+        char buffer[32];
+        int length = snprintf(buffer, sizeof(buffer), "%.15g", value);
+        stream.write(buffer, length);
+    }
+
+    template <typename T>
+    bool readValue(istream& stream, T& out_value) {
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&out_value), sizeof(out_value)));
+    }
+}
+
+ScenarioCommand::ScenarioCommand() : type_(ScenarioCommandType::GET_CURRENT_POSITION), values_({0.0, 0.0}) {}
+
+ScenarioCommand::ScenarioCommand(ScenarioCommandType type, double value_0, double value_1)
+    : type_(type), values_({value_0, value_1}) {}
+
+bool ScenarioCommand::operator==(const ScenarioCommand& other) const {
+    return type_ == other.type_ && values_ == other.values_;
+}
+
+bool ScenarioCommand::operator!=(const ScenarioCommand& other) const {
+    return !((*this) == other);
+}
+
+ScenarioCommandType ScenarioCommand::getType() const {
+    return type_;
+}
+
+double ScenarioCommand::getValue(unsigned int index) const {
+    return values_.at(index);
+}
+
+unsigned int ScenarioCommand::getValuesNumber(ScenarioCommandType type) {
+    switch (type) {
+        case ScenarioCommandType::ADD_POINT:
+        case ScenarioCommandType::ARC:
+            return 2;
+        case ScenarioCommandType::MOVE:
+        case ScenarioCommandType::ROTATE:
+        case ScenarioCommandType::DELETE_POINT:
+        case ScenarioCommandType::MOVE_TO_POINT:
+        case ScenarioCommandType::ROTATE_TOWARDS_POINT:
+        case ScenarioCommandType::GET_DISTANCE_TO_POINT:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Name of the command in text scenarios. Mowing is switched with "mowing on" and "mowing off".
+const char* ScenarioCommand::getKeyword(ScenarioCommandType type) {
+    switch (type) {
+        case ScenarioCommandType::MOVE: return "move";
+        case ScenarioCommandType::ROTATE: return "rotate";
+        case ScenarioCommandType::MOWING_ON: return "mowing on";
+        case ScenarioCommandType::MOWING_OFF: return "mowing off";
+        case ScenarioCommandType::ADD_POINT: return "add_point";
+        case ScenarioCommandType::DELETE_POINT: return "delete_point";
+        case ScenarioCommandType::MOVE_TO_POINT: return "move_to_point";
+        case ScenarioCommandType::ROTATE_TOWARDS_POINT: return "rotate_towards_point";
+        case ScenarioCommandType::GET_DISTANCE_TO_POINT: return "distance_to_point";
+        case ScenarioCommandType::GET_CURRENT_POSITION: return "position";
+        case ScenarioCommandType::ARC: return "arc";
+        default: return "";
+    }
+}
+
+void ScenarioCommand::writeTextLine(ostream& stream) const {
+    stream << getKeyword(type_);
+    for (unsigned int i = 0; i < getValuesNumber(type_); ++i) {
+        stream << ' ';
+        writeNumber(stream, values_[i]);
+    }
+    stream << '\n';
+}
+
+void ScenarioCommand::writeTextParameters(ostream& stream, const ScenarioParameters& parameters) {
+    stream << "lawn " << parameters.lawn_width_ << ' ' << parameters.lawn_length_ << '\n';
+    stream << "mower " << parameters.mower_width_ << ' ' << parameters.mower_length_ << ' '
+        << parameters.blade_diameter_ << ' ' << parameters.speed_ << '\n';
+    stream << "start ";
+    writeNumber(stream, parameters.starting_x_);
+    stream << ' ';
+    writeNumber(stream, parameters.starting_y_);
+    stream << ' ' << parameters.starting_angle_ << '\n';
+}
+
+void ScenarioCommand::writeBinaryHeader(ostream& stream, const ScenarioParameters& parameters) {
+    stream.write(BINARY_SCENARIO_MAGIC, sizeof(BINARY_SCENARIO_MAGIC));
+    writeValue(stream, static_cast<uint32_t>(parameters.lawn_width_));
+    writeValue(stream, static_cast<uint32_t>(parameters.lawn_length_));
+    writeValue(stream, static_cast<uint32_t>(parameters.mower_width_));
+    writeValue(stream, static_cast<uint32_t>(parameters.mower_length_));
+    writeValue(stream, static_cast<uint32_t>(parameters.blade_diameter_));
+    writeValue(stream, static_cast<uint32_t>(parameters.speed_));
+    writeValue(stream, parameters.starting_x_);
+    writeValue(stream, parameters.starting_y_);
+    writeValue(stream, static_cast<uint16_t>(parameters.starting_angle_));
+}
+
+bool ScenarioCommand::readBinaryHeader(istream& stream, ScenarioParameters& out_parameters) {
+    char magic[sizeof(BINARY_SCENARIO_MAGIC)];
+    if (!stream.read(magic, sizeof(magic)) || memcmp(magic, BINARY_SCENARIO_MAGIC, sizeof(magic)) != 0) {
+        return false;
+    }
+
+    uint32_t sizes[6];
+    uint16_t starting_angle;
+    if (!readValue(stream, sizes) || !readValue(stream, out_parameters.starting_x_) ||
+        !readValue(stream, out_parameters.starting_y_) || !readValue(stream, starting_angle)) {
+        return false;
+    }
+    out_parameters.lawn_width_ = sizes[0];
+    out_parameters.lawn_length_ = sizes[1];
+    out_parameters.mower_width_ = sizes[2];
+    out_parameters.mower_length_ = sizes[3];
+    out_parameters.blade_diameter_ = sizes[4];
+    out_parameters.speed_ = sizes[5];
+    out_parameters.starting_angle_ = starting_angle;
+    return true;
+}
+
+// Every value is stored in the narrowest type it needs: angles as 2 bytes and point ids as 4 bytes,
+// so a rotation takes 3 bytes and a move 9 bytes.
+void ScenarioCommand::writeBinary(ostream& stream) const {
+    writeValue(stream, static_cast<uint8_t>(type_));
+    switch (type_) {
+        case ScenarioCommandType::MOVE:
+            writeValue(stream, values_[0]);
+            break;
+        case ScenarioCommandType::ROTATE:
+            writeValue(stream, static_cast<int16_t>(values_[0]));
+            break;
+        case ScenarioCommandType::ADD_POINT:
+        case ScenarioCommandType::ARC:
+            writeValue(stream, values_[0]);
+            writeValue(stream, values_[1]);
+            break;
+        case ScenarioCommandType::DELETE_POINT:
+        case ScenarioCommandType::MOVE_TO_POINT:
+        case ScenarioCommandType::ROTATE_TOWARDS_POINT:
+        case ScenarioCommandType::GET_DISTANCE_TO_POINT:
+            writeValue(stream, static_cast<uint32_t>(values_[0]));
+            break;
+        default:
+            break;
+    }
+}
+
+// Reads the next command. Returns false at the end of the scenario or when the command is damaged.
+bool ScenarioCommand::readBinary(istream& stream) {
+    uint8_t type;
+    if (!readValue(stream, type) || type >= static_cast<uint8_t>(ScenarioCommandType::COMMAND_TYPES_NUMBER)) {
+        return false;
+    }
+    type_ = static_cast<ScenarioCommandType>(type);
+    values_ = {0.0, 0.0};
+
+    switch (type_) {
+        case ScenarioCommandType::MOVE:
+            return readValue(stream, values_[0]);
+        case ScenarioCommandType::ROTATE: {
+            int16_t angle;
+            if (!readValue(stream, angle)) return false;
+            values_[0] = angle;
+            return true;
+        }
+        case ScenarioCommandType::ADD_POINT:
+        case ScenarioCommandType::ARC:
+            return readValue(stream, values_[0]) && readValue(stream, values_[1]);
+        case ScenarioCommandType::DELETE_POINT:
+        case ScenarioCommandType::MOVE_TO_POINT:
+        case ScenarioCommandType::ROTATE_TOWARDS_POINT:
+        case ScenarioCommandType::GET_DISTANCE_TO_POINT: {
+            uint32_t point_id;
+            if (!readValue(stream, point_id)) return false;
+            values_[0] = point_id;
+            return true;
+        }
+        default:
+            return true;
+    }
+}
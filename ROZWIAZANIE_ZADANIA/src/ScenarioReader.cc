@@ -0,0 +1,348 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of ScenarioReader class.
+*/
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include "ScenarioReader.h"
+#include "MowerController.h"
+#include "Exceptions.h"
+
+using namespace std;
+
+namespace {
+    constexpr double MAX_ROTATION_ANGLE = 360.0;
+    constexpr double FULL_ANGLE = 360.0;
+
+    const char* skipSpaces(const char* cursor) {
+        while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r') {
+            ++cursor;
+        }
+        return cursor;
+    }
+
+    // Finds the next word. The cursor is moved after the word.
+    bool readWord(const char*& cursor, const char*& out_word, size_t& out_length) {
+        cursor = skipSpaces(cursor);
+        out_word = cursor;
+        while (*cursor != '\0' && *cursor != ' ' && *cursor != '\t' && *cursor != '\r') {
+            ++cursor;
+        }
+        out_length = static_cast<size_t>(cursor - out_word);
+        return out_length > 0;
+    }
+
+    bool readNumber(const char*& cursor, double& out_value) {
+        cursor = skipSpaces(cursor);
+        char* number_end = nullptr;
+        out_value = strtod(cursor, &number_end);
+        if (number_end == cursor || !isfinite(out_value)) {
+            return false;
+        }
+        cursor = number_end;
+        return *cursor == '\0' || *cursor == ' ' || *cursor == '\t' || *cursor == '\r';
+    }
+
+    bool readInteger(const char*& cursor, double min_value, double max_value, double& out_value) {
+        return readNumber(cursor, out_value) && out_value == floor(out_value) &&
+            out_value >= min_value && out_value <= max_value;
+    }
+
+    bool isWord(const char* word, size_t length, const char* expected) {
+        return strlen(expected) == length && strncmp(word, expected, length) == 0;
+    }
+
+    bool isLineEnd(const char* cursor) {
+        return *skipSpaces(cursor) == '\0';
+    }
+}
+
+// Binary scenarios start with a magic string, every other file is parsed as a text scenario.
+ScenarioReader::ScenarioReader(const string& path)
+    : read_buffer_(READ_BUFFER_SIZE), path_(path), format_(ScenarioFormat::TEXT) {
+    stream_.rdbuf()->pubsetbuf(read_buffer_.data(), read_buffer_.size());
+    stream_.open(path, ios::in | ios::binary);
+    if (!stream_.is_open()) {
+        throw ScenarioFormatError("Unable to open scenario " + path);
+    }
+
+    char magic[sizeof(ScenarioCommand::BINARY_SCENARIO_MAGIC)] = {};
+    stream_.read(magic, sizeof(magic));
+    bool is_binary = stream_.gcount() == sizeof(magic) &&
+        memcmp(magic, ScenarioCommand::BINARY_SCENARIO_MAGIC, sizeof(magic)) == 0;
+    stream_.clear();
+    stream_.seekg(0);
+
+    if (is_binary) {
+        format_ = ScenarioFormat::BINARY;
+        if (!ScenarioCommand::readBinaryHeader(stream_, parameters_)) {
+            throw ScenarioFormatError("Scenario " + path + " has a damaged header");
+        }
+    } else {
+        readTextParameters();
+    }
+
+    if (parameters_.lawn_width_ == 0 || parameters_.lawn_length_ == 0 || parameters_.mower_width_ == 0 ||
+        parameters_.mower_length_ == 0 || parameters_.blade_diameter_ == 0 || parameters_.speed_ == 0) {
+        throw ScenarioFormatError("Scenario " + path + " does not define the lawn and the mower");
+    }
+}
+
+ScenarioFormat ScenarioReader::getFormat() const {
+    return format_;
+}
+
+const ScenarioParameters& ScenarioReader::getParameters() const {
+    return parameters_;
+}
+
+// True when all commands of the scenario have been read.
+bool ScenarioReader::isFinished() const {
+    return is_finished_ && !has_pending_command_;
+}
+
+unsigned long ScenarioReader::getReadCommandsNumber() const {
+    return read_commands_number_;
+}
+
+// Reads the next command. Returns false at the end of the scenario.
+bool ScenarioReader::readCommand(ScenarioCommand& out_command) {
+    if (has_pending_command_) {
+        out_command = pending_command_;
+        has_pending_command_ = false;
+        ++read_commands_number_;
+        return true;
+    }
+    if (is_finished_) {
+        return false;
+    }
+
+    bool is_read = format_ == ScenarioFormat::TEXT ? readTextCommand(out_command) : readBinaryCommand(out_command);
+    if (!is_read) {
+        is_finished_ = true;
+        return false;
+    }
+    ++read_commands_number_;
+    return true;
+}
+
+// Pushes at most max_commands next commands to the controller. Returns the number of pushed commands.
+size_t ScenarioReader::feed(MowerController& controller, size_t max_commands) {
+    ScenarioCommand command;
+    size_t pushed_commands_number = 0;
+    while (pushed_commands_number < max_commands && readCommand(command)) {
+        pushCommand(controller, command);
+        ++pushed_commands_number;
+    }
+    return pushed_commands_number;
+}
+
+// Called in every simulation step. The queue of the controller is filled up to FEED_BATCH_SIZE commands
+// when less than half of a batch is waiting, so memory used by the queue does not depend on the scenario.
+size_t ScenarioReader::feedController(MowerController& controller) {
+    size_t queue_size = controller.getQueueSize();
+    if (isFinished() || queue_size >= FEED_BATCH_SIZE / 2) {
+        return 0;
+    }
+    return feed(controller, FEED_BATCH_SIZE - queue_size);
+}
+
+// Parameters are read until the first command, which is kept for readCommand.
+void ScenarioReader::readTextParameters() {
+    while (readTextLine()) {
+        const char* cursor = line_.c_str();
+        const char* keyword;
+        size_t keyword_length;
+        readWord(cursor, keyword, keyword_length);
+
+        if (!parseTextParameter(keyword, keyword_length, cursor)) {
+            pending_command_ = parseTextCommand(keyword, keyword_length, cursor);
+            has_pending_command_ = true;
+            return;
+        }
+    }
+    is_finished_ = true;
+}
+
+// Reads the next line which is not empty. Comments are cut off. The line is kept in line_,
+// which is reused, so reading lines does not allocate.
+bool ScenarioReader::readTextLine() {
+    while (getline(stream_, line_)) {
+        ++line_number_;
+        size_t comment_position = line_.find('#');
+        if (comment_position != string::npos) {
+            line_.erase(comment_position);
+        }
+        if (!isLineEnd(line_.c_str())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ScenarioReader::parseTextParameter(const char* keyword, size_t keyword_length, const char* cursor) {
+    constexpr double MAX_SIZE = numeric_limits<unsigned int>::max();
+    double values[4];
+
+    if (isWord(keyword, keyword_length, "lawn")) {
+        if (!readInteger(cursor, 1.0, MAX_SIZE, values[0]) || !readInteger(cursor, 1.0, MAX_SIZE, values[1]) ||
+            !isLineEnd(cursor)) {
+            throwLineError("expected: lawn <width_cm> <length_cm>");
+        }
+        parameters_.lawn_width_ = static_cast<unsigned int>(values[0]);
+        parameters_.lawn_length_ = static_cast<unsigned int>(values[1]);
+        return true;
+    }
+    if (isWord(keyword, keyword_length, "mower")) {
+        for (double& value : values) {
+            if (!readInteger(cursor, 1.0, MAX_SIZE, value)) {
+                throwLineError("expected: mower <width_cm> <length_cm> <blade_diameter_cm> <speed_cm_s>");
+            }
+        }
+        if (!isLineEnd(cursor)) {
+            throwLineError("expected: mower <width_cm> <length_cm> <blade_diameter_cm> <speed_cm_s>");
+        }
+        parameters_.mower_width_ = static_cast<unsigned int>(values[0]);
+        parameters_.mower_length_ = static_cast<unsigned int>(values[1]);
+        parameters_.blade_diameter_ = static_cast<unsigned int>(values[2]);
+        parameters_.speed_ = static_cast<unsigned int>(values[3]);
+        return true;
+    }
+    if (isWord(keyword, keyword_length, "start")) {
+        if (!readNumber(cursor, values[0]) || !readNumber(cursor, values[1]) ||
+            !readInteger(cursor, 0.0, FULL_ANGLE - 1.0, values[2]) || !isLineEnd(cursor)) {
+            throwLineError("expected: start <x_cm> <y_cm> <angle_deg>");
+        }
+        parameters_.starting_x_ = values[0];
+        parameters_.starting_y_ = values[1];
+        parameters_.starting_angle_ = static_cast<unsigned short>(values[2]);
+        return true;
+    }
+    return false;
+}
+
+ScenarioCommand ScenarioReader::parseTextCommand(const char* keyword, size_t keyword_length,
+    const char* cursor) const {
+    ScenarioCommandType type = ScenarioCommandType::COMMAND_TYPES_NUMBER;
+
+    if (isWord(keyword, keyword_length, "mowing")) {
+        const char* option;
+        size_t option_length;
+        readWord(cursor, option, option_length);
+        if (isWord(option, option_length, "on")) {
+            type = ScenarioCommandType::MOWING_ON;
+        } else if (isWord(option, option_length, "off")) {
+            type = ScenarioCommandType::MOWING_OFF;
+        } else {
+            throwLineError("expected: mowing on|off");
+        }
+    } else {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(ScenarioCommandType::COMMAND_TYPES_NUMBER); ++i) {
+            ScenarioCommandType candidate = static_cast<ScenarioCommandType>(i);
+            if (isWord(keyword, keyword_length, ScenarioCommand::getKeyword(candidate))) {
+                type = candidate;
+                break;
+            }
+        }
+        if (type == ScenarioCommandType::COMMAND_TYPES_NUMBER) {
+            throwLineError("unknown command '" + string(keyword, keyword_length) + "'");
+        }
+    }
+
+    double values[2] = {0.0, 0.0};
+    bool are_values_valid = true;
+    switch (type) {
+        case ScenarioCommandType::MOVE:
+            are_values_valid = readNumber(cursor, values[0]);
+            break;
+        case ScenarioCommandType::ROTATE:
+            are_values_valid = readInteger(cursor, -MAX_ROTATION_ANGLE, MAX_ROTATION_ANGLE, values[0]);
+            break;
+        case ScenarioCommandType::ADD_POINT:
+        case ScenarioCommandType::ARC:
+            are_values_valid = readNumber(cursor, values[0]) && readNumber(cursor, values[1]);
+            break;
+        case ScenarioCommandType::DELETE_POINT:
+        case ScenarioCommandType::MOVE_TO_POINT:
+        case ScenarioCommandType::ROTATE_TOWARDS_POINT:
+        case ScenarioCommandType::GET_DISTANCE_TO_POINT:
+            are_values_valid = readInteger(cursor, 0.0, numeric_limits<unsigned int>::max(), values[0]);
+            break;
+        default:
+            break;
+    }
+    if (!are_values_valid || !isLineEnd(cursor)) {
+        throwLineError("wrong values of '" + string(ScenarioCommand::getKeyword(type)) + "'");
+    }
+    return ScenarioCommand(type, values[0], values[1]);
+}
+
+bool ScenarioReader::readTextCommand(ScenarioCommand& out_command) {
+    if (!readTextLine()) {
+        return false;
+    }
+    const char* cursor = line_.c_str();
+    const char* keyword;
+    size_t keyword_length;
+    readWord(cursor, keyword, keyword_length);
+    out_command = parseTextCommand(keyword, keyword_length, cursor);
+    return true;
+}
+
+bool ScenarioReader::readBinaryCommand(ScenarioCommand& out_command) {
+    if (stream_.peek() == ifstream::traits_type::eof()) {
+        return false;
+    }
+    if (!out_command.readBinary(stream_)) {
+        throw ScenarioFormatError("Scenario " + path_ + " is damaged after " +
+            to_string(read_commands_number_) + " commands");
+    }
+    return true;
+}
+
+void ScenarioReader::pushCommand(MowerController& controller, const ScenarioCommand& command) {
+    switch (command.getType()) {
+        case ScenarioCommandType::MOVE:
+            controller.move(command.getValue(0));
+            break;
+        case ScenarioCommandType::ROTATE:
+            controller.rotate(static_cast<short>(command.getValue(0)));
+            break;
+        case ScenarioCommandType::MOWING_ON:
+            controller.setMowing(true);
+            break;
+        case ScenarioCommandType::MOWING_OFF:
+            controller.setMowing(false);
+            break;
+        case ScenarioCommandType::ADD_POINT:
+            controller.addPoint(command.getValue(0), command.getValue(1));
+            break;
+        case ScenarioCommandType::DELETE_POINT:
+            controller.deletePoint(static_cast<unsigned int>(command.getValue(0)));
+            break;
+        case ScenarioCommandType::MOVE_TO_POINT:
+            controller.moveToPoint(static_cast<unsigned int>(command.getValue(0)));
+            break;
+        case ScenarioCommandType::ROTATE_TOWARDS_POINT:
+            controller.rotateTowardsPoint(static_cast<unsigned int>(command.getValue(0)));
+            break;
+        case ScenarioCommandType::GET_DISTANCE_TO_POINT:
+            controller.getDistanceToPoint(static_cast<unsigned int>(command.getValue(0)), distance_result_);
+            break;
+        case ScenarioCommandType::GET_CURRENT_POSITION:
+            controller.getCurrentPosition(x_result_, y_result_);
+            break;
+        case ScenarioCommandType::ARC:
+            controller.moveAlongArc(command.getValue(0), command.getValue(1));
+            break;
+        default:
+            break;
+    }
+}
+
+void ScenarioReader::throwLineError(const string& message) const {
+    throw ScenarioFormatError("Scenario " + path_ + ", line " + to_string(line_number_) + ": " + message);
+}
@@ -0,0 +1,53 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of ScenarioWriter class.
+*/
+
+#include "ScenarioWriter.h"
+#include "Exceptions.h"
+
+using namespace std;
+
+// Parameters of the scenario are written at once, commands are appended with write.
+ScenarioWriter::ScenarioWriter(const string& path, const ScenarioParameters& parameters, ScenarioFormat format)
+    : write_buffer_(WRITE_BUFFER_SIZE), path_(path), format_(format) {
+    stream_.rdbuf()->pubsetbuf(write_buffer_.data(), write_buffer_.size());
+    stream_.open(path, ios::out | ios::trunc | ios::binary);
+    if (!stream_.is_open()) {
+        throw ScenarioFormatError("Unable to create scenario " + path);
+    }
+
+    if (format_ == ScenarioFormat::BINARY) {
+        ScenarioCommand::writeBinaryHeader(stream_, parameters);
+    } else {
+        ScenarioCommand::writeTextParameters(stream_, parameters);
+    }
+}
+
+ScenarioFormat ScenarioWriter::getFormat() const {
+    return format_;
+}
+
+unsigned long ScenarioWriter::getWrittenCommandsNumber() const {
+    return written_commands_number_;
+}
+
+void ScenarioWriter::write(const ScenarioCommand& command) {
+    if (format_ == ScenarioFormat::BINARY) {
+        command.writeBinary(stream_);
+    } else {
+        command.writeTextLine(stream_);
+    }
+    ++written_commands_number_;
+}
+
+// Flushes the buffer and closes the file. Called by the destructor of the stream when it is not called earlier.
+void ScenarioWriter::close() {
+    if (!stream_.is_open()) {
+        return;
+    }
+    stream_.close();
+    if (stream_.fail()) {
+        throw ScenarioFormatError("Unable to write scenario " + path_);
+    }
+}
@@ -162,6 +162,7 @@ double StateInterpolator::calculateInterpolationAlpha( const SimulationSnapshot&
 // Mixes two snapshots together based on the blend factor (alpha).
 // Creates a new snapshot with blended position and angle. The lawn state and points
 // are copied from the end snapshot (no blending needed for discrete data).
+// Other mowers of a fleet are blended only when both snapshots contain the same mowers.
 SimulationSnapshot StateInterpolator::blendSnapshots( const SimulationSnapshot& start, const SimulationSnapshot& end, double alpha, double render_time ) const {
     SimulationSnapshot result = end; 
     
@@ -169,6 +170,15 @@ SimulationSnapshot StateInterpolator::blendSnapshots( const SimulationSnapshot&
     result.y_ = interpolate( start.y_, end.y_, alpha );
     result.angle_ = interpolateAngle( start.angle_, end.angle_, alpha );
     result.simulation_time_ = render_time;
+
+    if( start.other_mowers_.size() == end.other_mowers_.size() ){
+        for( size_t i = 0; i < result.other_mowers_.size(); ++i ){
+            result.other_mowers_[i].x_ = interpolate( start.other_mowers_[i].x_, end.other_mowers_[i].x_, alpha );
+            result.other_mowers_[i].y_ = interpolate( start.other_mowers_[i].y_, end.other_mowers_[i].y_, alpha );
+            result.other_mowers_[i].angle_ = interpolateAngle( start.other_mowers_[i].angle_, 
+                end.other_mowers_[i].angle_, alpha );
+        }
+    }
     
     return result;
 }
@@ -190,3 +200,12 @@ double StateInterpolator::interpolateAngle( double start_angle, double end_angle
     
     return start_angle + diff * alpha;
 }
+
+size_t StateInterpolator::getBufferedSnapshotsCount() const {
+    lock_guard<mutex> lock( mutex_ );
+    return sim_snapshot_buffer_.size();
+}
+
+size_t StateInterpolator::getBufferCapacity() {
+    return MAX_BUFFER_SIZE;
+}
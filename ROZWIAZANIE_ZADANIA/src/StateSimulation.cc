@@ -5,6 +5,8 @@
 
 */
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 #include <optional>
@@ -13,6 +15,7 @@
 #include "Point.h"
 #include "Lawn.h"
 #include "Logger.h"
+#include "LogRecord.h"
 #include "MathHelper.h"
 #include "Exceptions.h"
 
@@ -20,7 +23,11 @@ using namespace std;
 
 
 StateSimulation::StateSimulation(Lawn& lawn, Mower& mower, Logger& logger, FileLogger& file_logger) : lawn_(lawn),
-    mower_(mower), logger_(logger), file_logger_(file_logger), time_(0), points_(vector<Point>()), next_point_id_(0) {}
+    mower_(mower), logger_(logger), file_logger_(file_logger), time_(0), points_(),
+    point_index_(lawn.getWidth(), lawn.getLength()), next_point_id_(0), cutting_time_ms_(0.0), is_fast_forward_(false),
+    is_cutting_deferred_(false),
+    navigation_graph_(lawn.getObstacleMap(), lawn.getWidth(), lawn.getLength(), mower.getBladeDiameter() / 2.0),
+    pass_id_(lawn.getPassId()) {}
 
 
 bool StateSimulation::operator==(const StateSimulation& other) const{
@@ -59,7 +66,7 @@ const u_int64_t& StateSimulation::getTime() const {
 
 
 const vector<Point>& StateSimulation::getPoints() const {
-    return points_;
+    return points_.getPoints();
 }
 
 
@@ -73,6 +80,79 @@ const FileLogger& StateSimulation::getFileLogger() const {
 }
 
 
+const double& StateSimulation::getCuttingTimeMs() const {
+    return cutting_time_ms_;
+}
+
+
+bool StateSimulation::isFastForward() const {
+    return is_fast_forward_;
+}
+
+
+void StateSimulation::setFastForward(const bool& enable) {
+    is_fast_forward_ = enable;
+}
+
+
+void StateSimulation::setSnapshotCallback(std::function<void(const SimulationSnapshot&)> callback) {
+    snapshot_callback_ = callback;
+}
+
+
+bool StateSimulation::isCuttingDeferred() const {
+    return is_cutting_deferred_;
+}
+
+
+void StateSimulation::setCuttingDeferred(const bool& enable) {
+    is_cutting_deferred_ = enable;
+}
+
+
+const vector<pair<unsigned int, unsigned int>>& StateSimulation::getPendingFields() const {
+    return pending_fields_;
+}
+
+
+void StateSimulation::clearPendingFields() {
+    pending_fields_.clear();
+}
+
+
+void StateSimulation::cutPendingFields() {
+    /* Cut the fields collected while cutting was deferred as a part of the pass of this mower. A pass begun 
+        during the collection starts on the lawn now */
+
+    lawn_.setPassId(pass_id_);
+    if (pending_pass_beginning_) {
+        pass_id_ = lawn_.beginPass(*pending_pass_beginning_, mower_.getBladeDiameter());
+        pending_pass_beginning_.reset();
+    }
+    lawn_.cutFields(pending_fields_);
+    pending_fields_.clear();
+}
+
+
+uint32_t StateSimulation::getPassId() const {
+    return pass_id_;
+}
+
+
+void StateSimulation::beginPass() {
+    /* Begin a new pass of the blade in the current position of the mower. Fields which the new pass cuts again
+        are counted by the lawn as mowed more than once */
+
+    pair<double, double> blade_middle = pair<double, double>(mower_.getX(), mower_.getY());
+    if (is_cutting_deferred_) {
+        pending_pass_beginning_ = blade_middle;
+        return;
+    }
+    lawn_.setPassId(pass_id_);
+    pass_id_ = lawn_.beginPass(blade_middle, mower_.getBladeDiameter());
+}
+
+
 void StateSimulation::simulateMovement(const double& distance) {
     /* Simulate movement of the mower. Handles situation when mower tries to go out of the lawn.
         Sends logs to file logger */
@@ -81,34 +161,237 @@ void StateSimulation::simulateMovement(const double& distance) {
     double begginning_y = mower_.getY();
     short angle = mower_.getAngle();
     double optional_distance = distance;
-    string message;
 
     try {
-        mower_.move(distance, lawn_.getWidth(), lawn_.getLength());
-
-        message = "Distance moved: " + to_string(distance) + "from point x: " + to_string(begginning_x) + 
-            ", y: " + to_string(begginning_y);
+        mower_.move(distance, lawn_);
     } catch (const MoveOutsideLawnError& e) {
-        Log log = Log(time_, "Attempted to move outside the lawn.");
-        logger_.push(log);
-        file_logger_.saveLog(log);
+        logMoveOutsideLawn();
         throw; 
+    } catch (const ObstacleCollisionError& e) {
+        logMoveIntoObstacle();
+        throw;
     }
 
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    file_logger_.saveRecord(LogRecord(LogEventType::MOVED, time_, distance, begginning_x, begginning_y));
 
     calculateMovementTime(optional_distance);
 
     if (mower_.getIsMowing()) {
         pair<double, double> beginning_point = pair<double, double>(begginning_x, begginning_y);
         pair<double, double> ending_point = pair<double, double>(mower_.getX(), mower_.getY());
-        lawn_.cutGrassSection(beginning_point, mower_.getBladeDiameter(), ending_point, angle);
+        cutSection(beginning_point, ending_point, angle);
     }
     
 }
 
 
+void StateSimulation::simulateLineMovement(const double& x, const double& y) {
+    /* Simulate straight movement to the given point. Unlike simulateMovement, the mower reaches exactly the given
+        point, the angle of the mower is only rounded to whole degrees. Used by curves built of straight parts */
+
+    double beginning_x = mower_.getX();
+    double beginning_y = mower_.getY();
+    double dx = x - beginning_x;
+    double dy = y - beginning_y;
+    double distance = sqrt(dx * dx + dy * dy);
+    unsigned short angle = mower_.getAngle();
+    if (distance > Constants::DISTANCE_PRECISION) {
+        angle = roundAngle(MathHelper::convertRadiansToDegrees(atan2(dx, dy)));
+    }
+    if (angle != mower_.getAngle()) {
+        beginPass();
+    }
+
+    placeMower(x, y, angle);
+    file_logger_.saveRecord(LogRecord(LogEventType::MOVED, time_, distance, beginning_x, beginning_y));
+    calculateMovementTime(distance);
+
+    if (mower_.getIsMowing()) {
+        cutSection(pair<double, double>(beginning_x, beginning_y), pair<double, double>(x, y), angle);
+    }
+}
+
+
+void StateSimulation::simulateArcMovement(const pair<double, double>& arc_middle, const double& radius,
+    const double& beginning_angle, const double& sweep_angle) {
+    /* Simulate movement along an arc. The mower is on the arc at beginning_angle (measured from the middle 
+        of the arc like the angle of the mower) and it moves by sweep_angle, clockwise when it is positive.
+        The area swept by the blade is cut as one arc */
+
+    double RIGHT_ANGLE = 90.0;
+
+    double beginning_x = mower_.getX();
+    double beginning_y = mower_.getY();
+    double ending_angle = beginning_angle + sweep_angle;
+    double ending_radians = MathHelper::convertFractionalDegreesToRadians(ending_angle);
+    double x = arc_middle.first + radius * sin(ending_radians);
+    double y = arc_middle.second + radius * cos(ending_radians);
+    double heading = sweep_angle >= 0.0 ? ending_angle + RIGHT_ANGLE : ending_angle - RIGHT_ANGLE;
+    double distance = radius * MathHelper::convertFractionalDegreesToRadians(abs(sweep_angle));
+
+    checkArcInLawn(arc_middle, radius, beginning_angle, sweep_angle);
+    checkArcCollision(arc_middle, radius, beginning_angle, sweep_angle);
+    placeMower(x, y, roundAngle(heading));
+    file_logger_.saveRecord(LogRecord(LogEventType::MOVED, time_, distance, beginning_x, beginning_y));
+    calculateMovementTime(distance);
+
+    if (mower_.getIsMowing()) {
+        chrono::steady_clock::time_point cutting_start = chrono::steady_clock::now();
+        if (is_cutting_deferred_) {
+            lawn_.collectGrassArc(arc_middle, radius, beginning_angle, sweep_angle, mower_.getBladeDiameter(),
+                pending_fields_);
+        }
+        else {
+            lawn_.cutGrassArc(arc_middle, radius, beginning_angle, sweep_angle, mower_.getBladeDiameter());
+        }
+        cutting_time_ms_ += chrono::duration<double, milli>(chrono::steady_clock::now() - cutting_start).count();
+    }
+}
+
+
+void StateSimulation::placeMower(const double& x, const double& y, const unsigned short& angle) {
+    // Move the mower to the point calculated by a curved move
+
+    try {
+        mower_.moveToPose(x, y, angle, lawn_);
+    } catch (const MoveOutsideLawnError& e) {
+        logMoveOutsideLawn();
+        throw;
+    } catch (const ObstacleCollisionError& e) {
+        logMoveIntoObstacle();
+        throw;
+    }
+}
+
+
+void StateSimulation::checkArcInLawn(const pair<double, double>& arc_middle, const double& radius,
+    const double& beginning_angle, const double& sweep_angle) {
+    /* Check that the arc does not leave the lawn between its ends. The arc reaches the furthest left, right,
+        bottom and top at multiples of RIGHT_ANGLE, so only these points inside the swept range are checked */
+
+    double RIGHT_ANGLE = 90.0;
+
+    double lowest_angle = min(beginning_angle, beginning_angle + sweep_angle);
+    double highest_angle = max(beginning_angle, beginning_angle + sweep_angle);
+    for (double extreme_angle = (floor(lowest_angle / RIGHT_ANGLE) + 1) * RIGHT_ANGLE; 
+        extreme_angle < highest_angle; extreme_angle += RIGHT_ANGLE) {
+        double radians = MathHelper::convertFractionalDegreesToRadians(extreme_angle);
+        double x = arc_middle.first + radius * sin(radians);
+        double y = arc_middle.second + radius * cos(radians);
+        if (!mower_.isPointAccessible(x, y, lawn_)) {
+            logMoveOutsideLawn();
+            throw MoveOutsideLawnError("Attempted to move outside the lawn.");
+        }
+    }
+}
+
+
+void StateSimulation::checkArcCollision(const pair<double, double>& arc_middle, const double& radius,
+    const double& beginning_angle, const double& sweep_angle) {
+    /* Check the arc against obstacles as short chords, the last chord is checked when the mower is placed.
+        Chords of ARC_CHECK_STEP degrees are at most 0.1% of the radius away from the arc */
+
+    double ARC_CHECK_STEP = 5.0;
+    const ObstacleMap& obstacle_map = lawn_.getObstacleMap();
+    if (obstacle_map.isEmpty()) return;
+
+    unsigned int chords_number = static_cast<unsigned int>(ceil(abs(sweep_angle) / ARC_CHECK_STEP));
+    double blade_radius = mower_.getBladeDiameter() / 2.0;
+    pair<double, double> chord_beginning = pair<double, double>(mower_.getX(), mower_.getY());
+    for (unsigned int i = 1; i < chords_number; i ++) {
+        double chord_angle = beginning_angle + sweep_angle * i / chords_number;
+        double radians = MathHelper::convertFractionalDegreesToRadians(chord_angle);
+        pair<double, double> chord_ending = pair<double, double>(arc_middle.first + radius * sin(radians),
+            arc_middle.second + radius * cos(radians));
+        if (obstacle_map.isSegmentBlocked(chord_beginning, chord_ending, blade_radius)) {
+            logMoveIntoObstacle();
+            throw ObstacleCollisionError("Attempted to move into an obstacle.");
+        }
+        chord_beginning = chord_ending;
+    }
+}
+
+
+void StateSimulation::cutSection(const pair<double, double>& beginning_point, 
+    const pair<double, double>& ending_point, const unsigned short& angle) {
+    // Cut the grass under the blade moving straight, or only collect the fields when cutting is deferred
+
+    chrono::steady_clock::time_point cutting_start = chrono::steady_clock::now();
+    if (is_cutting_deferred_) {
+        lawn_.collectGrassSection(beginning_point, mower_.getBladeDiameter(), ending_point, angle, 
+            pending_fields_);
+    }
+    else {
+        lawn_.cutGrassSection(beginning_point, mower_.getBladeDiameter(), ending_point, angle);
+    }
+    cutting_time_ms_ += chrono::duration<double, milli>(chrono::steady_clock::now() - cutting_start).count();
+}
+
+
+void StateSimulation::logMoveOutsideLawn() {
+    LogRecord record(LogEventType::MOVED_OUTSIDE_LAWN, time_);
+    logger_.push(Log(time_, record.formatMessage()));
+    file_logger_.saveRecord(record);
+}
+
+
+void StateSimulation::logMoveIntoObstacle() {
+    LogRecord record(LogEventType::MOVED_INTO_OBSTACLE, time_);
+    logger_.push(Log(time_, record.formatMessage()));
+    file_logger_.saveRecord(record);
+}
+
+
+unsigned short StateSimulation::roundAngle(const double& angle) {
+    // Round the angle to whole degrees in [0; 359] range
+
+    return static_cast<unsigned short>(MathHelper::normalizeAngle(round(MathHelper::normalizeAngle(angle))));
+}
+
+
+void StateSimulation::simulateSegment(const double& distance) {
+    /* Simulate whole straight segment as one movement with one cut and one log. When a snapshot callback
+        is set (the simulation is visualized), poses along the segment are sent to it, so the mower
+        does not jump to the end of the segment */
+
+    double beginning_x = mower_.getX();
+    double beginning_y = mower_.getY();
+    u_int64_t beginning_time = time_;
+
+    simulateMovement(distance);
+
+    emitIntermediateSnapshots(beginning_x, beginning_y, beginning_time);
+}
+
+
+void StateSimulation::emitIntermediateSnapshots(const double& beginning_x, const double& beginning_y, 
+        const u_int64_t& beginning_time) const {
+    /* Send evenly spaced poses between the beginning of the segment and the current pose. The number
+        of snapshots is limited, so they do not push older snapshots out of the interpolator buffer.
+        The snapshot of the end of the segment is not sent, it is created by the engine after the step */
+
+    double MIN_SNAPSHOT_INTERVAL_MS = Constants::DEFAULT_TIMESTEP * 1000.0;
+    unsigned int MAX_INTERMEDIATE_SNAPSHOTS = 25;
+
+    double segment_time = static_cast<double>(time_ - beginning_time);
+    if (!snapshot_callback_ || segment_time <= MIN_SNAPSHOT_INTERVAL_MS) return;
+
+    unsigned int intervals_number = min(MAX_INTERMEDIATE_SNAPSHOTS, 
+        static_cast<unsigned int>(segment_time / MIN_SNAPSHOT_INTERVAL_MS));
+    SimulationSnapshot sim_snapshot = buildSimulationSnapshot();
+    double ending_x = sim_snapshot.x_;
+    double ending_y = sim_snapshot.y_;
+
+    for (unsigned int i = 1; i < intervals_number; i ++) {
+        double progress = static_cast<double>(i) / intervals_number;
+        sim_snapshot.x_ = beginning_x + (ending_x - beginning_x) * progress;
+        sim_snapshot.y_ = beginning_y + (ending_y - beginning_y) * progress;
+        sim_snapshot.simulation_time_ = static_cast<double>(beginning_time) + segment_time * progress;
+        snapshot_callback_(sim_snapshot);
+    }
+}
+
+
 double StateSimulation::countDistanceToBorder(const double& distance) const {
     // Count distance to the closest border of the lawn
 
@@ -171,34 +454,32 @@ void StateSimulation::simulateRotation(const short& angle) {
 
     short beginning_angle = mower_.getAngle();
     u_int64_t time = time_;
-    string message;
 
     try {
         mower_.rotate(angle);
+        if (angle != 0) {
+            beginPass();
+        }
 
-        message = "Rotated: " + to_string(angle) + " degrees.";
-        
         calculateRotationTime(angle);
+        file_logger_.saveRecord(LogRecord(LogEventType::ROTATED, time, angle));
     }
     catch (const RotationAngleOutOfRangeError& e) {
-        message = "Invalid angle. Rotation angle must be in [-360; 360] range.";
+        LogRecord record(LogEventType::INVALID_ROTATION_ANGLE, time);
 
-        logger_.push(Log(time, message));
+        logger_.push(Log(time, record.formatMessage()));
+        file_logger_.saveRecord(record);
     }
-
-    Log log = Log(time, message);
-    file_logger_.saveLog(log);
 }
 
 
 void StateSimulation::calculateRotationTime(const short& angle) { 
     // Calculate time of the rotation action
 
-    short MAX_ROTATION_ANGLE = 360;
     double SECONDS_TO_MILISECONDS_MULTIPLIER = 1000;
-    short positive_angle = (angle + MAX_ROTATION_ANGLE) % MAX_ROTATION_ANGLE;
 
-    double time_ms = positive_angle * SECONDS_TO_MILISECONDS_MULTIPLIER / Constants::ROTATION_SPEED;
+    // rotation by a negative angle is a rotation to the other side, not a longer rotation
+    double time_ms = abs(angle) * SECONDS_TO_MILISECONDS_MULTIPLIER / Constants::ROTATION_SPEED;
     u_int64_t result_time = u_int64_t(ceil(time_ms / 10.0) * 10.0);
 
     time_ += result_time;
@@ -210,9 +491,7 @@ void StateSimulation::simulateMowingOptionOn() {
 
     mower_.turnOnMowing();
 
-    string message = "Mowing mode: on";
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    file_logger_.saveRecord(LogRecord(LogEventType::MOWING_ON, time_));
 }
 
 
@@ -221,57 +500,42 @@ void StateSimulation::simulateMowingOptionOff() {
 
     mower_.turnOffMowing();
 
-    string message = "Mowing mode: off";
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    file_logger_.saveRecord(LogRecord(LogEventType::MOWING_OFF, time_));
 }
 
 
 void StateSimulation::simulateAddPoint(const double& x, const double& y) {
     // Simulate adding point on the law
 
-    string message;
-
     if(lawn_.isPointInLawn(x, y)) {
-        points_.push_back(Point(x, y, next_point_id_));
-
-        message = "Added point with id: " + to_string(next_point_id_) + "on coordinates x: " + to_string(x) + 
-            ", y: " + to_string(y);
+        points_.addPoint(Point(x, y, next_point_id_));
+        point_index_.addPoint(Point(x, y, next_point_id_));
+        navigation_graph_.addPoint(next_point_id_, pair<double, double>(x, y));
 
         next_point_id_ ++;
     }
     else {
-        message = "Unable to add point outside the lawn.";
-        logger_.push(Log(time_, message));
-    }
+        LogRecord record(LogEventType::POINT_OUTSIDE_LAWN, time_);
 
-    Log log = Log(time_, message);
+        logger_.push(Log(time_, record.formatMessage()));
+    }
 }
 
 void StateSimulation::simulateDeletePoint(const unsigned int& id) {
     // Simulates deleting point from the lawn
 
-    bool is_found = false;
-    string message;
+    const Point* point = points_.findPoint(id);
 
-    for (auto iterator = points_.begin(); iterator != points_.end(); ) {
-        if (iterator->getId() == id) {
-            iterator = points_.erase(iterator);
-            is_found = true;
-        } 
-        else {
-            ++iterator;
-        }
-    }
-    if (!is_found) {
-        message = "Unable to delete point from lawn. Incorrect point's id: " + to_string(id);
-        logger_.push(Log(time_, message));
+    if (point == nullptr) {
+        LogRecord record(LogEventType::POINT_NOT_DELETED, time_, id);
+
+        logger_.push(Log(time_, record.formatMessage()));
     }
     else {
-        message = "Deleted point with id: " + to_string(id);
+        point_index_.deletePoint(*point);
+        points_.deletePoint(id);
+        navigation_graph_.removePoint(id);
     }
-
-    Log log = Log(time_, message);
 }
 
 
@@ -280,36 +544,24 @@ void StateSimulation::simulateMovementToPoint(const unsigned int& id) {
         As it is impossible to move exactly to the given point with rotation tolerance, which equals 1 degree, 
         the mower is getting closer during each iteration so as to reach the given point*/
 
-    bool is_found = false;
-    double x;
-    double y;
-    string message;
-
-    for (const Point& point : points_) {
-        if (point.getId() == id) {
-            x = point.getX();
-            y = point.getY();
-            is_found = true;
-            break;
-        }
-    }
-    if (!is_found) {
-        message = "Unable to find point in the lawn. Incorrect point's id " + to_string(id);
-        Log log = Log(time_, message);
+    const Point* point = points_.findPoint(id);
+    if (point == nullptr) {
+        LogRecord record(LogEventType::POINT_NOT_FOUND, time_, id);
 
-        logger_.push(log);
-        file_logger_.saveLog(log);
+        logger_.push(Log(time_, record.formatMessage()));
+        file_logger_.saveRecord(record);
         return;
     }
 
-    while (abs(x - mower_.getX()) > Constants::DISTANCE_PRECISION || 
-        abs(y - mower_.getY()) > Constants::DISTANCE_PRECISION) {
-        moveToPointAttempt(x, y);
+    pair<double, double> target(point->getX(), point->getY());
+    for (const pair<double, double>& waypoint : planPath(id, target)) {
+        while (abs(waypoint.first - mower_.getX()) > Constants::DISTANCE_PRECISION || 
+            abs(waypoint.second - mower_.getY()) > Constants::DISTANCE_PRECISION) {
+            moveToPointAttempt(waypoint.first, waypoint.second);
+        }
     }
 
-    message = "Moving to point with id:  " + to_string(id);
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    file_logger_.saveRecord(LogRecord(LogEventType::MOVING_TO_POINT, time_, id));
 }
 
 
@@ -324,6 +576,23 @@ void StateSimulation::moveToPointAttempt(const double& x, const double& y) {
 }
 
 
+vector<pair<double, double>> StateSimulation::planPath(const unsigned int& id, const pair<double, double>& target) {
+    /* Plan the way to the point around obstacles, the last waypoint is the point. When obstacles separate
+        the mower from the point, the mower goes straight and the move is stopped at the obstacle */
+
+    if (lawn_.getObstacleMap().isEmpty()) {
+        return vector<pair<double, double>>{target};
+    }
+
+    vector<pair<double, double>> waypoints = navigation_graph_.findPathToPoint(
+        pair<double, double>(mower_.getX(), mower_.getY()), id);
+    if (waypoints.empty()) {
+        waypoints.push_back(target);
+    }
+    return waypoints;
+}
+
+
 pair<short, double> StateSimulation::calculateAngleAndDistance(const double& x, const double& y) const {
     // Calculate angle and distance to the given point
 
@@ -385,8 +654,9 @@ SimulationSnapshot StateSimulation::buildSimulationSnapshot() const {
     sim_snapshot.angle_ = mower_.getAngle();
     sim_snapshot.simulation_time_ = static_cast<double>(time_);
 
-    sim_snapshot.fields_ = lawn_.getFields();
-    sim_snapshot.points_ = points_;
+    sim_snapshot.fields_ = lawn_.getFieldGrid();
+    sim_snapshot.pass_counts_ = lawn_.getPassCounts();
+    sim_snapshot.points_ = points_.getPoints();
 
     return sim_snapshot;
 }
@@ -398,29 +668,42 @@ StaticSimulationData StateSimulation::getStaticData() const {
     data.width_cm_ = mower_.getWidth();
     data.length_cm = mower_.getLength();
     data.blade_diameter_cm = mower_.getBladeDiameter();
+    data.obstacle_fields_ = lawn_.getObstacleFields();
     return data;
 }
 
 
 std::optional<std::pair<double, double>> StateSimulation::getPointCoordinates(unsigned int pointId) {
-    for (const Point& point : points_) {
-        if (point.getId() == pointId) {
-            return std::make_pair(point.getX(), point.getY());
-        }
+    const Point* point = points_.findPoint(pointId);
+    if (point != nullptr) {
+        return std::make_pair(point->getX(), point->getY());
     }
     
-    string message = "Unable to find point in the lawn. Incorrect point's id " + to_string(pointId);
-    Log log = Log(time_, message);
-    logger_.push(log);
-    file_logger_.saveLog(log);
+    LogRecord record(LogEventType::POINT_NOT_FOUND, time_, pointId);
+    logger_.push(Log(time_, record.formatMessage()));
+    file_logger_.saveRecord(record);
     
     return std::nullopt;
 }
 
+std::vector<std::pair<double, double>> StateSimulation::planPathToPoint(unsigned int pointId) {
+    auto coords = getPointCoordinates(pointId);
+    if (!coords) {
+        return {};
+    }
+    return planPath(pointId, *coords);
+}
+
+std::optional<Point> StateSimulation::findNearestPoint(double x, double y) const {
+    return point_index_.findNearestPoint(x, y);
+}
+
+std::vector<Point> StateSimulation::findPointsInRadius(double x, double y, double radius) const {
+    return point_index_.findPointsInRadius(x, y, radius);
+}
+
 void StateSimulation::logArrivalAtPoint(unsigned int pointId) {
-    string message = "Arrived at point with id:  " + to_string(pointId);
-    Log log = Log(time_, message);
-    logger_.push(log);       
+    file_logger_.saveRecord(LogRecord(LogEventType::POINT_ARRIVED, time_, pointId));
 }
 
 std::pair<short, double> StateSimulation::calculateNavigationVector(double targetX, double targetY) const {
@@ -0,0 +1,106 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of ThreadPool.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include "ThreadPool.h"
+
+using namespace std;
+
+// Creates the given number of worker threads. 0 means one thread for every hardware thread.
+ThreadPool::ThreadPool(size_t threads_number) {
+    if (threads_number == 0) {
+        threads_number = max<size_t>(1, thread::hardware_concurrency());
+    }
+    workers_.reserve(threads_number);
+    for (size_t i = 0; i < threads_number; ++i) {
+        workers_.emplace_back(&ThreadPool::runWorker, this);
+    }
+}
+
+// Tasks which are already queued are finished before the workers are joined.
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    task_condition_.notify_all();
+
+    for (thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+future<void> ThreadPool::submit(function<void()> task) {
+    packaged_task<void()> packaged(move(task));
+    future<void> result = packaged.get_future();
+    {
+        lock_guard<mutex> lock(mutex_);
+        tasks_.push(move(packaged));
+    }
+    task_condition_.notify_one();
+    return result;
+}
+
+// Runs task(0) ... task(tasks_number - 1) and waits until all of them are finished. Indexes are not assigned
+// to threads in advance: every thread takes the next free index when it finishes its task, so threads which got
+// cheap tasks take over the remaining work of the others. The calling thread takes indexes as well.
+// All tasks are always run, even if one of them fails, because the caller expects the whole work to be done.
+// Then the first exception is rethrown.
+void ThreadPool::runForEach(size_t tasks_number, const function<void(size_t)>& task) {
+    atomic<size_t> next_index{0};
+    mutex error_mutex;
+    exception_ptr first_error;
+
+    auto run_tasks = [&]() {
+        for (size_t i = next_index.fetch_add(1); i < tasks_number; i = next_index.fetch_add(1)) {
+            try {
+                task(i);
+            } catch (...) {
+                lock_guard<mutex> lock(error_mutex);
+                if (!first_error) {
+                    first_error = current_exception();
+                }
+            }
+        }
+    };
+
+    size_t helpers_number = min(workers_.size(), tasks_number > 0 ? tasks_number - 1 : 0);
+    vector<future<void>> helpers;
+    helpers.reserve(helpers_number);
+    for (size_t i = 0; i < helpers_number; ++i) {
+        helpers.push_back(submit(run_tasks));
+    }
+
+    run_tasks();
+    for (future<void>& helper : helpers) {
+        helper.wait();
+    }
+
+    if (first_error) {
+        rethrow_exception(first_error);
+    }
+}
+
+size_t ThreadPool::getThreadsNumber() const {
+    return workers_.size();
+}
+
+void ThreadPool::runWorker() {
+    while (true) {
+        packaged_task<void()> task;
+        {
+            unique_lock<mutex> lock(mutex_);
+            task_condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
@@ -0,0 +1,179 @@
+/*
+    Author: Hanna Biegacz
+    Implementation of Viewport.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "Viewport.h"
+
+using namespace std;
+
+void Viewport::setLawnSize(double lawn_width_cm, double lawn_length_cm) {
+    bool size_changed = lawn_width_cm != lawn_width_cm_ || lawn_length_cm != lawn_length_cm_;
+    lawn_width_cm_ = lawn_width_cm;
+    lawn_length_cm_ = lawn_length_cm;
+
+    if (size_changed && mode_ == Mode::FIT_LAWN) {
+        centerOnLawn();
+    }
+}
+
+void Viewport::setScreenSize(double screen_width_px, double screen_height_px) {
+    screen_width_px_ = screen_width_px;
+    screen_height_px_ = screen_height_px;
+}
+
+// Zooms in (factor > 1) or out (factor < 1) keeping the lawn point under the cursor
+// in the same place on the screen. Zooming out to the minimal zoom returns to fitting the whole lawn.
+void Viewport::zoomAt(double factor, double screen_x, double screen_y) {
+    if (!hasValidDimensions() || factor <= 0.0) return;
+
+    pair<double, double> anchor_before = mapToWorld(screen_x, screen_y);
+    zoom_ = clamp(zoom_ * factor, MIN_ZOOM, MAX_ZOOM);
+
+    if (zoom_ <= MIN_ZOOM) {
+        reset();
+        return;
+    }
+
+    if (mode_ == Mode::FIT_LAWN) {
+        mode_ = Mode::FREE;
+    }
+
+    if (mode_ == Mode::FREE) {
+        pair<double, double> anchor_after = mapToWorld(screen_x, screen_y);
+        center_x_cm_ += anchor_before.first - anchor_after.first;
+        center_y_cm_ += anchor_before.second - anchor_after.second;
+        clampCenterToLawn();
+    }
+}
+
+// Moves the view by the given number of pixels. Dragging always switches to the free mode,
+// so that the view stops following the mower.
+void Viewport::pan(double dx_px, double dy_px) {
+    if (!hasValidDimensions()) return;
+
+    mode_ = Mode::FREE;
+    double scale = getScale();
+    center_x_cm_ -= dx_px / scale;
+    center_y_cm_ += dy_px / scale;
+    clampCenterToLawn();
+}
+
+void Viewport::followTarget(double x_cm, double y_cm) {
+    if (mode_ != Mode::FOLLOW_MOWER) return;
+
+    center_x_cm_ = x_cm;
+    center_y_cm_ = y_cm;
+    clampCenterToLawn();
+}
+
+void Viewport::setMode(Mode mode) {
+    if (mode == Mode::FIT_LAWN) {
+        reset();
+        return;
+    }
+    mode_ = mode;
+}
+
+void Viewport::reset() {
+    mode_ = Mode::FIT_LAWN;
+    zoom_ = MIN_ZOOM;
+    centerOnLawn();
+}
+
+Viewport::Mode Viewport::getMode() const {
+    return mode_;
+}
+
+double Viewport::getZoom() const {
+    return zoom_;
+}
+
+// Number of pixels per centimeter. Zoom equal to 1 means the whole lawn fits the window.
+double Viewport::getScale() const {
+    return calculateFitScale() * zoom_;
+}
+
+pair<double, double> Viewport::getCenter() const {
+    return make_pair(center_x_cm_, center_y_cm_);
+}
+
+// Converts simulation coordinates (in centimeters) to screen coordinates (in pixels).
+// The simulation uses standard math coordinates (Y up), but screens use Y down, so the Y axis is flipped.
+pair<double, double> Viewport::mapToScreen(double x_cm, double y_cm) const {
+    double scale = getScale();
+    double screen_x = screen_width_px_ / 2.0 + (x_cm - center_x_cm_) * scale;
+    double screen_y = screen_height_px_ / 2.0 - (y_cm - center_y_cm_) * scale;
+    return make_pair(screen_x, screen_y);
+}
+
+pair<double, double> Viewport::mapToWorld(double screen_x, double screen_y) const {
+    double scale = getScale();
+    if (scale <= 0.0) return make_pair(0.0, 0.0);
+
+    double x_cm = center_x_cm_ + (screen_x - screen_width_px_ / 2.0) / scale;
+    double y_cm = center_y_cm_ - (screen_y - screen_height_px_ / 2.0) / scale;
+    return make_pair(x_cm, y_cm);
+}
+
+// Returns the part of the lawn (in centimeters) which is covered by the window.
+VisibleArea Viewport::getVisibleArea() const {
+    VisibleArea area;
+    if (!hasValidDimensions()) return area;
+
+    pair<double, double> top_left = mapToWorld(0.0, 0.0);
+    pair<double, double> bottom_right = mapToWorld(screen_width_px_, screen_height_px_);
+
+    area.min_x_ = max(0.0, top_left.first);
+    area.max_x_ = min(lawn_width_cm_, bottom_right.first);
+    area.min_y_ = max(0.0, bottom_right.second);
+    area.max_y_ = min(lawn_length_cm_, top_left.second);
+    return area;
+}
+
+// Calculates which cells of the lawn grid are at least partially visible. Only these cells
+// have to be converted into an image, so zooming in makes every frame cheaper.
+CellRange Viewport::calculateVisibleCells(int num_cols, int num_rows) const {
+    CellRange range;
+    if (!hasValidDimensions() || num_cols <= 0 || num_rows <= 0) return range;
+
+    VisibleArea area = getVisibleArea();
+    double cell_width_cm = lawn_width_cm_ / num_cols;
+    double cell_length_cm = lawn_length_cm_ / num_rows;
+
+    range.first_col_ = clamp(static_cast<int>(floor(area.min_x_ / cell_width_cm)), 0, num_cols);
+    range.end_col_ = clamp(static_cast<int>(ceil(area.max_x_ / cell_width_cm)), 0, num_cols);
+    range.first_row_ = clamp(static_cast<int>(floor(area.min_y_ / cell_length_cm)), 0, num_rows);
+    range.end_row_ = clamp(static_cast<int>(ceil(area.max_y_ / cell_length_cm)), 0, num_rows);
+    return range;
+}
+
+// Checks if a point is inside the window. The margin allows sprites drawn around the point
+// to stay visible when the point itself is just outside the window.
+bool Viewport::isPointVisible(double x_cm, double y_cm, double margin_px) const {
+    pair<double, double> screen_pos = mapToScreen(x_cm, y_cm);
+    return screen_pos.first >= -margin_px && screen_pos.first <= screen_width_px_ + margin_px &&
+        screen_pos.second >= -margin_px && screen_pos.second <= screen_height_px_ + margin_px;
+}
+
+bool Viewport::hasValidDimensions() const {
+    return lawn_width_cm_ > 0.0 && lawn_length_cm_ > 0.0 && screen_width_px_ > 0.0 && screen_height_px_ > 0.0;
+}
+
+double Viewport::calculateFitScale() const {
+    if (!hasValidDimensions()) return 0.0;
+    return min(screen_width_px_ / lawn_width_cm_, screen_height_px_ / lawn_length_cm_);
+}
+
+void Viewport::centerOnLawn() {
+    center_x_cm_ = lawn_width_cm_ / 2.0;
+    center_y_cm_ = lawn_length_cm_ / 2.0;
+}
+
+// Keeps the center of the view inside the lawn, so the user cannot lose the lawn while panning.
+void Viewport::clampCenterToLawn() {
+    center_x_cm_ = clamp(center_x_cm_, 0.0, lawn_width_cm_);
+    center_y_cm_ = clamp(center_y_cm_, 0.0, lawn_length_cm_);
+}
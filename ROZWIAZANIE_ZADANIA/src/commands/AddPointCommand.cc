@@ -12,3 +12,7 @@ bool AddPointCommand::execute(StateSimulation& sim, double dt) {
     sim.simulateAddPoint(x_, y_);
     return true;
 }
+
+bool AddPointCommand::isInstantaneous() const {
+    return true;
+}
@@ -0,0 +1,83 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of a user command.
+*/
+
+#include "commands/ArcCommand.h"
+#include "Constants.h"
+#include "MathHelper.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+ArcCommand::ArcCommand(double radius, double angle) 
+    : radius_(abs(radius)), angle_left_(angle), arc_middle_(0.0, 0.0) {}
+
+// Moves the mower along the arc. The position on the arc is calculated from the middle of the arc
+// in every frame, so the mower does not drift away from the arc however many frames it takes.
+// In the fast-forward mode the whole arc is covered in a single step.
+bool ArcCommand::execute(StateSimulation& sim, double dt) {
+    if (!initialized_) {
+        initializeArc(sim);
+    }
+
+    if (radius_ <= Constants::DISTANCE_PRECISION || abs(angle_left_) <= ANGLE_PRECISION) {
+        unused_time_ = dt;
+        return true;
+    }
+
+    if (sim.isFastForward()) {
+        while (abs(angle_left_) > ANGLE_PRECISION) {
+            moveAlongArc(sim, clamp(angle_left_, -MAX_FAST_FORWARD_SWEEP, MAX_FAST_FORWARD_SWEEP));
+        }
+        return true;
+    }
+
+    double sweep = calculateSweepForFrame(sim, dt);
+    moveAlongArc(sim, sweep);
+
+    if (abs(angle_left_) > ANGLE_PRECISION) {
+        return false;
+    }
+    double speed = sim.getMower().getSpeed();
+    double distance = radius_ * MathHelper::convertFractionalDegreesToRadians(abs(sweep));
+    unused_time_ = speed > 0.0 ? max(0.0, dt - distance / speed) : 0.0;
+    return true;
+}
+
+double ArcCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+// The middle of the arc lies on the right side of the mower for right turns and on the left side for left turns.
+void ArcCommand::initializeArc(const StateSimulation& sim) {
+    constexpr double RIGHT_ANGLE = 90.0;
+
+    const Mower& mower = sim.getMower();
+    double side = angle_left_ >= 0.0 ? RIGHT_ANGLE : -RIGHT_ANGLE;
+    double middle_direction = MathHelper::convertFractionalDegreesToRadians(mower.getAngle() + side);
+
+    arc_middle_ = make_pair(mower.getX() + radius_ * sin(middle_direction), 
+        mower.getY() + radius_ * cos(middle_direction));
+    current_angle_ = MathHelper::normalizeAngle(mower.getAngle() - side);
+    initialized_ = true;
+}
+
+double ArcCommand::calculateSweepForFrame(const StateSimulation& sim, double dt) const {
+    double step = sim.getMower().getSpeed() * dt;
+    double max_sweep = MathHelper::convertRadiansToDegrees(step / radius_);
+
+    if (angle_left_ > 0) {
+        return min(max_sweep, angle_left_);
+    } else {
+        return max(-max_sweep, angle_left_);
+    }
+}
+
+void ArcCommand::moveAlongArc(StateSimulation& sim, double sweep) {
+    sim.simulateArcMovement(arc_middle_, radius_, current_angle_, sweep);
+    current_angle_ = MathHelper::normalizeAngle(current_angle_ + sweep);
+    angle_left_ -= sweep;
+}
@@ -14,3 +14,7 @@ bool DeletePointCommand::execute(StateSimulation& sim, double dt) {
     sim.simulateDeletePoint(id_);
     return true;
 }
+
+bool DeletePointCommand::isInstantaneous() const {
+    return true;
+}
@@ -11,3 +11,7 @@ bool GetCurrentAngleCommand::execute(StateSimulation& sim, double dt) {
     output_angle_ = sim.getMower().getAngle();
     return true;
 }
+
+bool GetCurrentAngleCommand::isInstantaneous() const {
+    return true;
+}
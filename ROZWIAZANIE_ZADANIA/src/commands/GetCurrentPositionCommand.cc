@@ -19,3 +19,7 @@ bool GetCurrentPositionCommand::execute(StateSimulation& sim, double dt) {
 
     return true;
 }
+
+bool GetCurrentPositionCommand::isInstantaneous() const {
+    return true;
+}
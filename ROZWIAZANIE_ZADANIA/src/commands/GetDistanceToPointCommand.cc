@@ -27,6 +27,10 @@ bool GetDistanceToPointCommand::execute(StateSimulation& sim, double dt) {
     return true;
 }
 
+bool GetDistanceToPointCommand::isInstantaneous() const {
+    return true;
+}
+
 void GetDistanceToPointCommand::logPointNotFoundError(StateSimulation& sim) const {
     std::string msg = "Error: Point " + std::to_string(point_id_) + " not found for GetDistanceToPoint.";
     sim.getFileLogger().saveMessage(msg);
@@ -21,6 +21,8 @@ MoveCommand::MoveCommand(const double* distance_ptr, double scale)
 // where the actual distance is calculated from a pointer value on first execution. 
 // Example of a situation where this is useful is in main where we first calculate
 // the total distance of the path and then pass a pointer to it to the MoveCommand.
+// In the fast-forward mode the whole distance is covered in a single step.
+// When the distance is covered before the end of the step, the rest of the step is not used.
 bool MoveCommand::execute(StateSimulation& sim, double dt) {
     if (!initialized_) {
         if (deferred_distance_) {
@@ -29,7 +31,16 @@ bool MoveCommand::execute(StateSimulation& sim, double dt) {
         initialized_ = true;
     }
 
-    if (distance_left_ <= 0) return true;
+    if (distance_left_ <= 0) {
+        unused_time_ = dt;
+        return true;
+    }
+
+    if (sim.isFastForward()) {
+        sim.simulateSegment(distance_left_);
+        distance_left_ = 0.0;
+        return true;
+    }
 
     double speed = sim.getMower().getSpeed();
     double step = speed * dt;
@@ -38,5 +49,13 @@ bool MoveCommand::execute(StateSimulation& sim, double dt) {
     sim.simulateMovement(actual_step);
     distance_left_ -= actual_step;
 
-    return distance_left_ <= Constants::DISTANCE_PRECISION;
+    if (distance_left_ > Constants::DISTANCE_PRECISION) {
+        return false;
+    }
+    unused_time_ = speed > 0.0 ? max(0.0, dt - actual_step / speed) : 0.0;
+    return true;
+}
+
+double MoveCommand::getUnusedTime() const {
+    return unused_time_;
 }
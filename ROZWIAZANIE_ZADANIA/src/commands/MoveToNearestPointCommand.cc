@@ -0,0 +1,57 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of a user command.
+*/
+
+#include "commands/MoveToNearestPointCommand.h"
+#include "Constants.h"
+#include "LogRecord.h"
+
+using namespace std;
+
+MoveToNearestPointCommand::MoveToNearestPointCommand(bool deletePointOnArrival)
+    : delete_point_on_arrival_(deletePointOnArrival)
+{}
+
+// Chooses the nearest point on first execution and then drives to it with a MoveToPointCommand.
+bool MoveToNearestPointCommand::execute(StateSimulation& sim, double dt) {
+    if (!move_command_) {
+        if (!initializeTarget(sim)) {
+            unused_time_ = dt;
+            return true;
+        }
+    }
+
+    if (!move_command_->execute(sim, dt)) {
+        return false;
+    }
+
+    unused_time_ = move_command_->getUnusedTime();
+    if (delete_point_on_arrival_) {
+        sim.simulateDeletePoint(point_id_);
+    }
+    return true;
+}
+
+double MoveToNearestPointCommand::getMaxTimestep(const StateSimulation& sim) const {
+    if (!move_command_) {
+        return Constants::FINE_TIMESTEP;
+    }
+    return move_command_->getMaxTimestep(sim);
+}
+
+double MoveToNearestPointCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+bool MoveToNearestPointCommand::initializeTarget(StateSimulation& sim) {
+    auto point = sim.findNearestPoint(sim.getMower().getX(), sim.getMower().getY());
+    if (!point) {
+        sim.getFileLogger().saveRecord(LogRecord(LogEventType::NO_POINTS_FOUND, sim.getTime()));
+        return false;
+    }
+    point_id_ = point->getId();
+    move_command_.emplace(point_id_);
+    return true;
+}
@@ -17,15 +17,19 @@ MoveToPointCommand::MoveToPointCommand(unsigned int pointId)
 
 // Navigates the mower to a specific point. Handles rotation towards the target
 // and movement in that direction. Runs over multiple frames until arrival.
+// Arrival is found at the beginning of a step, so the whole step is left for the next command.
 bool MoveToPointCommand::execute(StateSimulation& sim, double dt) {
     if (!initialized_) {
         if (!initializeTarget(sim)) {
+            unused_time_ = dt;
             return true; 
         }
     }
 
+    skipReachedWaypoints(sim);
     double distance = calculateDistanceToTarget(sim);
     if (hasArrivedAtTarget(sim, distance)) {
+        unused_time_ = dt;
         return true; 
     }
 
@@ -44,18 +48,61 @@ bool MoveToPointCommand::execute(StateSimulation& sim, double dt) {
     return false;
 }
 
-// Retrieves target point coordinates on first execution.
+// Driving straight towards a distant target can be done in long steps. Rotating towards the target
+// and homing in close range need fine steps, otherwise the mower would miss the target.
+// On lawns with obstacles steps are limited, so the heading rounded to whole degrees is corrected often enough
+// to keep the mower on the planned path.
+double MoveToPointCommand::getMaxTimestep(const StateSimulation& sim) const {
+    if (!initialized_) {
+        return Constants::FINE_TIMESTEP;
+    }
+
+    short rotation_needed = sim.calculateNavigationVector(target_x_, target_y_).first;
+    if (rotation_needed != 0 || calculateDistanceToTarget(sim) < CLOSE_RANGE_THRESHOLD) {
+        return Constants::FINE_TIMESTEP;
+    }
+    if (!sim.getLawn().getObstacleMap().isEmpty() && sim.getMower().getSpeed() > 0) {
+        return MAX_STEP_NEAR_OBSTACLES / sim.getMower().getSpeed();
+    }
+    return ICommand::getMaxTimestep(sim);
+}
+
+double MoveToPointCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+unsigned int MoveToPointCommand::getPointId() const {
+    return point_id_;
+}
+
+// The path is planned on first execution, so a command which was not started can still be reordered.
+bool MoveToPointCommand::isStarted() const {
+    return initialized_;
+}
+
+// Plans the path to the point on first execution. The first waypoint becomes the current target.
 bool MoveToPointCommand::initializeTarget(StateSimulation& sim) {
-    auto coords = sim.getPointCoordinates(point_id_);
-    if (!coords) {
+    waypoints_ = sim.planPathToPoint(point_id_);
+    if (waypoints_.empty()) {
         return false;
     }
-    target_x_ = coords->first;
-    target_y_ = coords->second;
+    waypoint_index_ = 0;
+    target_x_ = waypoints_.front().first;
+    target_y_ = waypoints_.front().second;
     initialized_ = true;
     return true;
 }
 
+// Switches the target to the next waypoint when the current one is reached. Arrival is logged only
+// at the last waypoint, which is the point itself.
+void MoveToPointCommand::skipReachedWaypoints(const StateSimulation& sim) {
+    while (waypoint_index_ + 1 < waypoints_.size() && calculateDistanceToTarget(sim) <= ARRIVAL_THRESHOLD) {
+        waypoint_index_ ++;
+        target_x_ = waypoints_[waypoint_index_].first;
+        target_y_ = waypoints_[waypoint_index_].second;
+    }
+}
+
 double MoveToPointCommand::calculateDistanceToTarget(const StateSimulation& sim) const {
     double current_x = sim.getMower().getX();
     double current_y = sim.getMower().getY();
@@ -65,7 +112,7 @@ double MoveToPointCommand::calculateDistanceToTarget(const StateSimulation& sim)
 }
 
 bool MoveToPointCommand::hasArrivedAtTarget(StateSimulation& sim, double currentDistance) const {
-    if (currentDistance <= 3.0) {
+    if (currentDistance <= ARRIVAL_THRESHOLD) {
         sim.logArrivalAtPoint(point_id_);
         return true;
     }
@@ -96,7 +143,6 @@ void MoveToPointCommand::applyAccumulatedRotation(StateSimulation& sim) {
 // Checks if the mower is facing the target within acceptable tolerance.
 // Uses tighter tolerance when close to the target for precision.
 bool MoveToPointCommand::isAlignedWithTarget(short rotationNeeded, double distanceToTarget) const {
-    const double CLOSE_RANGE_THRESHOLD = 20.0;
     const short TIGHT_ANGLE_TOLERANCE = 2;
     const short LOOSE_ANGLE_TOLERANCE = 10;
     
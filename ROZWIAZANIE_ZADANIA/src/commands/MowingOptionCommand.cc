@@ -16,3 +16,7 @@ bool MowingOptionCommand::execute(StateSimulation& sim, double dt) {
     }
     return true; 
 }
+
+bool MowingOptionCommand::isInstantaneous() const {
+    return true;
+}
@@ -0,0 +1,75 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of a user command.
+*/
+
+#include "commands/PolylineCommand.h"
+#include "Constants.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+PolylineCommand::PolylineCommand(vector<pair<double, double>> points) 
+    : points_(std::move(points)) {}
+
+// Moves the mower along the polyline by the distance of the frame.
+// In the fast-forward mode the whole polyline is covered in a single step.
+// The time left after reaching the last point is reported as unused.
+bool PolylineCommand::execute(StateSimulation& sim, double dt) {
+    if (isPathFinished()) {
+        unused_time_ = dt;
+        return true;
+    }
+
+    if (sim.isFastForward()) {
+        moveAlongPath(sim, numeric_limits<double>::infinity());
+        return true;
+    }
+
+    double speed = sim.getMower().getSpeed();
+    double distance_left = moveAlongPath(sim, speed * dt);
+    if (!isPathFinished()) {
+        return false;
+    }
+    unused_time_ = speed > 0.0 ? distance_left / speed : 0.0;
+    return true;
+}
+
+double PolylineCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+bool PolylineCommand::isPathFinished() const {
+    return next_point_index_ >= points_.size();
+}
+
+// Moves through the next points until the distance is used up. Returns the distance which was not used.
+double PolylineCommand::moveAlongPath(StateSimulation& sim, double distance) {
+    while (!isPathFinished()) {
+        const Mower& mower = sim.getMower();
+        const pair<double, double>& point = points_[next_point_index_];
+        double dx = point.first - mower.getX();
+        double dy = point.second - mower.getY();
+        double distance_to_point = sqrt(dx * dx + dy * dy);
+
+        if (distance_to_point <= distance) {
+            if (distance_to_point > Constants::DISTANCE_PRECISION) {
+                sim.simulateLineMovement(point.first, point.second);
+            }
+            distance -= distance_to_point;
+            ++next_point_index_;
+            continue;
+        }
+
+        if (distance <= Constants::DISTANCE_PRECISION) {
+            return 0.0;
+        }
+        double ratio = distance / distance_to_point;
+        sim.simulateLineMovement(mower.getX() + dx * ratio, mower.getY() + dy * ratio);
+        return 0.0;
+    }
+    return distance;
+}
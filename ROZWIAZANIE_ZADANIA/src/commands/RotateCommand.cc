@@ -14,16 +14,32 @@ using namespace std;
 RotateCommand::RotateCommand(short angle) : angle_left_(angle) {}
 
 // Rotates the mower by a specified angle over multiple frames.
-// Uses an accumulator to handle smooth sub-degree rotation.
+// Uses an accumulator to handle smooth sub-degree rotation, whole degrees are applied to the simulation
+// and the rest is applied after the last frame, so the mower rotates exactly by the given angle.
+// The time left after the last part of the rotation is reported as unused.
 bool RotateCommand::execute(StateSimulation& sim, double dt) {
     if (isRotationFinished()) {
+        unused_time_ = dt;
         return true;
     }
 
     double step = calculateRotationStepForFrame(dt);
     updateInternalRotationState(step);
     applyAccumulatedRotationToSimulation(sim);
-    return isRotationFinished();
+    if (!isRotationFinished()) {
+        return false;
+    }
+    unused_time_ = max(0.0, dt - abs(step) / static_cast<double>(Constants::ROTATION_SPEED));
+    return true;
+}
+
+double RotateCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+// Rotation is applied in whole degrees, so long steps would make it less accurate.
+double RotateCommand::getMaxTimestep(const StateSimulation& /*sim*/) const {
+    return Constants::FINE_TIMESTEP;
 }
 
 double RotateCommand::calculateRotationStepForFrame(double dt) const {
@@ -38,20 +54,23 @@ double RotateCommand::calculateRotationStepForFrame(double dt) const {
 }
 
 void RotateCommand::updateInternalRotationState(double step) {
-    constexpr double ROUNDING_OFFSET = 0.5; 
     rotation_accumulator_ += step;
-
-    if (step > 0) {
-        angle_left_ -= static_cast<short>(floor(step + ROUNDING_OFFSET)); 
-    } else {
-        angle_left_ -= static_cast<short>(ceil(step - ROUNDING_OFFSET));
-    }
+    angle_left_ -= step;
 }
 
 void RotateCommand::applyAccumulatedRotationToSimulation(StateSimulation& sim) {
     constexpr double MIN_DEGREE_THRESHOLD = 1.0;
     
-    if (abs(rotation_accumulator_) >= MIN_DEGREE_THRESHOLD) {
+    constexpr double NO_ROTATION_LEFT = 0.0;
+
+    if (angle_left_ == NO_ROTATION_LEFT) {
+        short actual_rot_to_apply = static_cast<short>(round(rotation_accumulator_));
+        if (actual_rot_to_apply != 0) {
+            sim.simulateRotation(actual_rot_to_apply);
+        }
+        rotation_accumulator_ -= actual_rot_to_apply;
+    }
+    else if (abs(rotation_accumulator_) >= MIN_DEGREE_THRESHOLD) {
         short actual_rot_to_apply = static_cast<short>(rotation_accumulator_);
         
         sim.simulateRotation(actual_rot_to_apply);
@@ -60,7 +79,7 @@ void RotateCommand::applyAccumulatedRotationToSimulation(StateSimulation& sim) {
 }
 
 bool RotateCommand::isRotationFinished() const {
-    constexpr short NO_ROTATION_LEFT = 0;
+    constexpr double NO_ROTATION_LEFT = 0.0;
     constexpr double ROTATION_TOLERANCE = 0.5;
     
     return angle_left_ == NO_ROTATION_LEFT && abs(rotation_accumulator_) < ROTATION_TOLERANCE;
@@ -19,6 +19,7 @@ RotateTowardsPointCommand::RotateTowardsPointCommand(unsigned int pointId)
 bool RotateTowardsPointCommand::execute(StateSimulation& sim, double dt) {
     if (!initialized_) {
         if (!initializeTarget(sim)) {
+            unused_time_ = dt;
             return true; 
         }
     }
@@ -26,17 +27,27 @@ bool RotateTowardsPointCommand::execute(StateSimulation& sim, double dt) {
     auto nav = sim.calculateNavigationVector(target_x_, target_y_);
     short rotation_needed = nav.first;
 
+    double step = 0.0;
     if (rotation_needed != 0) {
-        executeRotationLogic(sim, dt, rotation_needed);
+        step = executeRotationLogic(sim, dt, rotation_needed);
     }
 
     if (isAlignedWithTarget(rotation_needed)) {
+        unused_time_ = max(0.0, dt - abs(step) / static_cast<double>(Constants::ROTATION_SPEED));
         return true;
     }
 
     return false;
 }
 
+double RotateTowardsPointCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+double RotateTowardsPointCommand::getMaxTimestep(const StateSimulation& /*sim*/) const {
+    return Constants::FINE_TIMESTEP;
+}
+
 bool RotateTowardsPointCommand::initializeTarget(StateSimulation& sim) {
     auto coords = sim.getPointCoordinates(point_id_);
     if (!coords) {
@@ -48,7 +59,7 @@ bool RotateTowardsPointCommand::initializeTarget(StateSimulation& sim) {
     return true;
 }
 
-void RotateTowardsPointCommand::executeRotationLogic(StateSimulation& sim, double dt, short rotationNeeded) {
+double RotateTowardsPointCommand::executeRotationLogic(StateSimulation& sim, double dt, short rotationNeeded) {
     double rot_speed = static_cast<double>(Constants::ROTATION_SPEED);
     double max_step = rot_speed * dt;
 
@@ -59,6 +70,7 @@ void RotateTowardsPointCommand::executeRotationLogic(StateSimulation& sim, doubl
     rotation_accumulator_ += step;
 
     applyAccumulatedRotation(sim);
+    return step;
 }
 
 void RotateTowardsPointCommand::applyAccumulatedRotation(StateSimulation& sim) {
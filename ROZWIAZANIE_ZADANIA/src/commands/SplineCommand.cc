@@ -0,0 +1,68 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of a user command.
+*/
+
+#include "commands/SplineCommand.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+SplineCommand::SplineCommand(vector<pair<double, double>> points) 
+    : points_(std::move(points)) {}
+
+// Samples the curve from the current position of the mower on first execution
+// and moves the mower along the sampled curve.
+bool SplineCommand::execute(StateSimulation& sim, double dt) {
+    if (!path_) {
+        const Mower& mower = sim.getMower();
+        points_.insert(points_.begin(), make_pair(mower.getX(), mower.getY()));
+        path_.emplace(sampleCurve(points_));
+        points_.clear();
+        points_.shrink_to_fit();
+    }
+    return path_->execute(sim, dt);
+}
+
+double SplineCommand::getUnusedTime() const {
+    return path_ ? path_->getUnusedTime() : 0.0;
+}
+
+// Every part of the curve between two neighbouring points is sampled evenly, the number of samples depends
+// on the distance between the points. The first and the last point are repeated, so the curve goes through them.
+vector<pair<double, double>> SplineCommand::sampleCurve(const vector<pair<double, double>>& points) {
+    vector<pair<double, double>> samples;
+    if (points.size() < 2) {
+        return samples;
+    }
+
+    size_t last_index = points.size() - 1;
+    for (size_t i = 0; i < last_index; ++i) {
+        const pair<double, double>& p0 = points[i == 0 ? 0 : i - 1];
+        const pair<double, double>& p1 = points[i];
+        const pair<double, double>& p2 = points[i + 1];
+        const pair<double, double>& p3 = points[min(i + 2, last_index)];
+
+        double chord = hypot(p2.first - p1.first, p2.second - p1.second);
+        int samples_number = max(1, static_cast<int>(ceil(chord / SAMPLE_DISTANCE)));
+        for (int j = 1; j < samples_number; ++j) {
+            samples.push_back(interpolate(p0, p1, p2, p3, static_cast<double>(j) / samples_number));
+        }
+        samples.push_back(p2);
+    }
+    return samples;
+}
+
+pair<double, double> SplineCommand::interpolate(const pair<double, double>& p0, const pair<double, double>& p1,
+    const pair<double, double>& p2, const pair<double, double>& p3, double t) {
+    double t2 = t * t;
+    double t3 = t2 * t;
+    auto coordinate = [&](double c0, double c1, double c2, double c3) {
+        return 0.5 * (2.0 * c1 + (c2 - c0) * t + (2.0 * c0 - 5.0 * c1 + 4.0 * c2 - c3) * t2 
+            + (3.0 * c1 - c0 - 3.0 * c2 + c3) * t3);
+    };
+    return make_pair(coordinate(p0.first, p1.first, p2.first, p3.first), 
+        coordinate(p0.second, p1.second, p2.second, p3.second));
+}
@@ -0,0 +1,86 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of a user command.
+*/
+
+#include "commands/VisitPointsCommand.h"
+#include "Constants.h"
+#include "LogRecord.h"
+#include <algorithm>
+
+using namespace std;
+
+VisitPointsCommand::VisitPointsCommand(vector<unsigned int> pointIds, double timeBudget)
+    : point_ids_(std::move(pointIds)), time_budget_(timeBudget)
+{}
+
+// Orders the points on first execution and then drives to them with MoveToPointCommands.
+// When a point is reached during the step, the rest of the step is split between the next commands,
+// so no command gets a longer step than it allows.
+bool VisitPointsCommand::execute(StateSimulation& sim, double dt) {
+    if (!initialized_) {
+        initializeRoute(sim);
+    }
+
+    double time_left = dt;
+    while (time_left > MIN_STEP_TIME) {
+        if (!move_command_) {
+            if (next_point_index_ == point_ids_.size()) {
+                break;
+            }
+            move_command_.emplace(point_ids_[next_point_index_++]);
+        }
+
+        double step = min(time_left, move_command_->getMaxTimestep(sim));
+        if (!move_command_->execute(sim, step)) {
+            time_left -= step;
+            continue;
+        }
+        time_left += move_command_->getUnusedTime() - step;
+        move_command_.reset();
+    }
+
+    if (move_command_ || next_point_index_ < point_ids_.size()) {
+        return false;
+    }
+    unused_time_ = max(0.0, time_left);
+    return true;
+}
+
+double VisitPointsCommand::getMaxTimestep(const StateSimulation& sim) const {
+    if (!move_command_) {
+        return Constants::FINE_TIMESTEP;
+    }
+    return move_command_->getMaxTimestep(sim);
+}
+
+double VisitPointsCommand::getUnusedTime() const {
+    return unused_time_;
+}
+
+// Points which do not exist are skipped (getPointCoordinates logs them), the remaining ones are ordered
+// from the current pose of the mower.
+void VisitPointsCommand::initializeRoute(StateSimulation& sim) {
+    vector<Point> points;
+    points.reserve(point_ids_.size());
+    for (unsigned int point_id : point_ids_) {
+        auto coords = sim.getPointCoordinates(point_id);
+        if (!coords) {
+            continue;
+        }
+        points.emplace_back(coords->first, coords->second, point_id);
+    }
+
+    const Mower& mower = sim.getMower();
+    RouteOptimizer optimizer(mower.getSpeed(), time_budget_);
+    OptimizedRoute route = optimizer.optimize({mower.getX(), mower.getY()}, mower.getAngle(), points);
+    logRoutePrediction(sim, route);
+    point_ids_ = std::move(route.point_ids_);
+    initialized_ = true;
+}
+
+void VisitPointsCommand::logRoutePrediction(StateSimulation& sim, const OptimizedRoute& route) const {
+    sim.getFileLogger().saveRecord(LogRecord(LogEventType::ROUTE_OPTIMIZED, sim.getTime(),
+        route.point_ids_.size(), route.given_order_time_, route.predicted_time_));
+}
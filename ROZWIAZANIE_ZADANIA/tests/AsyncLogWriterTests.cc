@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/AsyncLogWriter.h"
+#include "../include/FileLogger.h"
+
+using namespace std;
+
+namespace {
+    vector<string> readLines(const string& path) {
+        vector<string> lines;
+        ifstream file(path);
+        string line;
+        while (getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    string createEmptyFile(const string& path) {
+        remove(path.c_str());
+        return path;
+    }
+}
+
+TEST(AsyncLogWriterTest, writesLogsInOrderWithSynchronousFormat) {
+    string async_path = createEmptyFile("async_log_writer_test.log");
+    string sync_path = createEmptyFile("async_log_writer_sync_test.log");
+    FileLogger sync_logger(sync_path);
+    {
+        AsyncLogWriter writer(async_path);
+        for (int i = 0; i < 1000; ++i) {
+            Log log = Log(i * 10, "Message " + to_string(i));
+            writer.pushLog(log);
+            sync_logger.saveLog(log);
+        }
+        writer.pushMessage("Last message");
+        sync_logger.saveMessage("Last message");
+    }
+    sync_logger.flush();
+
+    EXPECT_EQ(readLines(async_path), readLines(sync_path));
+    EXPECT_EQ(readLines(async_path).size(), 1001);
+}
+
+TEST(AsyncLogWriterTest, flushWaitsUntilLogsAreWritten) {
+    string path = createEmptyFile("async_log_writer_flush_test.log");
+    AsyncLogWriter writer(path);
+
+    writer.pushLog(Log(10, "First"));
+    writer.pushLog(Log(20, "Second"));
+    writer.flush();
+
+    EXPECT_EQ(writer.getWrittenCount(), 2);
+    EXPECT_EQ(readLines(path), vector<string>({"Time: 10: First", "Time: 20: Second"}));
+}
+
+TEST(AsyncLogWriterTest, blockPolicyDoesNotLoseLogsOfManyProducers) {
+    string path = createEmptyFile("async_log_writer_block_test.log");
+    const int PRODUCERS_NUMBER = 4;
+    const int LOGS_PER_PRODUCER = 2000;
+    {
+        AsyncLogWriter writer(path, 16, LogOverflowPolicy::BLOCK);
+        vector<thread> producers;
+        for (int producer = 0; producer < PRODUCERS_NUMBER; ++producer) {
+            producers.emplace_back([&writer, producer, LOGS_PER_PRODUCER]() {
+                for (int i = 0; i < LOGS_PER_PRODUCER; ++i) {
+                    writer.pushLog(Log(i, "Producer " + to_string(producer)));
+                }
+            });
+        }
+        for (thread& producer : producers) {
+            producer.join();
+        }
+        writer.flush();
+
+        EXPECT_EQ(writer.getDroppedCount(), 0);
+        EXPECT_EQ(writer.getWrittenCount(), PRODUCERS_NUMBER * LOGS_PER_PRODUCER);
+    }
+
+    EXPECT_EQ(readLines(path).size(), PRODUCERS_NUMBER * LOGS_PER_PRODUCER);
+}
+
+TEST(AsyncLogWriterTest, dropPolicyCountsDroppedLogs) {
+    string path = createEmptyFile("async_log_writer_drop_test.log");
+    const int LOGS_NUMBER = 20000;
+    uint64_t written_count;
+    uint64_t dropped_count;
+    {
+        AsyncLogWriter writer(path, 4, LogOverflowPolicy::DROP);
+        for (int i = 0; i < LOGS_NUMBER; ++i) {
+            writer.pushLog(Log(i, "Log"));
+        }
+        writer.flush();
+        written_count = writer.getWrittenCount();
+        dropped_count = writer.getDroppedCount();
+    }
+
+    EXPECT_EQ(written_count + dropped_count, LOGS_NUMBER);
+    EXPECT_EQ(readLines(path).size(), written_count);
+}
+
+TEST(AsyncLogWriterTest, dropAndReportPolicyWritesNumberOfDroppedLogs) {
+    string path = createEmptyFile("async_log_writer_report_test.log");
+    const int LOGS_NUMBER = 20000;
+    uint64_t written_count;
+    uint64_t dropped_count;
+    {
+        AsyncLogWriter writer(path, 4, LogOverflowPolicy::DROP_AND_REPORT);
+        for (int i = 0; i < LOGS_NUMBER; ++i) {
+            writer.pushLog(Log(i, "Log"));
+        }
+        writer.flush();
+        written_count = writer.getWrittenCount();
+        dropped_count = writer.getDroppedCount();
+    }
+
+    uint64_t reported_count = 0;
+    uint64_t log_lines_count = 0;
+    for (const string& line : readLines(path)) {
+        if (line.rfind("Dropped ", 0) == 0) {
+            reported_count += stoull(line.substr(string("Dropped ").size()));
+        } else {
+            log_lines_count++;
+        }
+    }
+    EXPECT_EQ(log_lines_count, written_count);
+    EXPECT_EQ(reported_count, dropped_count);
+}
+
+TEST(AsyncLogWriterTest, fileLoggerCopiesShareWriter) {
+    string path = createEmptyFile("async_file_logger_test.log");
+    FileLogger file_logger(path);
+    file_logger.enableAsyncWriting();
+    FileLogger copy(file_logger);
+
+    file_logger.saveLog(Log(10, "Original"));
+    copy.saveMessage("Copy");
+    copy.getAsyncWriter()->flush();
+
+    EXPECT_TRUE(copy.isAsyncWritingEnabled());
+    EXPECT_EQ(copy.getAsyncWriter(), file_logger.getAsyncWriter());
+    EXPECT_EQ(readLines(path), vector<string>({"Time: 10: Original", "Copy"}));
+}
+
+TEST(AsyncLogWriterTest, copiesMadeBeforeEnablingUseWriter) {
+    string path = createEmptyFile("async_file_logger_early_copy_test.log");
+    FileLogger file_logger(path);
+    FileLogger copy(file_logger);
+
+    copy.saveMessage("Synchronous");
+    file_logger.enableAsyncWriting();
+    copy.saveLog(Log(10, "Copy"));
+    file_logger.saveLog(Log(20, "Original"));
+    copy.flush();
+
+    EXPECT_EQ(copy.getAsyncWriter(), file_logger.getAsyncWriter());
+    EXPECT_EQ(readLines(path), vector<string>({"Synchronous", "Time: 10: Copy", "Time: 20: Original"}));
+}
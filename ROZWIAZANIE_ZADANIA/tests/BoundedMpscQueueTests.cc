@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/BoundedMpscQueue.h"
+
+using namespace std;
+
+TEST(BoundedMpscQueueTest, capacityIsRoundedUpToPowerOfTwo) {
+    BoundedMpscQueue<int> queue(5);
+
+    EXPECT_EQ(queue.getCapacity(), 8);
+}
+
+TEST(BoundedMpscQueueTest, popReturnsValuesInPushOrder) {
+    BoundedMpscQueue<string> queue(4);
+    string first = "first";
+    string second = "second";
+    string value;
+
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_TRUE(queue.tryPush(first));
+    EXPECT_TRUE(queue.tryPush(second));
+
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, "first");
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, "second");
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(BoundedMpscQueueTest, pushFailsWhenFullAndKeepsValue) {
+    BoundedMpscQueue<string> queue(2);
+    string value = "value";
+    string rejected = "rejected";
+
+    EXPECT_TRUE(queue.tryPush(value));
+    value = "value";
+    EXPECT_TRUE(queue.tryPush(value));
+
+    EXPECT_FALSE(queue.tryPush(rejected));
+    EXPECT_EQ(rejected, "rejected");
+
+    string popped;
+    EXPECT_TRUE(queue.tryPop(popped));
+    EXPECT_TRUE(queue.tryPush(rejected));
+}
+
+TEST(BoundedMpscQueueTest, slotsAreReusedAfterWrappingAround) {
+    BoundedMpscQueue<int> queue(4);
+    int value;
+
+    for (int i = 0; i < 100; ++i) {
+        int pushed = i;
+        ASSERT_TRUE(queue.tryPush(pushed));
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(BoundedMpscQueueTest, concurrentProducersKeepTheirOwnOrder) {
+    const int PRODUCERS_NUMBER = 4;
+    const int VALUES_PER_PRODUCER = 20000;
+    BoundedMpscQueue<int> queue(64);
+
+    vector<thread> producers;
+    for (int producer = 0; producer < PRODUCERS_NUMBER; ++producer) {
+        producers.emplace_back([&queue, producer, VALUES_PER_PRODUCER]() {
+            for (int i = 0; i < VALUES_PER_PRODUCER; ++i) {
+                int value = producer * VALUES_PER_PRODUCER + i;
+                while (!queue.tryPush(value)) {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+
+    vector<int> last_values(PRODUCERS_NUMBER, -1);
+    int popped_number = 0;
+    int value;
+    while (popped_number < PRODUCERS_NUMBER * VALUES_PER_PRODUCER) {
+        if (!queue.tryPop(value)) {
+            this_thread::yield();
+            continue;
+        }
+        int producer = value / VALUES_PER_PRODUCER;
+        EXPECT_GT(value % VALUES_PER_PRODUCER, last_values[producer]);
+        last_values[producer] = value % VALUES_PER_PRODUCER;
+        popped_number++;
+    }
+
+    for (thread& producer : producers) {
+        producer.join();
+    }
+    for (int last_value : last_values) {
+        EXPECT_EQ(last_value, VALUES_PER_PRODUCER - 1);
+    }
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include "CommandBuffer.h"
+#include "Config.h"
+#include "StateSimulation.h"
+#include "commands/VisitPointsCommand.h"
+
+namespace {
+    class CountingCommand : public ICommand {
+    public:
+        CountingCommand(int& executions_number, int executions_to_finish) 
+            : executions_number_(executions_number), executions_to_finish_(executions_to_finish) {}
+
+        bool execute(StateSimulation& sim, double dt) override {
+            executions_number_++;
+            return executions_number_ >= executions_to_finish_;
+        }
+
+        double getMaxTimestep(const StateSimulation& sim) const override {
+            return 0.5;
+        }
+
+    private:
+        int& executions_number_;
+        int executions_to_finish_;
+    };
+
+    struct SimulationFixture {
+        Lawn lawn = Lawn(1000, 1000);
+        Mower mower = Mower(120, 100, 90, 100);
+        Logger logger;
+        FileLogger file_logger = FileLogger(
+            (std::filesystem::temp_directory_path() / "command_buffer_tests.log").string());
+        StateSimulation simulation = StateSimulation(lawn, mower, logger, file_logger);
+
+        SimulationFixture() {}
+    };
+
+    void initializeConstants() {
+        Config::initializeRuntimeConstants(1000, 1000);
+        Config::initializeMowerConstants(120, 100, 500.0, 500.0, 0);
+    }
+}
+
+TEST(CommandBufferTest, newBufferIsEmpty) {
+    CommandBuffer buffer;
+
+    EXPECT_TRUE(buffer.isEmpty());
+    EXPECT_EQ(0, buffer.getSize());
+}
+
+TEST(CommandBufferTest, commandsAreExecutedInOrder) {
+    initializeConstants();
+    SimulationFixture fixture;
+    CommandBuffer buffer;
+    unsigned short angle = 0;
+
+    buffer.emplace<RotateCommand>(90);
+    buffer.emplace<GetCurrentAngleCommand>(angle);
+    while (!buffer.isEmpty()) {
+        if (buffer.executeFront(fixture.simulation, 1.0)) {
+            buffer.popFront();
+        }
+    }
+
+    EXPECT_EQ(90, angle);
+}
+
+TEST(CommandBufferTest, maxTimestepComesFromFrontCommand) {
+    initializeConstants();
+    SimulationFixture fixture;
+    CommandBuffer buffer;
+
+    buffer.emplace<MowingOptionCommand>(true);
+    buffer.emplace<RotateCommand>(90);
+
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), buffer.getFrontMaxTimestep(fixture.simulation));
+    buffer.popFront();
+    EXPECT_LT(buffer.getFrontMaxTimestep(fixture.simulation), 1.0);
+}
+
+TEST(CommandBufferTest, userDefinedCommandsAreExecuted) {
+    initializeConstants();
+    SimulationFixture fixture;
+    CommandBuffer buffer;
+    int executions_number = 0;
+
+    buffer.push(std::make_unique<CountingCommand>(executions_number, 2));
+
+    EXPECT_DOUBLE_EQ(0.5, buffer.getFrontMaxTimestep(fixture.simulation));
+    EXPECT_FALSE(buffer.executeFront(fixture.simulation, 0.1));
+    EXPECT_TRUE(buffer.executeFront(fixture.simulation, 0.1));
+    EXPECT_EQ(2, executions_number);
+}
+
+TEST(CommandBufferTest, reservedScriptDoesNotGrowBuffer) {
+    CommandBuffer buffer;
+    buffer.reserve(720);
+    size_t capacity = buffer.getCapacity();
+
+    for (int i = 0; i < 360; ++i) {
+        buffer.emplace<MoveCommand>(1.0);
+        buffer.emplace<RotateCommand>(-1);
+    }
+
+    EXPECT_EQ(720, buffer.getSize());
+    EXPECT_EQ(capacity, buffer.getCapacity());
+}
+
+TEST(CommandBufferTest, memoryIsKeptAfterAllCommandsAreFinished) {
+    CommandBuffer buffer;
+    for (int i = 0; i < 100; ++i) {
+        buffer.emplace<MoveCommand>(1.0);
+    }
+    size_t capacity = buffer.getCapacity();
+
+    for (int i = 0; i < 100; ++i) {
+        buffer.popFront();
+    }
+    for (int i = 0; i < 100; ++i) {
+        buffer.emplace<MoveCommand>(1.0);
+    }
+
+    EXPECT_EQ(100, buffer.getSize());
+    EXPECT_EQ(capacity, buffer.getCapacity());
+}
+
+TEST(CommandBufferTest, waitingCommandsAreMovedToFreeSpace) {
+    initializeConstants();
+    SimulationFixture fixture;
+    CommandBuffer buffer;
+    double out_x = 0.0;
+    double out_y = 0.0;
+    int executions_number = 0;
+    buffer.reserve(4);
+    buffer.emplace<MowingOptionCommand>(true);
+    buffer.emplace<MowingOptionCommand>(false);
+    buffer.emplace<MowingOptionCommand>(true);
+    buffer.push(std::make_unique<CountingCommand>(executions_number, 1));
+    buffer.popFront();
+    buffer.popFront();
+    buffer.popFront();
+
+    buffer.emplace<GetCurrentPositionCommand>(out_x, out_y);
+
+    EXPECT_EQ(2, buffer.getSize());
+    EXPECT_EQ(4, buffer.getCapacity());
+    EXPECT_TRUE(buffer.executeFront(fixture.simulation, 0.1));
+    buffer.popFront();
+    EXPECT_TRUE(buffer.executeFront(fixture.simulation, 0.1));
+    EXPECT_EQ(1, executions_number);
+    EXPECT_DOUBLE_EQ(500.0, out_x);
+    EXPECT_DOUBLE_EQ(500.0, out_y);
+}
+
+TEST(CommandBufferTest, clearRemovesAllCommands) {
+    CommandBuffer buffer;
+    buffer.emplace<MoveCommand>(1.0);
+    buffer.emplace<RotateCommand>(10);
+
+    buffer.clear();
+
+    EXPECT_TRUE(buffer.isEmpty());
+}
+
+TEST(CommandBufferTest, pendingPointMovesAreTakenFromEnd) {
+    CommandBuffer buffer;
+    buffer.emplace<MoveToPointCommand>(0);
+    buffer.emplace<RotateCommand>(10);
+    buffer.emplace<MoveToPointCommand>(3);
+    buffer.emplace<MoveToPointCommand>(1);
+    buffer.emplace<MoveToPointCommand>(2);
+
+    std::vector<unsigned int> point_ids = buffer.takePendingPointMoves();
+
+    EXPECT_EQ(point_ids, std::vector<unsigned int>({3, 1, 2}));
+    EXPECT_EQ(buffer.getSize(), 2);
+    EXPECT_TRUE(buffer.takePendingPointMoves().empty());
+}
+
+TEST(CommandBufferTest, startedPointMoveIsNotTaken) {
+    initializeConstants();
+    SimulationFixture fixture;
+    fixture.simulation.simulateAddPoint(900.0, 900.0);
+    CommandBuffer buffer;
+    buffer.emplace<MoveToPointCommand>(0);
+    buffer.executeFront(fixture.simulation, 0.01);
+
+    EXPECT_TRUE(buffer.takePendingPointMoves().empty());
+    EXPECT_EQ(buffer.getSize(), 1);
+}
+
+TEST(CommandBufferTest, bigPointCommandsAreStoredOutOfLine) {
+    CommandBuffer buffer;
+    buffer.push(std::make_unique<VisitPointsCommand>(std::vector<unsigned int>({0, 1})));
+
+    EXPECT_LT(sizeof(CommandBuffer::Command), sizeof(VisitPointsCommand));
+    EXPECT_EQ(buffer.getSize(), 1);
+}
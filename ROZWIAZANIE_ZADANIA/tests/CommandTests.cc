@@ -7,17 +7,24 @@
 #include "commands/GetDistanceToPointCommand.h"
 #include "commands/MoveCommand.h"
 #include "commands/MoveToPointCommand.h"
+#include "commands/MoveToNearestPointCommand.h"
 #include "commands/MowingOptionCommand.h"
 #include "commands/RotateCommand.h"
 #include "commands/RotateTowardsPointCommand.h"
 #include "commands/GetCurrentPositionCommand.h"
 #include "commands/GetCurrentAngleCommand.h"
+#include "commands/ArcCommand.h"
+#include "commands/PolylineCommand.h"
+#include "commands/SplineCommand.h"
+#include "commands/VisitPointsCommand.h"
 #include "MathHelper.h"
 #include "Lawn.h"
 #include "Mower.h"
 #include "Logger.h"
 #include "FileLogger.h"
 #include "Config.h"
+#include "Constants.h"
+#include "Exceptions.h"
 
 class CommandTests : public ::testing::Test {
 protected:
@@ -180,3 +187,232 @@ TEST_F(CommandTests, GetCurrentAngleCommandRetrievesMowerAngle) {
 
     EXPECT_EQ(outAngle, initialAngle);
 }
+
+TEST_F(CommandTests, MaxTimestepDependsOnCommandType) {
+    MoveCommand move_command(100.0);
+    RotateCommand rotate_command(90);
+
+    EXPECT_TRUE(std::isinf(move_command.getMaxTimestep(*simulation)));
+    EXPECT_DOUBLE_EQ(rotate_command.getMaxTimestep(*simulation), Constants::FINE_TIMESTEP);
+}
+
+TEST_F(CommandTests, MoveToPointCommandUsesFineStepsOnlyNearTarget) {
+    simulation->simulateAddPoint(0.0, 500.0);
+    MoveToPointCommand command(0);
+
+    EXPECT_DOUBLE_EQ(command.getMaxTimestep(*simulation), Constants::FINE_TIMESTEP);
+    command.execute(*simulation, 0.02);
+    EXPECT_TRUE(std::isinf(command.getMaxTimestep(*simulation)));
+
+    command.execute(*simulation, 49.0);
+    EXPECT_DOUBLE_EQ(command.getMaxTimestep(*simulation), Constants::FINE_TIMESTEP);
+}
+
+TEST_F(CommandTests, MoveToPointCommandDrivesAroundObstacles) {
+    lawn->addCircleObstacle({300.0, 300.0}, 80.0, ObstacleType::OBSTACLE);
+    lawn->addPolygonObstacle({{500.0, 450.0}, {650.0, 450.0}, {650.0, 550.0}, {500.0, 550.0}},
+        ObstacleType::NO_GO_ZONE);
+    simulation->simulateAddPoint(700.0, 700.0);
+    MoveToPointCommand command(0);
+
+    int steps = 0;
+    const int APP_TIMEOUT = 10000;
+    while (steps < APP_TIMEOUT && !command.execute(*simulation, command.getMaxTimestep(*simulation))) {
+        steps++;
+    }
+
+    ASSERT_LT(steps, APP_TIMEOUT);
+    EXPECT_NEAR(mower->getX(), 700.0, 3.0);
+    EXPECT_NEAR(mower->getY(), 700.0, 3.0);
+    EXPECT_LE(command.getMaxTimestep(*simulation), 100.0 / mower->getSpeed());
+}
+
+TEST_F(CommandTests, MoveToNearestPointCommandVisitsNearestPoints) {
+    simulation->simulateAddPoint(400.0, 400.0);
+    simulation->simulateAddPoint(100.0, 0.0);
+    simulation->simulateAddPoint(100.0, 150.0);
+
+    std::vector<std::pair<double, double>> visited_points;
+    for (int i = 0; i < 3; i++) {
+        MoveToNearestPointCommand command(true);
+        int steps = 0;
+        while (!command.execute(*simulation, 0.1) && steps < 10000) {
+            steps++;
+        }
+        visited_points.emplace_back(mower->getX(), mower->getY());
+    }
+
+    ASSERT_EQ(visited_points.size(), 3);
+    EXPECT_NEAR(visited_points[0].first, 100.0, 3.0);
+    EXPECT_NEAR(visited_points[0].second, 0.0, 3.0);
+    EXPECT_NEAR(visited_points[1].second, 150.0, 3.0);
+    EXPECT_NEAR(visited_points[2].first, 400.0, 3.0);
+    EXPECT_TRUE(simulation->getPoints().empty());
+}
+
+TEST_F(CommandTests, MoveToNearestPointCommandFinishesWithoutPoints) {
+    MoveToNearestPointCommand command;
+
+    EXPECT_TRUE(command.execute(*simulation, 0.1));
+    EXPECT_DOUBLE_EQ(command.getUnusedTime(), 0.1);
+    EXPECT_DOUBLE_EQ(mower->getX(), 0.0);
+}
+
+TEST_F(CommandTests, VisitPointsCommandVisitsPointsInShorterOrder) {
+    simulation->simulateAddPoint(0.0, 30.0);
+    simulation->simulateAddPoint(0.0, 10.0);
+    simulation->simulateAddPoint(0.0, 20.0);
+    VisitPointsCommand command({0, 1, 2});
+
+    int steps = 0;
+    while (!command.execute(*simulation, 0.1) && steps < 10000) {
+        steps++;
+    }
+
+    // Going straight up takes 3 s, the given order would need two turns back and 5 s of driving
+    EXPECT_NEAR(mower->getX(), 0.0, 3.0);
+    EXPECT_NEAR(mower->getY(), 30.0, 3.0);
+    EXPECT_LT(simulation->getTime(), 4000);
+    EXPECT_EQ(simulation->getPoints().size(), 3);
+}
+
+TEST_F(CommandTests, VisitPointsCommandSkipsMissingPoints) {
+    simulation->simulateAddPoint(0.0, 20.0);
+    VisitPointsCommand command({5, 0, 7});
+
+    int steps = 0;
+    while (!command.execute(*simulation, 0.1) && steps < 10000) {
+        steps++;
+    }
+
+    EXPECT_LT(steps, 10000);
+    EXPECT_NEAR(mower->getY(), 20.0, 3.0);
+}
+
+TEST_F(CommandTests, VisitPointsCommandWithoutPointsFinishesImmediately) {
+    VisitPointsCommand command({});
+
+    EXPECT_TRUE(command.execute(*simulation, 0.1));
+    EXPECT_DOUBLE_EQ(command.getUnusedTime(), 0.1);
+}
+
+TEST_F(CommandTests, MoveCommandInFastForwardFinishesInOneStep) {
+    simulation->setFastForward(true);
+    MoveCommand command(100.0);
+
+    bool finished = command.execute(*simulation, 0.02);
+
+    EXPECT_TRUE(finished);
+    EXPECT_NEAR(mower->getY(), 100.0, Constants::DISTANCE_PRECISION);
+    EXPECT_EQ(simulation->getTime(), 10000);
+}
+
+TEST_F(CommandTests, OnlyCommandsWithoutDurationAreInstantaneous) {
+    MowingOptionCommand mowing_command(true);
+    AddPointCommand add_point_command(10.0, 10.0);
+    MoveCommand move_command(100.0);
+    RotateCommand rotate_command(90);
+
+    EXPECT_TRUE(mowing_command.isInstantaneous());
+    EXPECT_TRUE(add_point_command.isInstantaneous());
+    EXPECT_FALSE(move_command.isInstantaneous());
+    EXPECT_FALSE(rotate_command.isInstantaneous());
+}
+
+TEST_F(CommandTests, MoveCommandReportsUnusedTimeOfLastStep) {
+    MoveCommand command(5.0);
+
+    bool finished = command.execute(*simulation, 1.0);
+
+    EXPECT_TRUE(finished);
+    EXPECT_NEAR(command.getUnusedTime(), 0.5, 1e-9);
+}
+
+TEST_F(CommandTests, RotateCommandReportsUnusedTimeOfLastStep) {
+    RotateCommand command(45);
+
+    bool finished = command.execute(*simulation, 1.0);
+
+    EXPECT_TRUE(finished);
+    EXPECT_NEAR(command.getUnusedTime(), 0.5, 1e-9);
+}
+
+TEST_F(CommandTests, ArcCommandDrivesHalfCircleToTheRight) {
+    mower->setX(500.0);
+    mower->setY(500.0);
+    ArcCommand command(100.0, 180.0);
+
+    while (!command.execute(*simulation, 0.5));
+
+    EXPECT_NEAR(mower->getX(), 700.0, 1e-6);
+    EXPECT_NEAR(mower->getY(), 500.0, 1e-6);
+    EXPECT_EQ(mower->getAngle(), 180);
+}
+
+TEST_F(CommandTests, ArcCommandWithNegativeAngleTurnsLeft) {
+    mower->setX(500.0);
+    mower->setY(500.0);
+    simulation->setFastForward(true);
+    ArcCommand command(100.0, -90.0);
+
+    bool finished = command.execute(*simulation, 0.02);
+
+    EXPECT_TRUE(finished);
+    EXPECT_NEAR(mower->getX(), 400.0, 1e-6);
+    EXPECT_NEAR(mower->getY(), 600.0, 1e-6);
+    EXPECT_EQ(mower->getAngle(), 270);
+}
+
+TEST_F(CommandTests, ArcCommandInFastForwardLeavingLawnMidSweepThrows) {
+    double start_x = 500.0 - 100.0 * sqrt(0.5);
+    double start_y = 920.0 + 100.0 * sqrt(0.5);
+    mower->setX(start_x);
+    mower->setY(start_y);
+    mower->setAngle(45);
+    simulation->setFastForward(true);
+    ArcCommand command(100.0, 90.0);
+
+    EXPECT_THROW(command.execute(*simulation, 0.02), MoveOutsideLawnError);
+    EXPECT_DOUBLE_EQ(mower->getX(), start_x);
+    EXPECT_DOUBLE_EQ(mower->getY(), start_y);
+    EXPECT_EQ(mower->getAngle(), 45);
+}
+
+TEST_F(CommandTests, PolylineCommandPassesSeveralPointsInOneStep) {
+    mower->setX(500.0);
+    mower->setY(500.0);
+    PolylineCommand command({{500.0, 600.0}, {600.0, 600.0}});
+
+    bool finished = command.execute(*simulation, 100.0);
+
+    EXPECT_TRUE(finished);
+    EXPECT_DOUBLE_EQ(mower->getX(), 600.0);
+    EXPECT_DOUBLE_EQ(mower->getY(), 600.0);
+    EXPECT_EQ(mower->getAngle(), 90);
+    EXPECT_NEAR(command.getUnusedTime(), 80.0, 1e-9);
+}
+
+TEST_F(CommandTests, SplineCommandGoesThroughAllPoints) {
+    mower->setX(500.0);
+    mower->setY(500.0);
+    SplineCommand command({{550.0, 550.0}, {600.0, 500.0}});
+    double closest_distance = 1000.0;
+
+    while (!command.execute(*simulation, 0.1)) {
+        closest_distance = std::min(closest_distance, std::hypot(mower->getX() - 550.0, mower->getY() - 550.0));
+    }
+
+    EXPECT_LT(closest_distance, 1.0);
+    EXPECT_DOUBLE_EQ(mower->getX(), 600.0);
+    EXPECT_DOUBLE_EQ(mower->getY(), 500.0);
+}
+
+TEST_F(CommandTests, RotateCommandWithFractionalStepsRotatesByWholeAngle) {
+    RotateCommand right_command(90);
+    RotateCommand left_command(-90);
+
+    while (!right_command.execute(*simulation, 0.013));
+    EXPECT_EQ(mower->getAngle(), 90);
+    while (!left_command.execute(*simulation, 0.013));
+    EXPECT_EQ(mower->getAngle(), 0);
+}
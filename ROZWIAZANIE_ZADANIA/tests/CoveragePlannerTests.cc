@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+#include "CoveragePlanner.h"
+#include "MowerController.h"
+#include "ScenarioReader.h"
+#include "StateSimulation.h"
+#include "Exceptions.h"
+#include "Config.h"
+
+TEST(CoveragePlannerTest, stripesRunAlongLongerSide) {
+    Config::initializeRuntimeConstants(800, 600);
+    Lawn lawn(800, 600);
+    CoveragePlanner planner(lawn, 50, 0.1);
+
+    CoveragePlan plan = planner.createPlan(100);
+    CoveragePlan vertical_plan = planner.createPlan(100, true);
+
+    EXPECT_FALSE(plan.are_stripes_vertical_);
+    EXPECT_EQ(plan.stripes_number_, 14);
+    EXPECT_EQ(plan.turns_number_, 26);
+    EXPECT_GT(vertical_plan.turns_number_, plan.turns_number_);
+    EXPECT_DOUBLE_EQ(plan.starting_point_.first, 25.0);
+    EXPECT_DOUBLE_EQ(plan.starting_point_.second, 25.0);
+    EXPECT_EQ(plan.starting_angle_, 90);
+}
+
+TEST(CoveragePlannerTest, spacingKeepsRequiredOverlap) {
+    Config::initializeRuntimeConstants(1000, 1000);
+    Lawn lawn(1000, 1000);
+
+    for (double overlap : {0.0, 0.1, 0.25, 0.5}) {
+        CoveragePlan plan = CoveragePlanner(lawn, 40, overlap).createPlan(100, true);
+
+        EXPECT_LE(plan.stripe_spacing_, 40 * (1.0 - overlap) + 1e-9);
+        EXPECT_NEAR(plan.stripe_spacing_ * (plan.stripes_number_ - 1), 1000 - 40, 1e-9);
+    }
+}
+
+TEST(CoveragePlannerTest, predictionCountsMovesAndTurns) {
+    Config::initializeRuntimeConstants(1000, 1000);
+    Lawn lawn(1000, 1000);
+    CoveragePlanner planner(lawn, 100, 0.0);
+
+    CoveragePlan plan = planner.createPlan(100, true);
+
+    // 10 stripes of 900 cm, 9 shifts of 100 cm, 18 rotations by 90 degrees
+    EXPECT_EQ(plan.stripes_number_, 10);
+    EXPECT_NEAR(plan.path_length_, 10 * 900 + 9 * 100, 1e-9);
+    EXPECT_NEAR(plan.predicted_time_, 99.0 + 18.0, 1e-9);
+    EXPECT_GT(plan.predicted_coverage_, 0.98);
+    EXPECT_EQ(lawn.calculateShavedArea(), 0.0);
+}
+
+TEST(CoveragePlannerTest, predictedCoverageSkipsObstacleFields) {
+    Config::initializeRuntimeConstants(1000, 1000);
+    Lawn lawn(1000, 1000);
+    Lawn lawn_with_obstacle(1000, 1000);
+    lawn_with_obstacle.addCircleObstacle(std::make_pair(500.0, 500.0), 200.0, ObstacleType::OBSTACLE);
+
+    CoveragePlan plan = CoveragePlanner(lawn, 100, 0.0).createPlan(100, true);
+    CoveragePlan obstacle_plan = CoveragePlanner(lawn_with_obstacle, 100, 0.0).createPlan(100, true);
+
+    // the obstacle lies inside the mowed area, its fields are neither mowed nor counted
+    double fields_number = static_cast<double>(lawn.getFieldGrid().getColumnsNumber()) * 
+        lawn.getFieldGrid().getRowsNumber();
+    double obstacle_fields_number = static_cast<double>(lawn_with_obstacle.getObstacleFields().countCutFields());
+    EXPECT_GT(obstacle_fields_number, 0.0);
+    EXPECT_NEAR(obstacle_plan.predicted_coverage_, (plan.predicted_coverage_ * fields_number - obstacle_fields_number)
+        / (fields_number - obstacle_fields_number), 1e-9);
+    EXPECT_EQ(lawn_with_obstacle.calculateShavedArea(), 0.0);
+}
+
+TEST(CoveragePlannerTest, invalidParametersThrow) {
+    Config::initializeRuntimeConstants(1000, 1000);
+    Lawn lawn(1000, 1000);
+
+    EXPECT_THROW(CoveragePlanner(lawn, 50, 1.0), CoveragePlanError);
+    EXPECT_THROW(CoveragePlanner(lawn, 50, -0.1), CoveragePlanError);
+    EXPECT_THROW(CoveragePlanner(lawn, 0, 0.1), CoveragePlanError);
+    EXPECT_THROW(CoveragePlanner(lawn, 50, 0.1).createPlan(0), CoveragePlanError);
+}
+
+TEST(CoveragePlannerTest, simulatedPlanMatchesPrediction) {
+    Config::initializeRuntimeConstants(800, 600);
+    Config::initializeMowerConstants(50, 50, 400.0, 300.0, 45);
+    Lawn lawn(800, 600);
+    Mower mower(50, 50, 50, 100);
+    Logger logger;
+    FileLogger fileLogger("test_coverage_planner.log");
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    MowerController controller;
+    CoveragePlan plan = CoveragePlanner(lawn, 50, 0.1).createPlan(100);
+
+    CoveragePlanner::emitPlan(plan, controller);
+    while (controller.getQueueSize() > 0) {
+        controller.update(simulation, 0.02);
+    }
+
+    EXPECT_NEAR(lawn.calculateShavedArea(), plan.predicted_coverage_, 1e-3);
+    EXPECT_GT(lawn.calculateShavedArea(), 0.99);
+    // the simulation rounds time of every step up to 10 ms, so it takes a bit longer
+    EXPECT_GE(simulation.getTime() / 1000.0, plan.predicted_time_);
+    EXPECT_LT(simulation.getTime() / 1000.0, plan.predicted_time_ * 1.2);
+    EXPECT_FALSE(simulation.getMower().getIsMowing());
+}
+
+TEST(CoveragePlannerTest, planIsWrittenAsScenario) {
+    std::string path = "test_coverage_planner.txt";
+    Config::initializeRuntimeConstants(800, 600);
+    Lawn lawn(800, 600);
+    CoveragePlan plan = CoveragePlanner(lawn, 50, 0.1).createPlan(100);
+    ScenarioParameters parameters;
+    parameters.lawn_width_ = 800;
+    parameters.lawn_length_ = 600;
+    parameters.mower_width_ = 50;
+    parameters.mower_length_ = 50;
+    parameters.blade_diameter_ = 50;
+    parameters.speed_ = 100;
+
+    CoveragePlanner::writeScenario(plan, path, parameters, ScenarioFormat::TEXT);
+    ScenarioReader reader(path);
+    ScenarioCommand command;
+    std::vector<ScenarioCommand> commands;
+    while (reader.readCommand(command)) {
+        commands.push_back(command);
+    }
+
+    EXPECT_DOUBLE_EQ(reader.getParameters().starting_x_, plan.starting_point_.first);
+    EXPECT_DOUBLE_EQ(reader.getParameters().starting_y_, plan.starting_point_.second);
+    EXPECT_EQ(reader.getParameters().starting_angle_, plan.starting_angle_);
+    ASSERT_EQ(commands.size(), plan.commands_.size());
+    for (size_t i = 0; i < commands.size(); ++i) {
+        EXPECT_EQ(commands[i].getType(), plan.commands_[i].getType());
+        EXPECT_NEAR(commands[i].getValue(0), plan.commands_[i].getValue(0), 1e-9);
+    }
+}
@@ -418,4 +418,89 @@ TEST_F(EngineTests, simulationStopsOnMoveOutsideLawn) {
 
     EXPECT_TRUE(stopped);
     EXPECT_FALSE(engine.isRunning());
-}
\ No newline at end of file
+}
+
+TEST_F(EngineTests, PerformanceMetricsArePublished) {
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(1000, 1000);
+    Mower mower(30, 40, 15, 20);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    MowerController controller;
+    controller.rotate(360);
+    controller.rotate(360);
+    controller.rotate(360);
+
+    Engine engine(simulation, [&controller](StateSimulation& s, double dt) {
+        controller.update(s, dt);
+    });
+    engine.setCommandQueueDepthProvider([&controller]() {
+        return controller.getQueueSize();
+    });
+
+    // Every rotation takes 4 s of simulation time, which is never simulated faster than real time,
+    // so all rotations are still queued when the ticks per second are measured for the first time
+    const PerformanceMetrics& metrics = engine.getPerformanceMetrics();
+    engine.start();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (metrics.ticks_per_second_.load() == 0.0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    engine.stop();
+
+    EXPECT_GT(metrics.simulation_ticks_.load(), 0u);
+    EXPECT_GT(metrics.ticks_per_second_.load(), 0.0);
+    EXPECT_EQ(metrics.command_queue_depth_.load(), 3u);
+}
+
+TEST_F(EngineTests, EngineWaitsForCommandsWhenQueueIsEmpty) {
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(1000, 1000);
+    Mower mower(30, 40, 15, 20);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    MowerController controller;
+
+    Engine engine(simulation, [&controller](StateSimulation& s, double dt) {
+        controller.update(s, dt);
+    });
+    engine.setCommandQueueDepthProvider([&controller]() {
+        return controller.getQueueSize();
+    });
+    controller.setCommandAddedCallback([&engine]() {
+        engine.wakeUp();
+    });
+
+    engine.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    uint64_t idle_ticks = engine.getPerformanceMetrics().simulation_ticks_.load();
+
+    // The controller locks its queue, so the command can be pushed while the engine thread is running
+    controller.rotate(360);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (engine.getPerformanceMetrics().simulation_ticks_.load() <= idle_ticks + 5 &&
+        std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    uint64_t busy_ticks = engine.getPerformanceMetrics().simulation_ticks_.load() - idle_ticks;
+    engine.stop();
+
+    EXPECT_EQ(idle_ticks, 0u);
+    EXPECT_GT(busy_ticks, 5u);
+}
+
+TEST_F(EngineTests, FixedTimestepIsConfigurableAndClamped) {
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(100, 100);
+    Mower mower(30, 40, 15, 20);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+
+    Engine default_engine(simulation);
+    Engine coarse_engine(simulation, nullptr, nullptr, 0.25);
+    Engine too_fine_engine(simulation, nullptr, nullptr, 0.0);
+
+    EXPECT_DOUBLE_EQ(default_engine.getFixedTimestep(), Constants::DEFAULT_TIMESTEP);
+    EXPECT_DOUBLE_EQ(coarse_engine.getFixedTimestep(), 0.25);
+    EXPECT_DOUBLE_EQ(too_fine_engine.getFixedTimestep(), Constants::MIN_TIMESTEP);
+}
@@ -0,0 +1,99 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Tests FieldGrid class methods.
+*/
+
+#include <gtest/gtest.h>
+#include "../include/FieldGrid.h"
+
+using namespace std;
+
+
+TEST(FieldGridTest, newGridHasNoCutFields) {
+    FieldGrid grid(70, 3);
+
+    EXPECT_EQ(grid.getColumnsNumber(), 70);
+    EXPECT_EQ(grid.getRowsNumber(), 3);
+    EXPECT_EQ(grid.countCutFields(), 0);
+    EXPECT_FALSE(grid.isFieldCut(69, 2));
+}
+
+
+TEST(FieldGridTest, rowsAreAlignedToWords) {
+    FieldGrid grid(70, 3);
+
+    EXPECT_EQ(grid.getWordsPerRow(), 3);
+    EXPECT_EQ(grid.getWords().size(), 9);
+}
+
+
+TEST(FieldGridTest, defaultGridIsEmpty) {
+    FieldGrid grid;
+
+    EXPECT_TRUE(grid.isEmpty());
+    EXPECT_FALSE(FieldGrid(1, 1).isEmpty());
+}
+
+
+TEST(FieldGridTest, cutFieldSetsLeastSignificantBitFirst) {
+    FieldGrid grid(40, 2);
+
+    grid.cutField(0, 0);
+    grid.cutField(33, 1);
+
+    EXPECT_TRUE(grid.isFieldCut(0, 0));
+    EXPECT_TRUE(grid.isFieldCut(33, 1));
+    EXPECT_FALSE(grid.isFieldCut(33, 0));
+    EXPECT_EQ(grid.getWords()[0], 1u);
+    EXPECT_EQ(grid.getWords()[3], 2u);
+    EXPECT_EQ(grid.countCutFields(), 2);
+}
+
+
+TEST(FieldGridTest, cuttingFieldTwiceCountsOnce) {
+    FieldGrid grid(10, 10);
+
+    grid.cutField(5, 5);
+    grid.cutField(5, 5);
+
+    EXPECT_EQ(grid.countCutFields(), 1);
+}
+
+
+TEST(FieldGridTest, fieldsOutsideGridAreIgnored) {
+    FieldGrid grid(10, 10);
+
+    grid.cutField(10, 0);
+    grid.cutField(0, 10);
+
+    EXPECT_EQ(grid.countCutFields(), 0);
+}
+
+
+TEST(FieldGridTest, toVectorsMatchesGrid) {
+    FieldGrid grid(35, 2);
+    grid.cutField(34, 0);
+    grid.cutField(1, 1);
+
+    vector<vector<bool>> fields = grid.toVectors();
+
+    ASSERT_EQ(fields.size(), 2);
+    ASSERT_EQ(fields[0].size(), 35);
+    EXPECT_TRUE(fields[0][34]);
+    EXPECT_TRUE(fields[1][1]);
+    EXPECT_FALSE(fields[1][34]);
+}
+
+
+TEST(FieldGridTest, equalityComparesSizeAndFields) {
+    FieldGrid first(10, 10);
+    FieldGrid second(10, 10);
+    FieldGrid other_size(10, 11);
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other_size);
+
+    first.cutField(3, 4);
+    EXPECT_NE(first, second);
+}
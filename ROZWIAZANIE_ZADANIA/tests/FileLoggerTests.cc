@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "../include/FileLogger.h"
+
+using namespace std;
+
+namespace {
+    string readFile(const string& path) {
+        ifstream file(path);
+        stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    string createEmptyFile(const string& path) {
+        remove(path.c_str());
+        return path;
+    }
+}
+
+TEST(FileLoggerTest, writesLogsAndMessagesInLogFormat) {
+    string path = createEmptyFile("file_logger_format_test.log");
+    FileLogger file_logger(path);
+
+    file_logger.saveLog(Log(10, "First"));
+    file_logger.saveMessage("Message");
+    file_logger.saveLog(Log(18446744073709551615ULL, "Last"));
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path), "Time: 10: First\nMessage\nTime: 18446744073709551615: Last\n");
+}
+
+TEST(FileLoggerTest, logsAreWrittenWhenLoggerIsDestroyed) {
+    string path = createEmptyFile("file_logger_destroy_test.log");
+    {
+        FileLogger file_logger(path);
+        file_logger.saveLog(Log(10, "First"));
+    }
+
+    EXPECT_EQ(readFile(path), "Time: 10: First\n");
+}
+
+TEST(FileLoggerTest, logsAreAppendedToExistingFile) {
+    string path = createEmptyFile("file_logger_append_test.log");
+    {
+        ofstream file(path);
+        file << "Existing line\n";
+    }
+    FileLogger file_logger(path);
+
+    file_logger.saveMessage("New line");
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path), "Existing line\nNew line\n");
+}
+
+TEST(FileLoggerTest, copiesShareFileAndKeepOrder) {
+    string path = createEmptyFile("file_logger_copy_test.log");
+    FileLogger file_logger(path);
+    {
+        FileLogger copy(file_logger);
+        file_logger.saveLog(Log(10, "Original"));
+        copy.saveLog(Log(20, "Copy"));
+    }
+    file_logger.saveMessage("Original again");
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path), "Time: 10: Original\nTime: 20: Copy\nOriginal again\n");
+}
+
+TEST(FileLoggerTest, logsBiggerThanBufferAreNotLost) {
+    string path = createEmptyFile("file_logger_big_test.log");
+    string expected;
+    {
+        FileLogger file_logger(path);
+        for (int i = 0; i < 20000; ++i) {
+            file_logger.saveLog(Log(i, "Message " + to_string(i)));
+            expected += "Time: " + to_string(i) + ": Message " + to_string(i) + "\n";
+        }
+    }
+
+    EXPECT_GT(expected.size(), FileLogger::BUFFER_SIZE);
+    EXPECT_EQ(readFile(path), expected);
+}
+
+TEST(FileLoggerTest, flushWritesAsynchronousLogs) {
+    string path = createEmptyFile("file_logger_async_flush_test.log");
+    FileLogger file_logger(path);
+    file_logger.enableAsyncWriting();
+
+    file_logger.saveLog(Log(10, "First"));
+    file_logger.saveMessage("Second");
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path), "Time: 10: First\nSecond\n");
+}
+
+TEST(FileLoggerTest, recordsAreWrittenInLogFormat) {
+    string path = createEmptyFile("file_logger_record_test.log");
+    FileLogger file_logger(path);
+
+    file_logger.saveRecord(LogRecord(LogEventType::ROTATED, 10, 90));
+    file_logger.saveRecord(LogRecord(LogEventType::MOVING_TO_POINT, 20, 4));
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path), "Time: 10: Rotated: 90 degrees.\nTime: 20: Moving to point with id:  4\n");
+}
+
+TEST(FileLoggerTest, binaryLogIsRenderedAsTextLog) {
+    string text_path = createEmptyFile("file_logger_text_test.log");
+    string binary_path = createEmptyFile("file_logger_binary_test.log");
+    {
+        FileLogger text_logger(text_path);
+        FileLogger binary_logger(binary_path, LogFileFormat::BINARY);
+        binary_logger.enableAsyncWriting();
+        for (int i = 0; i < 100; ++i) {
+            LogRecord record(LogEventType::MOVED, i * 10, 0.5, i * 0.5, 1.0);
+            text_logger.saveRecord(record);
+            binary_logger.saveRecord(record);
+        }
+        text_logger.saveLog(Log(1000, "Attempted to move outside the lawn."));
+        binary_logger.saveLog(Log(1000, "Attempted to move outside the lawn."));
+        text_logger.saveMessage("Last message");
+        binary_logger.saveMessage("Last message");
+    }
+
+    ifstream binary_log(binary_path, ios::binary);
+    ASSERT_TRUE(LogRecord::readBinaryHeader(binary_log));
+    string rendered_log;
+    LogRecord record;
+    while (record.readBinary(binary_log)) {
+        rendered_log += record.formatLine() + "\n";
+    }
+    EXPECT_EQ(rendered_log, readFile(text_path));
+}
+
+TEST(FileLoggerTest, binaryLogHeaderIsWrittenOnce) {
+    string path = createEmptyFile("file_logger_binary_append_test.log");
+    {
+        FileLogger file_logger(path, LogFileFormat::BINARY);
+        file_logger.saveRecord(LogRecord(LogEventType::MOWING_ON, 10));
+    }
+    {
+        FileLogger file_logger(path, LogFileFormat::BINARY);
+        file_logger.saveRecord(LogRecord(LogEventType::MOWING_OFF, 20));
+    }
+
+    ifstream binary_log(path, ios::binary);
+    ASSERT_TRUE(LogRecord::readBinaryHeader(binary_log));
+    LogRecord first;
+    LogRecord second;
+    ASSERT_TRUE(first.readBinary(binary_log));
+    ASSERT_TRUE(second.readBinary(binary_log));
+    EXPECT_EQ(first, LogRecord(LogEventType::MOWING_ON, 10));
+    EXPECT_EQ(second, LogRecord(LogEventType::MOWING_OFF, 20));
+}
+
+TEST(FileLoggerTest, filteredOutRecordsAreNotWritten) {
+    string path = createEmptyFile("file_logger_filter_test.log");
+    FileLogger file_logger(path);
+    FileLogger copy(file_logger);
+    file_logger.enableAsyncWriting();
+
+    copy.getFilter().setMinLevel(LogLevel::ERROR);
+    file_logger.saveRecord(LogRecord(LogEventType::MOVED, 10, 1.0, 2.0, 3.0));
+    copy.saveRecord(LogRecord(LogEventType::ROTATED, 20, 90));
+    file_logger.saveRecord(LogRecord(LogEventType::MOVED_OUTSIDE_LAWN, 30));
+    file_logger.saveMessage("Message");
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path), "Time: 30: Attempted to move outside the lawn.\nMessage\n");
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "../include/Config.h"
+#include "../include/Exceptions.h"
+#include "../include/FleetSimulation.h"
+
+using namespace std;
+
+namespace {
+    constexpr unsigned int LAWN_WIDTH = 1000;
+    constexpr unsigned int LAWN_LENGTH = 1000;
+    constexpr unsigned int MOWER_WIDTH = 120;
+    constexpr unsigned int MOWER_LENGTH = 100;
+    constexpr unsigned int BLADE_DIAMETER = 90;
+    constexpr unsigned int SPEED = 100;
+
+    void addMower(FleetSimulation& fleet, double x, double y) {
+        Mower mower_template(MOWER_WIDTH, MOWER_LENGTH, BLADE_DIAMETER, SPEED);
+        mower_template.setX(x);
+        mower_template.setY(y);
+        fleet.addMower(mower_template);
+    }
+
+    void initializeConstants() {
+        Config::initializeRuntimeConstants(LAWN_WIDTH, LAWN_LENGTH);
+        Config::initializeMowerConstants(MOWER_WIDTH, MOWER_LENGTH, 0.0, 0.0, 0);
+    }
+}
+
+TEST(FleetSimulationTest, addMowerCopiesPoseOfTemplate) {
+    initializeConstants();
+    Lawn lawn(LAWN_WIDTH, LAWN_LENGTH);
+    FleetSimulation fleet(lawn, "example_path", 2);
+    Mower mower_template(MOWER_WIDTH, MOWER_LENGTH, BLADE_DIAMETER, SPEED);
+    mower_template.setX(300.0);
+    mower_template.setY(200.0);
+    mower_template.setAngle(90);
+
+    unsigned int mower_index = fleet.addMower(mower_template);
+
+    EXPECT_EQ(mower_index, 0);
+    EXPECT_EQ(fleet.getMowersNumber(), 1);
+    EXPECT_TRUE(fleet.getSimulation(0).getMower() == mower_template);
+    EXPECT_TRUE(fleet.getSimulation(0).isCuttingDeferred());
+}
+
+TEST(FleetSimulationTest, updateStepsAllMowers) {
+    initializeConstants();
+    Lawn lawn(LAWN_WIDTH, LAWN_LENGTH);
+    FleetSimulation fleet(lawn, "example_path", 2);
+    addMower(fleet, 200.0, 100.0);
+    addMower(fleet, 800.0, 100.0);
+    fleet.getController(0).move(300.0);
+    fleet.getController(1).move(500.0);
+
+    for (int i = 0; i < 10; ++i) {
+        fleet.update(1.0);
+    }
+
+    EXPECT_NEAR(fleet.getSimulation(0).getMower().getY(), 400.0, 1e-6);
+    EXPECT_NEAR(fleet.getSimulation(1).getMower().getY(), 600.0, 1e-6);
+    EXPECT_EQ(fleet.getQueueSize(), 0);
+}
+
+TEST(FleetSimulationTest, fleetCutsSameFieldsAsMowersSimulatedOneByOne) {
+    initializeConstants();
+    Lawn fleet_lawn(LAWN_WIDTH, LAWN_LENGTH);
+    Lawn expected_lawn(LAWN_WIDTH, LAWN_LENGTH);
+    FleetSimulation fleet(fleet_lawn, "example_path", 4);
+    double starting_x[] = {150.0, 400.0, 650.0, 900.0};
+
+    for (double x : starting_x) {
+        addMower(fleet, x, 100.0);
+        Mower mower(MOWER_WIDTH, MOWER_LENGTH, BLADE_DIAMETER, SPEED);
+        mower.setX(x);
+        mower.setY(100.0);
+        Logger logger;
+        FileLogger file_logger("example_path");
+        StateSimulation simulation(expected_lawn, mower, logger, file_logger);
+        simulation.simulateMovement(700.0);
+    }
+    for (unsigned int i = 0; i < fleet.getMowersNumber(); ++i) {
+        fleet.getController(i).move(700.0);
+    }
+    for (int i = 0; i < 10; ++i) {
+        fleet.update(1.0);
+    }
+
+    EXPECT_GT(fleet_lawn.calculateShavedArea(), 0.0);
+    EXPECT_TRUE(fleet_lawn == expected_lawn);
+}
+
+TEST(FleetSimulationTest, failedMowerDoesNotStopOtherMowers) {
+    initializeConstants();
+    Lawn lawn(LAWN_WIDTH, LAWN_LENGTH);
+    FleetSimulation fleet(lawn, "example_path", 2);
+    addMower(fleet, 200.0, 100.0);
+    addMower(fleet, 800.0, 900.0);
+    fleet.getController(0).move(300.0);
+    fleet.getController(1).move(500.0);
+
+    EXPECT_THROW(fleet.update(10.0), MoveOutsideLawnError);
+
+    EXPECT_NEAR(fleet.getSimulation(0).getMower().getY(), 400.0, 1e-6);
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+    EXPECT_TRUE(fleet.getSimulation(0).getPendingFields().empty());
+}
+
+TEST(FleetSimulationTest, snapshotContainsAllMowers) {
+    initializeConstants();
+    Lawn lawn(LAWN_WIDTH, LAWN_LENGTH);
+    FleetSimulation fleet(lawn, "example_path", 2);
+    addMower(fleet, 200.0, 100.0);
+    addMower(fleet, 500.0, 300.0);
+    addMower(fleet, 800.0, 600.0);
+    fleet.getController(2).move(100.0);
+    fleet.update(1.0);
+
+    SimulationSnapshot sim_snapshot = fleet.buildSimulationSnapshot();
+
+    EXPECT_DOUBLE_EQ(sim_snapshot.x_, 200.0);
+    EXPECT_DOUBLE_EQ(sim_snapshot.y_, 100.0);
+    ASSERT_EQ(sim_snapshot.other_mowers_.size(), 2);
+    EXPECT_DOUBLE_EQ(sim_snapshot.other_mowers_[0].x_, 500.0);
+    EXPECT_DOUBLE_EQ(sim_snapshot.other_mowers_[1].y_, 700.0);
+    EXPECT_DOUBLE_EQ(sim_snapshot.simulation_time_, static_cast<double>(fleet.getSimulation(2).getTime()));
+}
+
+TEST(FleetSimulationTest, createMowerLogPathAddsIndexBeforeExtension) {
+    EXPECT_EQ(FleetSimulation::createMowerLogPath("../logs.log", 0), "../logs.log");
+    EXPECT_EQ(FleetSimulation::createMowerLogPath("../logs.log", 2), "../logs_mower2.log");
+    EXPECT_EQ(FleetSimulation::createMowerLogPath("../logs", 1), "../logs_mower1");
+}
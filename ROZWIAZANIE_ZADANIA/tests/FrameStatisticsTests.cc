@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "../include/FrameStatistics.h"
+
+TEST(FrameStatisticsTest, emptyStatisticsReturnZero) {
+    FrameStatistics statistics;
+
+    EXPECT_EQ(statistics.getSamplesCount(), 0);
+    EXPECT_DOUBLE_EQ(statistics.getFramesPerSecond(), 0.0);
+    EXPECT_DOUBLE_EQ(statistics.getPercentileFrameTimeMs(99.0), 0.0);
+}
+
+TEST(FrameStatisticsTest, framesPerSecondUsesAverageFrameTime) {
+    FrameStatistics statistics;
+
+    statistics.addFrameTime(10.0);
+    statistics.addFrameTime(30.0);
+
+    EXPECT_DOUBLE_EQ(statistics.getAverageFrameTimeMs(), 20.0);
+    EXPECT_DOUBLE_EQ(statistics.getFramesPerSecond(), 50.0);
+}
+
+TEST(FrameStatisticsTest, percentilesUseNearestRank) {
+    FrameStatistics statistics;
+    for (int i = 100; i >= 1; --i) {
+        statistics.addFrameTime(static_cast<double>(i));
+    }
+
+    EXPECT_DOUBLE_EQ(statistics.getPercentileFrameTimeMs(50.0), 50.0);
+    EXPECT_DOUBLE_EQ(statistics.getPercentileFrameTimeMs(99.0), 99.0);
+    EXPECT_DOUBLE_EQ(statistics.getPercentileFrameTimeMs(100.0), 100.0);
+    EXPECT_DOUBLE_EQ(statistics.getPercentileFrameTimeMs(0.0), 1.0);
+}
+
+TEST(FrameStatisticsTest, oldestFramesAreReplacedWhenFull) {
+    FrameStatistics statistics(3);
+
+    statistics.addFrameTime(100.0);
+    statistics.addFrameTime(10.0);
+    statistics.addFrameTime(10.0);
+    statistics.addFrameTime(10.0);
+
+    EXPECT_EQ(statistics.getSamplesCount(), 3);
+    EXPECT_DOUBLE_EQ(statistics.getAverageFrameTimeMs(), 10.0);
+    EXPECT_DOUBLE_EQ(statistics.getPercentileFrameTimeMs(100.0), 10.0);
+}
+
+TEST(FrameStatisticsTest, clearRemovesAllSamples) {
+    FrameStatistics statistics;
+    statistics.addFrameTime(16.0);
+
+    statistics.clear();
+
+    EXPECT_EQ(statistics.getSamplesCount(), 0);
+    EXPECT_DOUBLE_EQ(statistics.getAverageFrameTimeMs(), 0.0);
+}
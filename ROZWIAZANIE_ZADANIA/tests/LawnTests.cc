@@ -10,6 +10,7 @@
 #include "../include/Lawn.h"
 #include "../include/Constants.h"
 #include "../include/Config.h"
+#include "../include/MathHelper.h"
 
 using namespace std;
 
@@ -690,3 +691,359 @@ TEST(cutGrassSection, cutNormalAreaAllInside4) {
 }
 
 
+
+
+TEST(PassCounting, disabledByDefault) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+
+    lawn.cutGrass(pair<double, double>(500, 500), Config::MIN_BLADE_DIAMETER);
+
+    EXPECT_FALSE(lawn.isPassCountingEnabled());
+    EXPECT_TRUE(lawn.getPassCounts().empty());
+    EXPECT_EQ(lawn.calculateOverlapRatio(), 0.0);
+}
+
+
+TEST(PassCounting, singleCutCountsOnePass) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+
+    lawn.cutGrass(pair<double, double>(500, 500), Config::MIN_BLADE_DIAMETER);
+    const vector<uint8_t>& pass_counts = lawn.getPassCounts();
+    unsigned int cut_fields = 0;
+    for (uint8_t passes : pass_counts) {
+        EXPECT_LE(passes, 1);
+        cut_fields += passes;
+    }
+
+    EXPECT_EQ(pass_counts.size(), static_cast<size_t>(lawn.getFields().size() * lawn.getFields()[0].size()));
+    EXPECT_GT(cut_fields, 0);
+    EXPECT_EQ(lawn.calculateOverlapRatio(), 0.0);
+}
+
+
+TEST(PassCounting, consecutiveSectionsAreOnePass) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
+
+    lawn.cutGrassSection(pair<double, double>(250, 250), blade_diameter, pair<double, double>(250, 500), 0);
+    lawn.cutGrassSection(pair<double, double>(250, 500), blade_diameter, pair<double, double>(250, 750), 0);
+
+    for (uint8_t passes : lawn.getPassCounts()) {
+        EXPECT_LE(passes, 1);
+    }
+    EXPECT_EQ(lawn.calculateOverlapRatio(), 0.0);
+}
+
+
+TEST(PassCounting, revisitedFieldsCountTwoPasses) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
+    pair<double, double> blade_middle (250, 250);
+
+    lawn.cutGrass(blade_middle, blade_diameter);
+    lawn.cutGrass(pair<double, double>(750, 750), blade_diameter);
+    lawn.beginPass(pair<double, double>(750, 750), blade_diameter);
+    lawn.cutGrass(blade_middle, blade_diameter);
+
+    pair<unsigned int, unsigned int> indexes = lawn.calculateFieldIndexes(blade_middle.first, blade_middle.second);
+    size_t index = static_cast<size_t>(indexes.second) * lawn.getFields()[0].size() + indexes.first;
+    EXPECT_EQ(lawn.getPassCounts()[index], 2);
+    EXPECT_NEAR(lawn.calculateOverlapRatio(), 1.0 / 3.0, 0.01);
+}
+
+
+TEST(PassCounting, fieldsRevisitedInOnePassCountOnce) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
+
+    lawn.cutGrassSection(pair<double, double>(500, 250), blade_diameter, pair<double, double>(500, 750), 0);
+    lawn.cutGrassSection(pair<double, double>(500, 750), blade_diameter, pair<double, double>(500, 250), 180);
+
+    for (uint8_t passes : lawn.getPassCounts()) {
+        EXPECT_LE(passes, 1);
+    }
+}
+
+
+TEST(PassCounting, fieldsUnderBladeStayInPreviousPass) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
+
+    lawn.cutGrassSection(pair<double, double>(500, 250), blade_diameter, pair<double, double>(500, 500), 0);
+    uint32_t first_pass_id = lawn.getPassId();
+    uint32_t second_pass_id = lawn.beginPass(pair<double, double>(500, 500), blade_diameter);
+    lawn.cutGrassSection(pair<double, double>(500, 500), blade_diameter, pair<double, double>(500, 750), 0);
+
+    for (uint8_t passes : lawn.getPassCounts()) {
+        EXPECT_LE(passes, 1);
+    }
+    EXPECT_NE(first_pass_id, second_pass_id);
+    EXPECT_EQ(lawn.getPassId(), second_pass_id);
+}
+
+
+TEST(PassCounting, alreadyMowedFieldsCountAsOnePass) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> blade_middle (500, 500);
+
+    lawn.cutGrass(blade_middle, Config::MIN_BLADE_DIAMETER);
+    lawn.enablePassCounting();
+    lawn.cutGrass(blade_middle, Config::MIN_BLADE_DIAMETER);
+
+    pair<unsigned int, unsigned int> indexes = lawn.calculateFieldIndexes(blade_middle.first, blade_middle.second);
+    size_t index = static_cast<size_t>(indexes.second) * lawn.getFields()[0].size() + indexes.first;
+    EXPECT_EQ(lawn.getPassCounts()[index], 2);
+}
+
+
+TEST(CollectGrassSection, collectedFieldsMatchCutSection) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn cut_lawn = Lawn(lawn_width, lawn_length);
+    Lawn collected_lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> blade_middle (250, 250);
+    pair<double, double> ending_point (750, 750);
+    unsigned short angle = 45;
+    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
+    vector<pair<unsigned int, unsigned int>> fields;
+
+    cut_lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    collected_lawn.collectGrassSection(blade_middle, blade_diameter, ending_point, angle, fields);
+
+    EXPECT_FALSE(fields.empty());
+    EXPECT_EQ(collected_lawn.calculateShavedArea(), 0.0);
+
+    collected_lawn.cutFields(fields);
+
+    EXPECT_TRUE(collected_lawn == cut_lawn);
+}
+
+
+TEST(CollectGrassSection, collectedFieldsOfOnePassAreCountedOnce) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
+    vector<pair<unsigned int, unsigned int>> first_mower_fields;
+    vector<pair<unsigned int, unsigned int>> second_mower_fields;
+
+    lawn.collectGrassSection(pair<double, double>(500, 250), blade_diameter, pair<double, double>(500, 500), 0,
+        first_mower_fields);
+    lawn.collectGrassSection(pair<double, double>(500, 500), blade_diameter, pair<double, double>(500, 750), 0,
+        second_mower_fields);
+    lawn.cutFields(first_mower_fields);
+    lawn.cutFields(second_mower_fields);
+
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+    EXPECT_EQ(lawn.calculateOverlapRatio(), 0.0);
+}
+
+
+TEST(ParallelCutting, defaultConfiguration) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+
+    EXPECT_EQ(lawn.getCuttingThreadsNumber(), 0);
+    EXPECT_EQ(lawn.getMinParallelFields(), Lawn::DEFAULT_MIN_PARALLEL_FIELDS);
+}
+
+
+TEST(ParallelCutting, parallelCutsAreEqualToSerialCuts) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn serial_lawn = Lawn(lawn_width, lawn_length);
+    Lawn parallel_lawn = Lawn(lawn_width, lawn_length);
+    serial_lawn.enablePassCounting();
+    parallel_lawn.enablePassCounting();
+    serial_lawn.setParallelCutting(1, 0);
+    parallel_lawn.setParallelCutting(4, 0);
+    unsigned int blade_diameter = Config::MAX_BLADE_DIAMETER;
+
+    for (Lawn* lawn : {&serial_lawn, &parallel_lawn}) {
+        lawn->cutGrassSection(pair<double, double>(100, 100), blade_diameter, pair<double, double>(700, 400), 63);
+        lawn->beginPass(pair<double, double>(500, 50), blade_diameter);
+        lawn->cutGrassSection(pair<double, double>(500, 50), blade_diameter, pair<double, double>(500, 950), 0);
+        lawn->beginPass(pair<double, double>(900, 800), blade_diameter);
+        lawn->cutGrassSection(pair<double, double>(900, 800), blade_diameter, pair<double, double>(300, 200), 225);
+        lawn->beginPass(pair<double, double>(0, 500), blade_diameter);
+        lawn->cutRectangularGrass(pair<double, double>(0, 500), blade_diameter, pair<double, double>(1000, 500), 90);
+        lawn->beginPass(pair<double, double>(990, 990), blade_diameter);
+        lawn->cutGrass(pair<double, double>(990, 990), blade_diameter);
+    }
+
+    EXPECT_TRUE(parallel_lawn == serial_lawn);
+    EXPECT_EQ(parallel_lawn.getPassCounts(), serial_lawn.getPassCounts());
+    EXPECT_GT(parallel_lawn.calculateOverlapRatio(), 0.0);
+}
+
+
+TEST(CutGrassArc, fullCircleCutsOnlyRing) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> arc_middle(500, 500);
+    unsigned int blade_diameter = 40;
+
+    lawn.cutGrassArc(arc_middle, 200, 0, 360, blade_diameter);
+    vector<vector<bool>> fields = lawn.getFields();
+
+    auto isMowed = [&](double x, double y) {
+        pair<unsigned int, unsigned int> indexes = lawn.calculateFieldIndexes(x, y);
+        return static_cast<bool>(fields[indexes.second][indexes.first]);
+    };
+    EXPECT_TRUE(isMowed(500, 700));
+    EXPECT_TRUE(isMowed(300, 500));
+    EXPECT_TRUE(isMowed(500 + 200 * cos(M_PI / 4), 500 + 200 * sin(M_PI / 4)));
+    EXPECT_TRUE(isMowed(500, 315));
+    EXPECT_FALSE(isMowed(500, 500));
+    EXPECT_FALSE(isMowed(500, 750));
+    EXPECT_FALSE(isMowed(500, 260));
+}
+
+
+TEST(CutGrassArc, halfCircleCutsOnlyItsSide) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Lawn counterclockwise_lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> arc_middle(500, 500);
+    unsigned int blade_diameter = 40;
+
+    lawn.cutGrassArc(arc_middle, 200, 0, 180, blade_diameter);
+    counterclockwise_lawn.cutGrassArc(arc_middle, 200, 180, -180, blade_diameter);
+
+    pair<unsigned int, unsigned int> right_indexes = lawn.calculateFieldIndexes(700, 500);
+    pair<unsigned int, unsigned int> left_indexes = lawn.calculateFieldIndexes(300, 500);
+    EXPECT_TRUE(lawn.getFields()[right_indexes.second][right_indexes.first]);
+    EXPECT_FALSE(lawn.getFields()[left_indexes.second][left_indexes.first]);
+    EXPECT_TRUE(lawn == counterclockwise_lawn);
+    EXPECT_NEAR(lawn.calculateShavedArea(), M_PI * 200 * blade_diameter / (lawn_width * lawn_length), 0.002);
+}
+
+
+TEST(CutGrassArc, collectedFieldsMatchCutArc) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn cut_lawn = Lawn(lawn_width, lawn_length);
+    Lawn collected_lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> arc_middle(400, 600);
+    vector<pair<unsigned int, unsigned int>> fields;
+
+    cut_lawn.cutGrassArc(arc_middle, 150, 30, -250, Config::MIN_BLADE_DIAMETER);
+    collected_lawn.collectGrassArc(arc_middle, 150, 30, -250, Config::MIN_BLADE_DIAMETER, fields);
+
+    EXPECT_FALSE(fields.empty());
+    EXPECT_EQ(collected_lawn.calculateShavedArea(), 0.0);
+
+    collected_lawn.cutFields(fields);
+
+    EXPECT_TRUE(collected_lawn == cut_lawn);
+}
+
+
+TEST(CutGrassSection, sectionsAlongAxesAreCutWhateverTheDirection) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn up_lawn = Lawn(lawn_width, lawn_length);
+    Lawn down_lawn = Lawn(lawn_width, lawn_length);
+    double down_radians = MathHelper::convertDegreesToRadians(180);
+
+    up_lawn.cutGrassSection(pair<double, double>(500, 200), 100, pair<double, double>(500, 500), 0);
+    down_lawn.cutGrassSection(pair<double, double>(500, 500), 100, 
+        pair<double, double>(500 + sin(down_radians) * 300, 500 + cos(down_radians) * 300), 180);
+
+    EXPECT_NEAR(down_lawn.calculateShavedArea(), up_lawn.calculateShavedArea(), 1e-4);
+}
+
+
+TEST(Obstacles, obstacleFieldsAreNeverMowed) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addCircleObstacle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+
+    lawn.cutGrassSection(pair<double, double>(500, 100), 300, pair<double, double>(500, 900), 0);
+
+    EXPECT_TRUE(lawn.isObstacleField(pair<unsigned int, unsigned int>(500, 500)));
+    EXPECT_FALSE(lawn.isObstacleField(pair<unsigned int, unsigned int>(500, 300)));
+    EXPECT_FALSE(lawn.getFieldGrid().isFieldCut(500, 500));
+    EXPECT_FALSE(lawn.getFieldGrid().isFieldCut(560, 560));
+    EXPECT_TRUE(lawn.getFieldGrid().isFieldCut(500, 300));
+    EXPECT_TRUE(lawn.getFieldGrid().isFieldCut(620, 500));
+}
+
+
+TEST(Obstacles, shavedAreaExcludesObstacleFields) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addPolygonObstacle({{0, 0}, {500, 0}, {500, 1000}, {0, 1000}}, ObstacleType::NO_GO_ZONE);
+
+    for (unsigned int row = 0; row < lawn_length; row ++) {
+        for (unsigned int col = 0; col < lawn_width; col ++) {
+            lawn.cutGrassOnField(pair<unsigned int, unsigned int>(col, row));
+        }
+    }
+
+    EXPECT_EQ(lawn.getObstacleFields().countCutFields(), 500000);
+    EXPECT_EQ(lawn.getFieldGrid().countCutFields(), 500000);
+    EXPECT_DOUBLE_EQ(lawn.calculateShavedArea(), 1.0);
+}
+
+
+TEST(Obstacles, mowedFieldsUnderNewObstacleAreRestored) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    lawn.cutGrass(pair<double, double>(500, 500), 300);
+    size_t cut_fields_number = lawn.getFieldGrid().countCutFields();
+
+    lawn.addCircleObstacle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+    size_t obstacle_fields_number = lawn.getObstacleFields().countCutFields();
+
+    EXPECT_FALSE(lawn.getFieldGrid().isFieldCut(500, 500));
+    EXPECT_EQ(lawn.getPassCounts()[500 * 1000 + 500], 0);
+    EXPECT_EQ(lawn.getFieldGrid().countCutFields(), cut_fields_number - obstacle_fields_number);
+    EXPECT_DOUBLE_EQ(lawn.calculateShavedArea(), static_cast<double>(cut_fields_number - obstacle_fields_number) /
+        static_cast<double>(1000000 - obstacle_fields_number));
+}
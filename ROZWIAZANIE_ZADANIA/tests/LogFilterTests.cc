@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "../include/LogFilter.h"
+
+using namespace std;
+
+TEST(LogFilterTest, allEventsAreEnabledByDefault) {
+    LogFilter filter;
+
+    EXPECT_EQ(filter.getMinLevel(), LogLevel::DEBUG);
+    for (uint8_t type = 0; type < static_cast<uint8_t>(LogEventType::EVENT_TYPES_NUMBER); ++type) {
+        EXPECT_TRUE(filter.isEnabled(static_cast<LogEventType>(type)));
+    }
+}
+
+TEST(LogFilterTest, errorLevelKeepsOnlyErrors) {
+    LogFilter filter;
+
+    filter.setMinLevel(LogLevel::ERROR);
+
+    EXPECT_FALSE(filter.isEnabled(LogEventType::MOVED));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::ROTATED));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::MOWING_ON));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::MOVING_TO_POINT));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::POINT_ARRIVED));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::MOVED_OUTSIDE_LAWN));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::INVALID_ROTATION_ANGLE));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::POINT_NOT_FOUND));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::TEXT_LOG));
+}
+
+TEST(LogFilterTest, infoLevelSkipsEventsOfEveryStep) {
+    LogFilter filter;
+
+    filter.setMinLevel(LogLevel::INFO);
+
+    EXPECT_FALSE(filter.isEnabled(LogEventType::MOVED));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::ROTATED));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::MOWING_OFF));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::MOVING_TO_POINT));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::POINT_ARRIVED));
+}
+
+TEST(LogFilterTest, disabledCategoryIsFilteredOut) {
+    LogFilter filter;
+
+    filter.setCategoryEnabled(LogCategory::MOVEMENT, false);
+    filter.setCategoryEnabled(LogCategory::ROTATION, false);
+
+    EXPECT_FALSE(filter.isCategoryEnabled(LogCategory::MOVEMENT));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::MOVED));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::ROTATED));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::MOWING_ON));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::MOVED_OUTSIDE_LAWN));
+
+    filter.setCategoryEnabled(LogCategory::MOVEMENT, true);
+
+    EXPECT_TRUE(filter.isEnabled(LogEventType::MOVED));
+    EXPECT_FALSE(filter.isEnabled(LogEventType::ROTATED));
+}
+
+TEST(LogFilterTest, messagesAreNeverFilteredOut) {
+    LogFilter filter;
+
+    filter.setMinLevel(LogLevel::ERROR);
+    filter.setCategoryEnabled(LogCategory::ERRORS, false);
+
+    EXPECT_FALSE(filter.isEnabled(LogEventType::TEXT_LOG));
+    EXPECT_TRUE(filter.isEnabled(LogEventType::TEXT_MESSAGE));
+}
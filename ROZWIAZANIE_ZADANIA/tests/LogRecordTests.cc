@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/LogRecord.h"
+
+using namespace std;
+
+TEST(LogRecordTest, formatsMessagesOfSimulationEvents) {
+    EXPECT_EQ(LogRecord(LogEventType::MOVED, 10, 2.5, 100.0, 0.125).formatMessage(), 
+        "Distance moved: 2.500000from point x: 100.000000, y: 0.125000");
+    EXPECT_EQ(LogRecord(LogEventType::MOVED_OUTSIDE_LAWN, 10).formatMessage(), "Attempted to move outside the lawn.");
+    EXPECT_EQ(LogRecord(LogEventType::MOVED_INTO_OBSTACLE, 10).formatMessage(), "Attempted to move into an obstacle.");
+    EXPECT_EQ(LogRecord(LogEventType::ROTATED, 10, -90).formatMessage(), "Rotated: -90 degrees.");
+    EXPECT_EQ(LogRecord(LogEventType::INVALID_ROTATION_ANGLE, 10).formatMessage(), 
+        "Invalid angle. Rotation angle must be in [-360; 360] range.");
+    EXPECT_EQ(LogRecord(LogEventType::MOWING_ON, 10).formatMessage(), "Mowing mode: on");
+    EXPECT_EQ(LogRecord(LogEventType::MOWING_OFF, 10).formatMessage(), "Mowing mode: off");
+    EXPECT_EQ(LogRecord(LogEventType::POINT_NOT_FOUND, 10, 7).formatMessage(), 
+        "Unable to find point in the lawn. Incorrect point's id 7");
+    EXPECT_EQ(LogRecord(LogEventType::MOVING_TO_POINT, 10, 3).formatMessage(), "Moving to point with id:  3");
+    EXPECT_EQ(LogRecord(LogEventType::POINT_OUTSIDE_LAWN, 10).formatMessage(), "Unable to add point outside the lawn.");
+    EXPECT_EQ(LogRecord(LogEventType::POINT_NOT_DELETED, 10, 9).formatMessage(), 
+        "Unable to delete point from lawn. Incorrect point's id: 9");
+    EXPECT_EQ(LogRecord(LogEventType::POINT_ARRIVED, 10, 5).formatMessage(), "Arrived at point with id:  5");
+    EXPECT_EQ(LogRecord(LogEventType::NO_POINTS_FOUND, 10).formatMessage(), 
+        "Unable to find the nearest point. There are no points in the lawn.");
+    EXPECT_EQ(LogRecord(LogEventType::ROUTE_OPTIMIZED, 10, 3, 12.5, 10.25).formatMessage(), 
+        "Route through 3 points: 12.500000 s in given order, 10.250000 s optimized, 2.250000 s saved.");
+}
+
+TEST(LogRecordTest, formatsLinesOfTextLog) {
+    EXPECT_EQ(LogRecord(LogEventType::MOWING_ON, 120).formatLine(), "Time: 120: Mowing mode: on");
+    EXPECT_EQ(LogRecord(LogEventType::TEXT_LOG, 30, "Custom log").formatLine(), "Time: 30: Custom log");
+    EXPECT_EQ(LogRecord(LogEventType::TEXT_MESSAGE, 30, "Custom message").formatLine(), "Custom message");
+}
+
+TEST(LogRecordTest, binaryRecordsCanBeReadBack) {
+    vector<LogRecord> records = {
+        LogRecord(LogEventType::MOVED, 10, 2.5, 100.0, 0.125),
+        LogRecord(LogEventType::ROTATED, 20, 45),
+        LogRecord(LogEventType::MOWING_OFF, 30),
+        LogRecord(LogEventType::TEXT_LOG, 40, "Custom log"),
+        LogRecord(LogEventType::TEXT_MESSAGE, 0, "")
+    };
+    stringstream stream;
+    LogRecord::writeBinaryHeader(stream);
+    for (const LogRecord& record : records) {
+        record.writeBinary(stream);
+    }
+
+    ASSERT_TRUE(LogRecord::readBinaryHeader(stream));
+    vector<LogRecord> read_records;
+    LogRecord record;
+    while (record.readBinary(stream)) {
+        read_records.push_back(record);
+    }
+
+    EXPECT_EQ(read_records, records);
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST(LogRecordTest, binaryRecordStoresOnlyUsedValues) {
+    stringstream stream;
+
+    LogRecord(LogEventType::MOWING_ON, 10).writeBinary(stream);
+    size_t record_without_values_size = stream.str().size();
+    LogRecord(LogEventType::MOVED, 10, 1.0, 2.0, 3.0).writeBinary(stream);
+
+    EXPECT_EQ(record_without_values_size, sizeof(uint8_t) + sizeof(u_int64_t));
+    EXPECT_EQ(stream.str().size() - record_without_values_size, record_without_values_size + 3 * sizeof(double));
+}
+
+TEST(LogRecordTest, textLogIsNotReadAsBinaryLog) {
+    stringstream stream("Time: 10: Mowing mode: on\n");
+
+    EXPECT_FALSE(LogRecord::readBinaryHeader(stream));
+}
+
+TEST(LogRecordTest, damagedRecordIsNotRead) {
+    stringstream stream;
+    LogRecord(LogEventType::MOVED, 10, 1.0, 2.0, 3.0).writeBinary(stream);
+    string truncated = stream.str().substr(0, stream.str().size() - 4);
+    stringstream truncated_stream(truncated);
+
+    LogRecord record;
+    EXPECT_FALSE(record.readBinary(truncated_stream));
+}
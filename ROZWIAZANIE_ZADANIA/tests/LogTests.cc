@@ -71,3 +71,16 @@ TEST(OperatorNotEquals, equals) {
     bool result = log != log2;
     EXPECT_FALSE(result);
 }
+
+
+TEST(Move, movedLogKeepsMessage) {
+    string message = "Message longer than the small string buffer";
+    Log log = Log(20, message);
+    const char* message_memory = log.getMessage().data();
+
+    Log moved_log = std::move(log);
+
+    EXPECT_EQ(20, moved_log.getTime());
+    EXPECT_EQ(message, moved_log.getMessage());
+    EXPECT_EQ(message_memory, moved_log.getMessage().data());
+}
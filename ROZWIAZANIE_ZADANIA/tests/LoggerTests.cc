@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <string>
+#include <vector>
 #include "../include/Logger.h"
 
 using namespace std;
@@ -8,9 +9,9 @@ using namespace std;
 TEST(ConstructorAndGetter, constructorAndGetter) {
     Logger logger = Logger();
 
-    const queue<Log>& result_queue = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
 
-    EXPECT_EQ(queue<Log>(), result_queue);
+    EXPECT_EQ(vector<Log>(), result_logs);
 }
 
 
@@ -19,7 +20,7 @@ TEST(push, logs) {
     Log log = Log(10, "Hello");
 
     logger.push(std::move(log));
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
     int result_size = 1;
 
     EXPECT_EQ(result_size, result_logs.size());
@@ -30,7 +31,7 @@ TEST(push, emptyLogs) {
     Logger logger = Logger();
     int result_size = 0;
 
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
 
     EXPECT_EQ(result_size, result_logs.size());
 }
@@ -42,7 +43,7 @@ TEST(clear, clear) {
 
     logger.push(std::move(log));
     logger.clear();
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
     int result_size = 0;
 
     EXPECT_EQ(result_size, result_logs.size());
@@ -53,8 +54,44 @@ TEST(clear, clearEmptyQueue) {
     Logger logger = Logger();
 
     logger.clear();
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
     int result_size = 0;
 
     EXPECT_EQ(result_size, result_logs.size());
 }
+
+
+TEST(drainInto, logsAreMovedToBufferInOrder) {
+    Logger logger = Logger();
+    vector<Log> buffer = {Log(5, "Old")};
+
+    logger.push(Log(10, "First"));
+    logger.push(Log(20, "Second"));
+    logger.drainInto(buffer);
+
+    EXPECT_EQ(vector<Log>({Log(10, "First"), Log(20, "Second")}), buffer);
+    EXPECT_TRUE(logger.getLogs().empty());
+}
+
+
+TEST(drainInto, memoryIsReusedInNextSteps) {
+    Logger logger = Logger();
+    vector<Log> buffer;
+    logger.push(Log(10, "First"));
+    logger.drainInto(buffer);
+    logger.push(Log(20, "Second"));
+    logger.drainInto(buffer);
+    const Log* logs_memory = logger.getLogs().data();
+    const Log* buffer_memory = buffer.data();
+
+    for (u_int64_t step = 0; step < 10; ++step) {
+        logger.push(Log(step, "Log"));
+        logger.drainInto(buffer);
+        logger.push(Log(step, "Log"));
+        logger.drainInto(buffer);
+
+        EXPECT_EQ(logs_memory, logger.getLogs().data());
+        EXPECT_EQ(buffer_memory, buffer.data());
+        EXPECT_EQ(1, buffer.size());
+    }
+}
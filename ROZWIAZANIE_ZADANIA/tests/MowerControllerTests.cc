@@ -1,8 +1,18 @@
 #include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <thread>
 #include "StateSimulation.h"
 #include "MowerController.h"
 #include "Config.h"
 
+namespace {
+    std::string testLogPath() {
+        // The controller tests write their log outside of the repository
+        return (std::filesystem::temp_directory_path() / "mower_controller_tests.log").string();
+    }
+}
+
 TEST(MowerControllerUpdate, updateExecutesNoCommandsWhenQueueIsEmpty) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
@@ -15,7 +25,7 @@ TEST(MowerControllerUpdate, updateExecutesNoCommandsWhenQueueIsEmpty) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double delta_time = 0.016;
@@ -37,7 +47,7 @@ TEST(MowerControllerMove, moveAddsCommandToQueue) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double move_distance_cm = 100.0;
@@ -61,7 +71,7 @@ TEST(MowerControllerMove, moveWithPointerAddsCommandToQueue) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double move_distance_cm = 100.0;
@@ -86,7 +96,7 @@ TEST(MowerControllerRotate, rotateAddsCommandToQueue) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     short rotation_angle_degrees = 90;
@@ -112,7 +122,7 @@ TEST(MowerControllerSetMowing, setMowingEnableTurnsOnMowing) {
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     mower.turnOffMowing();
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     bool enable_mowing = true;
@@ -136,7 +146,7 @@ TEST(MowerControllerSetMowing, setMowingDisableTurnsOffMowing) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     bool disable_mowing = false;
@@ -160,7 +170,7 @@ TEST(MowerControllerAddPoint, addPointAddsPointToSimulation) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double point_x_coordinate = 300.0;
@@ -186,7 +196,7 @@ TEST(MowerControllerDeletePoint, deletePointRemovesPointFromSimulation) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double point_x_coordinate = 300.0;
@@ -215,7 +225,7 @@ TEST(MowerControllerMoveToPoint, moveToPointMovesNearPointLocation) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double target_point_x = 500.0;
@@ -253,7 +263,7 @@ TEST(MowerControllerGetDistanceToPoint, getDistanceToPointCalculatesCorrectDista
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double point_x_coordinate = 300.0;
@@ -282,7 +292,7 @@ TEST(MowerControllerRotateTowardsPoint, rotateTowardsPointChangesAngle) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double point_x_coordinate = 500.0;
@@ -311,7 +321,7 @@ TEST(MowerControllerUpdate, updateExecutesMultipleCommandsInOrder) {
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     short first_rotation_degrees = 45;
@@ -339,7 +349,7 @@ TEST(MowerControllerGetCurrentPosition, getCurrentPositionRetrievesMowerPosition
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
-    FileLogger fileLogger = FileLogger("test_path");
+    FileLogger fileLogger = FileLogger(testLogPath());
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
     MowerController controller = MowerController();
     double out_x = 0.0, out_y = 0.0;
@@ -351,3 +361,258 @@ TEST(MowerControllerGetCurrentPosition, getCurrentPositionRetrievesMowerPosition
     EXPECT_DOUBLE_EQ(450.0, out_x);
     EXPECT_DOUBLE_EQ(550.0, out_y);
 }
+
+TEST(MowerControllerQueue, getQueueSizeCountsWaitingCommands) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 450.0, 550.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    double delta_time = 0.016;
+
+    controller.move(100.0);
+    controller.setMowing(false);
+    EXPECT_EQ(controller.getQueueSize(), 2);
+
+    controller.update(stateSimulation, delta_time);
+    EXPECT_EQ(controller.getQueueSize(), 2);
+}
+
+TEST(MowerControllerQueue, instantaneousCommandsAreExecutedInOneStep) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 450.0, 550.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    unsigned short angle = 1;
+    double delta_time = 0.016;
+
+    for (int i = 0; i < 100; ++i) {
+        controller.addPoint(10.0 * i, 10.0);
+    }
+    controller.setMowing(true);
+    controller.getCurrentAngle(angle);
+    controller.update(stateSimulation, delta_time);
+
+    EXPECT_EQ(controller.getQueueSize(), 0);
+    EXPECT_EQ(stateSimulation.getPoints().size(), 100);
+    EXPECT_TRUE(mower.getIsMowing());
+    EXPECT_EQ(angle, 0);
+    EXPECT_EQ(stateSimulation.getTime(), 0);
+}
+
+TEST(MowerControllerQueue, unusedTimeIsPassedToNextCommand) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+
+    controller.move(10.0);
+    controller.move(10.0);
+    controller.move(10.0);
+    controller.update(stateSimulation, 0.25);
+
+    EXPECT_EQ(controller.getQueueSize(), 1);
+    EXPECT_EQ(stateSimulation.getTime(), 250);
+}
+
+TEST(MowerControllerSubsteps, longStepGivesSameRotationAsFineSteps) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 450.0, 550.0, 0);
+    Lawn lawn_long = Lawn(lawn_width, lawn_length);
+    Lawn lawn_fine = Lawn(lawn_width, lawn_length);
+    Mower mower_long = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower_fine = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation simulation_long = StateSimulation(lawn_long, mower_long, logger, fileLogger);
+    StateSimulation simulation_fine = StateSimulation(lawn_fine, mower_fine, logger, fileLogger);
+    MowerController controller_long = MowerController();
+    MowerController controller_fine = MowerController();
+
+    controller_long.rotate(90);
+    controller_fine.rotate(90);
+    controller_long.update(simulation_long, 0.5);
+    for (int i = 0; i < 25; ++i) {
+        controller_fine.update(simulation_fine, 0.02);
+    }
+
+    EXPECT_EQ(mower_long.getAngle(), mower_fine.getAngle());
+    EXPECT_EQ(simulation_long.getTime(), simulation_fine.getTime());
+    EXPECT_EQ(controller_long.getQueueSize(), 1);
+}
+
+TEST(MowerControllerAddCommand, customCommandIsExecutedInOrder) {
+    class SetTimeCheckCommand : public ICommand {
+    public:
+        explicit SetTimeCheckCommand(u_int64_t& out_time) : out_time_(out_time) {}
+        bool execute(StateSimulation& sim, double dt) override {
+            out_time_ = sim.getTime();
+            return true;
+        }
+    private:
+        u_int64_t& out_time_;
+    };
+
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    u_int64_t time_after_move = 0;
+    double delta_time = 10.0;
+
+    controller.reserveCommands(2);
+    controller.move(100.0);
+    controller.addCommand(std::make_unique<SetTimeCheckCommand>(time_after_move));
+    EXPECT_EQ(2, controller.getQueueSize());
+    controller.update(stateSimulation, delta_time);
+    controller.update(stateSimulation, delta_time);
+
+    EXPECT_EQ(0, controller.getQueueSize());
+    EXPECT_EQ(1000, time_after_move);
+}
+
+TEST(MowerControllerMoveAlongArc, fullCircleReturnsToStart) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    double delta_time = 0.016;
+
+    controller.setMowing(true);
+    controller.moveAlongArc(100.0, 360.0);
+    while (controller.getQueueSize() > 0) {
+        controller.update(stateSimulation, delta_time);
+    }
+
+    EXPECT_NEAR(stateSimulation.getMower().getX(), 500.0, 1e-6);
+    EXPECT_NEAR(stateSimulation.getMower().getY(), 500.0, 1e-6);
+    EXPECT_EQ(stateSimulation.getMower().getAngle(), 0);
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+}
+
+TEST(MowerControllerOptimizeRoute, optimizeRouteReplacesPendingMovesToPoints) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 100.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    double delta_time = 0.1;
+
+    controller.addPoint(100.0, 700.0);
+    controller.addPoint(100.0, 300.0);
+    controller.addPoint(100.0, 500.0);
+    controller.moveToPoint(0);
+    controller.moveToPoint(1);
+    controller.moveToPoint(2);
+    controller.optimizeRoute();
+    EXPECT_EQ(4, controller.getQueueSize());
+
+    int max_steps = 1000;
+    while (controller.getQueueSize() > 0 && max_steps > 0) {
+        controller.update(stateSimulation, delta_time);
+        max_steps--;
+    }
+
+    EXPECT_EQ(0, controller.getQueueSize());
+    EXPECT_NEAR(100.0, stateSimulation.getMower().getX(), 3.0);
+    EXPECT_NEAR(700.0, stateSimulation.getMower().getY(), 3.0);
+    EXPECT_LT(stateSimulation.getTime(), 7000);
+}
+
+TEST(MowerControllerUpdate, commandsCanBePushedFromAnotherThread) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int mower_width = 120;
+    unsigned int mower_length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger(testLogPath());
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    int commands_number = 200;
+    double delta_time = 0.02;
+
+    std::thread pushing_thread([&controller, commands_number]() {
+        for (int i = 0; i < commands_number; ++i) {
+            controller.rotate(i % 2 == 0 ? 1 : -1);
+        }
+    });
+    while (controller.getQueueSize() > 0 || pushing_thread.joinable()) {
+        controller.update(stateSimulation, delta_time);
+        if (controller.getQueueSize() == 0 && pushing_thread.joinable()) {
+            pushing_thread.join();
+        }
+    }
+
+    EXPECT_EQ(0, controller.getQueueSize());
+    EXPECT_EQ(0, stateSimulation.getMower().getAngle());
+}
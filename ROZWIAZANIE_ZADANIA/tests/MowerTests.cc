@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 #include "../include/Config.h"
+#include "../include/Lawn.h"
 #include "../include/Mower.h"
 #include "../include/Exceptions.h"
 
@@ -751,3 +752,62 @@ TEST(TurnOffMowing, turnOff) {
 
     EXPECT_FALSE(mower.getIsMowing());
 }
+
+
+TEST(MoveOnLawnWithObstacles, moveStopsBeforeObstacle) {
+    unsigned int width = 10;
+    unsigned int length = 10;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500, 100, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addCircleObstacle(pair<double, double>(500, 400), 50, ObstacleType::OBSTACLE);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+
+    mower.move(200, lawn);
+
+    EXPECT_DOUBLE_EQ(mower.getY(), 300.0);
+    EXPECT_THROW({mower.move(10, lawn);}, ObstacleCollisionError);
+    EXPECT_DOUBLE_EQ(mower.getY(), 300.0);
+}
+
+
+TEST(MoveOnLawnWithObstacles, moveThroughNoGoZoneThrows) {
+    unsigned int width = 10;
+    unsigned int length = 10;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 100, 500, 90);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addPolygonObstacle({{400, 400}, {450, 400}, {450, 600}, {400, 600}}, ObstacleType::NO_GO_ZONE);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+
+    EXPECT_THROW({mower.move(500, lawn);}, ObstacleCollisionError);
+    EXPECT_THROW({mower.moveToPose(800, 500, 90, lawn);}, ObstacleCollisionError);
+    EXPECT_DOUBLE_EQ(mower.getX(), 100.0);
+    mower.moveToPose(380, 500, 90, lawn);
+    EXPECT_DOUBLE_EQ(mower.getX(), 380.0);
+}
+
+
+TEST(MoveOnLawnWithObstacles, moveOutsideLawnIsCheckedFirst) {
+    unsigned int width = 10;
+    unsigned int length = 10;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500, 900, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addCircleObstacle(pair<double, double>(500, 1000), 50, ObstacleType::OBSTACLE);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+
+    EXPECT_THROW({mower.move(200, lawn);}, MoveOutsideLawnError);
+}
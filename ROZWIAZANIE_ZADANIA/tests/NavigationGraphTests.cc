@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "NavigationGraph.h"
+#include "ObstacleMap.h"
+
+using namespace std;
+
+namespace {
+    const double CLEARANCE = 20.0;
+
+    // Checks that the mower can drive along the whole path and returns its length.
+    double checkPath(const ObstacleMap& obstacle_map, pair<double, double> start,
+        const vector<pair<double, double>>& path) {
+        double length = 0.0;
+        for (const pair<double, double>& waypoint : path) {
+            EXPECT_FALSE(obstacle_map.isSegmentBlocked(start, waypoint, CLEARANCE));
+            length += hypot(waypoint.first - start.first, waypoint.second - start.second);
+            start = waypoint;
+        }
+        return length;
+    }
+}
+
+TEST(NavigationGraphTest, freeWayIsStraight) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(800, 800), 50, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+
+    vector<pair<double, double>> path = graph.findPath(pair<double, double>(100, 100), pair<double, double>(900, 100));
+
+    ASSERT_EQ(path.size(), 1);
+    EXPECT_DOUBLE_EQ(path[0].first, 900.0);
+    EXPECT_DOUBLE_EQ(path[0].second, 100.0);
+}
+
+TEST(NavigationGraphTest, pathGoesAroundCircle) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+    pair<double, double> start(100, 500);
+
+    vector<pair<double, double>> path = graph.findPath(start, pair<double, double>(900, 500));
+
+    ASSERT_GT(path.size(), 1);
+    EXPECT_DOUBLE_EQ(path.back().first, 900.0);
+    double length = checkPath(obstacle_map, start, path);
+    EXPECT_GT(length, 800.0);
+    EXPECT_LT(length, 950.0);
+}
+
+TEST(NavigationGraphTest, pathGoesAroundWall) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{450, 0}, {550, 0}, {550, 800}, {450, 800}}, ObstacleType::NO_GO_ZONE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+    pair<double, double> start(100, 100);
+
+    vector<pair<double, double>> path = graph.findPath(start, pair<double, double>(900, 100));
+
+    ASSERT_EQ(path.size(), 3);
+    EXPECT_GT(path[0].second, 800.0);
+    EXPECT_GT(path[1].second, 800.0);
+    checkPath(obstacle_map, start, path);
+}
+
+TEST(NavigationGraphTest, pathLeavesConcaveNotch) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{300, 300}, {700, 300}, {700, 700}, {600, 700}, {600, 400}, {400, 400}, {400, 700},
+        {300, 700}}, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+    pair<double, double> start(500, 600);
+
+    vector<pair<double, double>> path = graph.findPath(start, pair<double, double>(500, 100));
+
+    ASSERT_GT(path.size(), 2);
+    checkPath(obstacle_map, start, path);
+}
+
+TEST(NavigationGraphTest, separatedGoalHasNoPath) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{450, -10}, {550, -10}, {550, 1010}, {450, 1010}}, ObstacleType::NO_GO_ZONE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+
+    EXPECT_TRUE(graph.findPath(pair<double, double>(100, 500), pair<double, double>(900, 500)).empty());
+    EXPECT_TRUE(graph.findPath(pair<double, double>(100, 500), pair<double, double>(500, 500)).empty());
+}
+
+TEST(NavigationGraphTest, nodesOutsideLawnAreSkipped) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(50, 500), 30, ObstacleType::OBSTACLE);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 30, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+
+    EXPECT_LT(graph.getActiveNodesNumber(), 2 * NavigationGraph::CIRCLE_NODES_NUMBER);
+    EXPECT_GT(graph.getActiveNodesNumber(), NavigationGraph::CIRCLE_NODES_NUMBER);
+}
+
+TEST(NavigationGraphTest, edgesToPointsAreCached) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+    graph.addPoint(0, pair<double, double>(900, 500));
+
+    vector<pair<double, double>> first_path = graph.findPathToPoint(pair<double, double>(100, 500), 0);
+    size_t cached_edges_number = graph.getCachedEdgesNumber();
+    vector<pair<double, double>> second_path = graph.findPathToPoint(pair<double, double>(100, 500), 0);
+
+    EXPECT_GT(cached_edges_number, 0);
+    EXPECT_EQ(graph.getCachedEdgesNumber(), cached_edges_number);
+    EXPECT_EQ(first_path, second_path);
+}
+
+TEST(NavigationGraphTest, graphFollowsNewObstacles) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+    graph.addPoint(0, pair<double, double>(900, 500));
+    pair<double, double> start(100, 500);
+    vector<pair<double, double>> first_path = graph.findPathToPoint(start, 0);
+
+    for (const pair<double, double>& waypoint : first_path) {
+        if (waypoint != first_path.back()) {
+            obstacle_map.addCircle(waypoint, 30, ObstacleType::NO_GO_ZONE);
+        }
+    }
+    vector<pair<double, double>> second_path = graph.findPathToPoint(start, 0);
+
+    ASSERT_FALSE(second_path.empty());
+    EXPECT_NE(first_path, second_path);
+    checkPath(obstacle_map, start, second_path);
+}
+
+TEST(NavigationGraphTest, deletedPointHasNoPath) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+    NavigationGraph graph(obstacle_map, 1000, 1000, CLEARANCE);
+    graph.addPoint(0, pair<double, double>(900, 500));
+    graph.findPathToPoint(pair<double, double>(100, 500), 0);
+
+    graph.removePoint(0);
+    graph.addPoint(1, pair<double, double>(500, 900));
+
+    EXPECT_TRUE(graph.findPathToPoint(pair<double, double>(100, 500), 0).empty());
+    vector<pair<double, double>> path = graph.findPathToPoint(pair<double, double>(500, 100), 1);
+    ASSERT_FALSE(path.empty());
+    EXPECT_DOUBLE_EQ(path.back().second, 900.0);
+}
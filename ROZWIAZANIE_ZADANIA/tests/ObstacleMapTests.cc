@@ -0,0 +1,123 @@
+/*
+    Author: Maciej Cieslik
+
+    Tests ObstacleMap class methods.
+*/
+
+#include <gtest/gtest.h>
+#include "../include/ObstacleMap.h"
+#include "../include/Exceptions.h"
+
+using namespace std;
+
+
+TEST(ObstacleMapTest, newMapIsEmpty) {
+    ObstacleMap obstacle_map(1000, 800);
+
+    EXPECT_TRUE(obstacle_map.isEmpty());
+    EXPECT_FALSE(obstacle_map.isPointBlocked(500, 400));
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(pair<double, double>(0, 0), pair<double, double>(1000, 800), 50));
+}
+
+
+TEST(ObstacleMapTest, bucketsGrowOnBigLawns) {
+    EXPECT_DOUBLE_EQ(ObstacleMap(1000, 800).getBucketSize(), ObstacleMap::MIN_BUCKET_SIZE);
+    EXPECT_DOUBLE_EQ(ObstacleMap(1024, 102400).getBucketSize(), 400.0);
+}
+
+
+TEST(ObstacleMapTest, invalidObstaclesThrow) {
+    ObstacleMap obstacle_map(1000, 800);
+
+    EXPECT_THROW(obstacle_map.addCircle(pair<double, double>(100, 100), 0.0, ObstacleType::OBSTACLE),
+        InvalidObstacleError);
+    EXPECT_THROW(obstacle_map.addPolygon({{100, 100}, {200, 100}}, ObstacleType::NO_GO_ZONE), InvalidObstacleError);
+    EXPECT_TRUE(obstacle_map.isEmpty());
+}
+
+
+TEST(ObstacleMapTest, circleObstacleKeepsBladeAway) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 50, ObstacleType::OBSTACLE);
+    pair<double, double> beginning(300, 500);
+    pair<double, double> ending(440, 500);
+
+    EXPECT_TRUE(obstacle_map.isPointBlocked(520, 520));
+    EXPECT_FALSE(obstacle_map.isPointBlocked(540, 540));
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(beginning, ending, 10));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(beginning, ending, 20));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(pair<double, double>(500, 300), pair<double, double>(500, 700), 0));
+}
+
+
+TEST(ObstacleMapTest, noGoZoneBlocksOnlyMiddleOfMower) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(500, 500), 50, ObstacleType::NO_GO_ZONE);
+
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(pair<double, double>(300, 500), pair<double, double>(445, 500), 100));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(pair<double, double>(300, 500), pair<double, double>(455, 500), 100));
+}
+
+
+TEST(ObstacleMapTest, segmentCrossingPolygonIsBlocked) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{400, 400}, {600, 400}, {600, 600}, {400, 600}}, ObstacleType::NO_GO_ZONE);
+
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(pair<double, double>(300, 300), pair<double, double>(700, 700), 0));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(pair<double, double>(300, 500), pair<double, double>(500, 500), 0));
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(pair<double, double>(300, 300), pair<double, double>(700, 300), 0));
+}
+
+
+TEST(ObstacleMapTest, polygonObstacleKeepsBladeAway) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{400, 400}, {600, 400}, {600, 600}, {400, 600}}, ObstacleType::OBSTACLE);
+    pair<double, double> beginning(300, 300);
+    pair<double, double> ending(700, 300);
+
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(beginning, ending, 90));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(beginning, ending, 110));
+}
+
+
+TEST(ObstacleMapTest, mowerOnBorderCanMoveAway) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{400, 400}, {600, 400}, {600, 600}, {400, 600}}, ObstacleType::NO_GO_ZONE);
+    obstacle_map.addCircle(pair<double, double>(200, 200), 50, ObstacleType::NO_GO_ZONE);
+
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(pair<double, double>(400, 500), pair<double, double>(300, 500), 0));
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(pair<double, double>(250, 200), pair<double, double>(300, 200), 0));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(pair<double, double>(250, 200), pair<double, double>(240, 200), 0));
+}
+
+
+TEST(ObstacleMapTest, concavePolygonDoesNotBlockItsNotch) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addPolygon({{100, 100}, {500, 100}, {500, 200}, {200, 200}, {200, 500}, {100, 500}},
+        ObstacleType::NO_GO_ZONE);
+
+    EXPECT_TRUE(obstacle_map.isPointBlocked(150, 400));
+    EXPECT_TRUE(obstacle_map.isPointBlocked(400, 150));
+    EXPECT_FALSE(obstacle_map.isPointBlocked(400, 400));
+    EXPECT_FALSE(obstacle_map.isSegmentBlocked(pair<double, double>(300, 300), pair<double, double>(450, 450), 0));
+}
+
+
+TEST(ObstacleMapTest, obstacleIsFoundFromAllItsBuckets) {
+    ObstacleMap obstacle_map(10000, 10000);
+    obstacle_map.addPolygon({{1000, 1000}, {9000, 1000}, {9000, 1100}, {1000, 1100}}, ObstacleType::OBSTACLE);
+
+    for (double x = 1010; x < 9000; x += obstacle_map.getBucketSize()) {
+        EXPECT_TRUE(obstacle_map.isPointBlocked(x, 1050));
+        EXPECT_FALSE(obstacle_map.isPointBlocked(x, 1150));
+    }
+}
+
+
+TEST(ObstacleMapTest, obstaclesOutsideLawnAreFound) {
+    ObstacleMap obstacle_map(1000, 1000);
+    obstacle_map.addCircle(pair<double, double>(-100, 500), 150, ObstacleType::OBSTACLE);
+
+    EXPECT_TRUE(obstacle_map.isPointBlocked(20, 500));
+    EXPECT_TRUE(obstacle_map.isSegmentBlocked(pair<double, double>(100, 300), pair<double, double>(100, 700), 60));
+}
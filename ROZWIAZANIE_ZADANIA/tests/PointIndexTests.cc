@@ -0,0 +1,117 @@
+/*
+    Author: Maciej Cieslik
+
+    Tests PointIndex class methods.
+*/
+
+#include <gtest/gtest.h>
+#include <random>
+#include "../include/PointIndex.h"
+
+using namespace std;
+
+
+TEST(PointIndexTest, emptyIndexFindsNothing) {
+    PointIndex point_index(1000, 800);
+
+    EXPECT_EQ(point_index.getSize(), 0);
+    EXPECT_FALSE(point_index.findNearestPoint(500, 400).has_value());
+    EXPECT_TRUE(point_index.findPointsInRadius(500, 400, 1000).empty());
+}
+
+
+TEST(PointIndexTest, bucketsGrowOnBigLawns) {
+    EXPECT_DOUBLE_EQ(PointIndex(1000, 800).getBucketSize(), PointIndex::MIN_BUCKET_SIZE);
+    EXPECT_DOUBLE_EQ(PointIndex(1024, 102400).getBucketSize(), 400.0);
+}
+
+
+TEST(PointIndexTest, nearestPointIsFound) {
+    PointIndex point_index(1000, 1000);
+    point_index.addPoint(Point(100, 100, 0));
+    point_index.addPoint(Point(900, 900, 1));
+    point_index.addPoint(Point(480, 530, 2));
+
+    EXPECT_EQ(point_index.findNearestPoint(500, 500)->getId(), 2);
+    EXPECT_EQ(point_index.findNearestPoint(0, 0)->getId(), 0);
+    EXPECT_EQ(point_index.findNearestPoint(2000, 1500)->getId(), 1);
+}
+
+
+TEST(PointIndexTest, farPointIsFoundOnBigLawn) {
+    PointIndex point_index(10000, 10000);
+    point_index.addPoint(Point(9990, 9990, 7));
+
+    ASSERT_TRUE(point_index.findNearestPoint(5, 5).has_value());
+    EXPECT_EQ(point_index.findNearestPoint(5, 5)->getId(), 7);
+}
+
+
+TEST(PointIndexTest, pointsAtSameDistanceAreOrderedByIds) {
+    PointIndex point_index(1000, 1000);
+    point_index.addPoint(Point(600, 500, 3));
+    point_index.addPoint(Point(400, 500, 1));
+    point_index.addPoint(Point(500, 600, 2));
+
+    EXPECT_EQ(point_index.findNearestPoint(500, 500)->getId(), 1);
+}
+
+
+TEST(PointIndexTest, deletedPointIsNotFound) {
+    PointIndex point_index(1000, 1000);
+    point_index.addPoint(Point(500, 500, 0));
+    point_index.addPoint(Point(505, 505, 1));
+    point_index.addPoint(Point(800, 800, 2));
+
+    EXPECT_TRUE(point_index.deletePoint(Point(500, 500, 0)));
+    EXPECT_FALSE(point_index.deletePoint(Point(500, 500, 0)));
+    EXPECT_EQ(point_index.getSize(), 2);
+    EXPECT_EQ(point_index.findNearestPoint(500, 500)->getId(), 1);
+}
+
+
+TEST(PointIndexTest, pointsInRadiusAreSortedByDistance) {
+    PointIndex point_index(1000, 1000);
+    point_index.addPoint(Point(500, 600, 0));
+    point_index.addPoint(Point(500, 520, 1));
+    point_index.addPoint(Point(500, 700, 2));
+    point_index.addPoint(Point(600, 500, 3));
+
+    vector<Point> points = point_index.findPointsInRadius(500, 500, 100);
+
+    ASSERT_EQ(points.size(), 3);
+    EXPECT_EQ(points[0].getId(), 1);
+    EXPECT_EQ(points[1].getId(), 0);
+    EXPECT_EQ(points[2].getId(), 3);
+}
+
+
+TEST(PointIndexTest, queriesMatchCheckingAllPoints) {
+    PointIndex point_index(5000, 3000);
+    vector<Point> points;
+    mt19937 generator(7);
+    uniform_real_distribution<double> x_distribution(0, 5000);
+    uniform_real_distribution<double> y_distribution(0, 3000);
+    for (unsigned int id = 0; id < 500; id ++) {
+        points.push_back(Point(x_distribution(generator), y_distribution(generator), id));
+        point_index.addPoint(points.back());
+    }
+
+    for (unsigned int i = 0; i < 200; i ++) {
+        double x = x_distribution(generator);
+        double y = y_distribution(generator);
+        double RADIUS = 300;
+        double nearest_distance = INFINITY;
+        size_t points_in_radius_number = 0;
+        for (const Point& point : points) {
+            double distance = hypot(point.getX() - x, point.getY() - y);
+            nearest_distance = min(nearest_distance, distance);
+            points_in_radius_number += distance <= RADIUS;
+        }
+
+        optional<Point> nearest_point = point_index.findNearestPoint(x, y);
+        ASSERT_TRUE(nearest_point.has_value());
+        EXPECT_DOUBLE_EQ(hypot(nearest_point->getX() - x, nearest_point->getY() - y), nearest_distance);
+        EXPECT_EQ(point_index.findPointsInRadius(x, y, RADIUS).size(), points_in_radius_number);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+    Author: Maciej Cieslik
+
+    Tests PointRegistry class methods.
+*/
+
+#include <gtest/gtest.h>
+#include "../include/PointRegistry.h"
+
+using namespace std;
+
+
+TEST(PointRegistryTest, newRegistryIsEmpty) {
+    PointRegistry registry;
+
+    EXPECT_TRUE(registry.isEmpty());
+    EXPECT_TRUE(registry.getPoints().empty());
+    EXPECT_EQ(registry.findPoint(0), nullptr);
+    EXPECT_FALSE(registry.deletePoint(0));
+}
+
+
+TEST(PointRegistryTest, pointsAreFoundByIds) {
+    PointRegistry registry;
+    registry.addPoint(Point(10, 20, 0));
+    registry.addPoint(Point(30, 40, 1));
+    registry.addPoint(Point(50, 60, 5));
+
+    ASSERT_NE(registry.findPoint(5), nullptr);
+    EXPECT_EQ(*registry.findPoint(5), Point(50, 60, 5));
+    EXPECT_EQ(*registry.findPoint(0), Point(10, 20, 0));
+    EXPECT_EQ(registry.findPoint(3), nullptr);
+    EXPECT_EQ(registry.findPoint(100), nullptr);
+    EXPECT_EQ(registry.getSize(), 3);
+}
+
+
+TEST(PointRegistryTest, deletingKeepsOrderOfPoints) {
+    PointRegistry registry;
+    for (unsigned int id = 0; id < 6; id ++) {
+        registry.addPoint(Point(id * 10.0, id * 20.0, id));
+    }
+
+    EXPECT_TRUE(registry.deletePoint(1));
+    EXPECT_TRUE(registry.deletePoint(4));
+    EXPECT_FALSE(registry.deletePoint(4));
+    EXPECT_EQ(registry.getSize(), 4);
+    EXPECT_EQ(registry.findPoint(4), nullptr);
+
+    vector<Point> expected_points = {Point(0, 0, 0), Point(20, 40, 2), Point(30, 60, 3), Point(50, 100, 5)};
+    EXPECT_EQ(registry.getPoints(), expected_points);
+    EXPECT_EQ(*registry.findPoint(5), Point(50, 100, 5));
+}
+
+
+TEST(PointRegistryTest, pointsAddedAfterDeletingGoToTheEnd) {
+    PointRegistry registry;
+    registry.addPoint(Point(0, 0, 0));
+    registry.addPoint(Point(10, 10, 1));
+    registry.deletePoint(0);
+    registry.addPoint(Point(20, 20, 2));
+    registry.addPoint(Point(30, 30, 0));
+
+    vector<Point> expected_points = {Point(10, 10, 1), Point(20, 20, 2), Point(30, 30, 0)};
+    EXPECT_EQ(registry.getPoints(), expected_points);
+    EXPECT_EQ(*registry.findPoint(0), Point(30, 30, 0));
+}
+
+
+TEST(PointRegistryTest, pointWithSameIdIsReplacedInPlace) {
+    PointRegistry registry;
+    registry.addPoint(Point(0, 0, 0));
+    registry.addPoint(Point(10, 10, 1));
+    registry.addPoint(Point(5, 5, 0));
+
+    vector<Point> expected_points = {Point(5, 5, 0), Point(10, 10, 1)};
+    EXPECT_EQ(registry.getPoints(), expected_points);
+    EXPECT_EQ(registry.getSize(), 2);
+}
+
+
+TEST(PointRegistryTest, deletingAllPointsEmptiesRegistry) {
+    PointRegistry registry;
+    unsigned int POINTS_NUMBER = 1000;
+    for (unsigned int id = 0; id < POINTS_NUMBER; id ++) {
+        registry.addPoint(Point(id, id, id));
+    }
+    for (unsigned int id = 0; id < POINTS_NUMBER; id += 2) {
+        registry.deletePoint(id);
+    }
+
+    EXPECT_EQ(registry.getPoints().size(), POINTS_NUMBER / 2);
+    EXPECT_EQ(registry.getPoints().front().getId(), 1);
+
+    for (unsigned int id = 1; id < POINTS_NUMBER; id += 2) {
+        registry.deletePoint(id);
+    }
+    EXPECT_TRUE(registry.isEmpty());
+    EXPECT_TRUE(registry.getPoints().empty());
+}
@@ -55,3 +55,16 @@ TEST(RenderTimeControllerTest, updateFollowsSpeedMultiplier) {
 
     EXPECT_GT(delta_fast, delta_slow);
 }
+
+TEST(RenderTimeControllerTest, renderLagIsDistanceToSimulationTime) {
+    StateInterpolator interpolator;
+    SimulationSnapshot snapshot;
+    snapshot.simulation_time_ = 5000.0;
+    interpolator.addSimulationSnapshot(snapshot);
+    RenderTimeController controller(interpolator);
+
+    controller.update(0.0);
+
+    EXPECT_DOUBLE_EQ(controller.getRenderLagMs(), 5000.0 - controller.getSmoothedTime());
+    EXPECT_GT(controller.getRenderLagMs(), 0.0);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <QApplication>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../include/RenderWorker.h"
+#include "../include/StateInterpolator.h"
+
+namespace {
+    int argc = 0;
+    char *argv[] = {};
+    QApplication* app = nullptr;
+
+    void ensureApplication() {
+        if (!QApplication::instance()) {
+            app = new QApplication(argc, argv);
+        }
+    }
+
+    StaticSimulationData createStaticData() {
+        StaticSimulationData data;
+        data.lawn_width_ = 100;
+        data.lawn_length_ = 100;
+        data.width_cm_ = 20.0;
+        data.length_cm = 20.0;
+        data.blade_diameter_cm = 10.0;
+        return data;
+    }
+}
+
+TEST(RenderWorkerTest, noFrameBeforeTargetSizeIsKnown) {
+    ensureApplication();
+    StateInterpolator interpolator;
+    RenderWorker worker(interpolator);
+
+    worker.composeFrame();
+
+    EXPECT_TRUE(worker.getLatestFrame().isNull());
+}
+
+TEST(RenderWorkerTest, composeFrameProducesFrameOfTargetSize) {
+    ensureApplication();
+    StateInterpolator interpolator;
+    interpolator.setStaticSimulationData(createStaticData());
+    SimulationSnapshot snapshot;
+    snapshot.fields_ = FieldGrid(10, 10);
+    interpolator.addSimulationSnapshot(snapshot);
+    RenderWorker worker(interpolator);
+
+    worker.setTargetSize(320, 240);
+    worker.composeFrame();
+    QImage frame = worker.getLatestFrame();
+
+    EXPECT_FALSE(frame.isNull());
+    EXPECT_EQ(frame.width(), 320);
+    EXPECT_EQ(frame.height(), 240);
+    EXPECT_GE(worker.getLastCompositionTimeMs(), 0.0);
+}
+
+TEST(RenderWorkerTest, latestFrameIsNotOverwrittenByNextComposition) {
+    ensureApplication();
+    StateInterpolator interpolator;
+    interpolator.setStaticSimulationData(createStaticData());
+    RenderWorker worker(interpolator);
+    worker.setTargetSize(100, 100);
+
+    worker.composeFrame();
+    QImage first_frame = worker.getLatestFrame();
+    worker.setTargetSize(200, 200);
+    worker.composeFrame();
+
+    EXPECT_EQ(first_frame.width(), 100);
+    EXPECT_EQ(worker.getLatestFrame().width(), 200);
+}
+
+TEST(RenderWorkerTest, startedWorkerNotifiesAboutFinishedFrames) {
+    ensureApplication();
+    StateInterpolator interpolator;
+    interpolator.setStaticSimulationData(createStaticData());
+    RenderWorker worker(interpolator);
+    std::atomic<int> frames_ready(0);
+    worker.setFrameReadyCallback([&frames_ready]() { frames_ready++; });
+    worker.setTargetSize(100, 100);
+    worker.setFrameInterval(5);
+
+    worker.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    worker.stop();
+
+    EXPECT_FALSE(worker.isRunning());
+    EXPECT_GT(frames_ready.load(), 0);
+    EXPECT_GT(worker.getAverageCompositionTimeMs(), 0.0);
+}
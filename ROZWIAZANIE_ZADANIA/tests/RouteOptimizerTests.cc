@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "RouteOptimizer.h"
+
+namespace {
+    std::vector<Point> orderPoints(const std::vector<Point>& points, const std::vector<unsigned int>& ids) {
+        std::vector<Point> ordered_points;
+        for (unsigned int id : ids) {
+            ordered_points.push_back(points[id]);
+        }
+        return ordered_points;
+    }
+}
+
+TEST(RouteOptimizerTest, emptyRouteTakesNoTime) {
+    RouteOptimizer optimizer(100);
+
+    OptimizedRoute route = optimizer.optimize({0, 0}, 0, {});
+
+    EXPECT_TRUE(route.point_ids_.empty());
+    EXPECT_DOUBLE_EQ(route.predicted_time_, 0.0);
+    EXPECT_TRUE(route.is_local_optimum_);
+}
+
+TEST(RouteOptimizerTest, routeTimeCountsMovesAndRotations) {
+    RouteOptimizer optimizer(100);
+    std::vector<Point> points = {Point(0, 100, 0), Point(100, 100, 1), Point(100, 100, 2)};
+
+    // 1 s up, rotation by 90 degrees, 1 s right, the last point needs no rotation
+    EXPECT_NEAR(optimizer.calculateRouteTime({0, 0}, 0, points), 3.0, 1e-9);
+    EXPECT_NEAR(optimizer.calculateRouteTime({0, 0}, 90, points), 4.0, 1e-9);
+}
+
+TEST(RouteOptimizerTest, pointsOnLineAreVisitedInOrderOfDistance) {
+    RouteOptimizer optimizer(100);
+    std::vector<Point> points = {Point(0, 300, 0), Point(0, 100, 1), Point(0, 400, 2), Point(0, 200, 3)};
+
+    OptimizedRoute route = optimizer.optimize({0, 0}, 0, points);
+
+    EXPECT_EQ(route.point_ids_, std::vector<unsigned int>({1, 3, 0, 2}));
+    EXPECT_NEAR(route.predicted_time_, 4.0, 1e-9);
+    EXPECT_NEAR(route.given_order_time_, 10.0 + 3 * 2.0, 1e-9);
+}
+
+TEST(RouteOptimizerTest, rotationsChangeBestOrder) {
+    RouteOptimizer optimizer(100);
+    std::vector<Point> points = {Point(0, -90, 0), Point(0, 200, 1)};
+
+    OptimizedRoute route = optimizer.optimize({0, 0}, 0, points);
+
+    // The point behind the mower is closer, but turning back to it twice takes longer
+    EXPECT_EQ(route.point_ids_, std::vector<unsigned int>({1, 0}));
+    EXPECT_NEAR(route.predicted_time_, 2.0 + 2.0 + 2.9, 1e-9);
+    EXPECT_NEAR(route.given_order_time_, 2.0 + 0.9 + 2.0 + 2.9, 1e-9);
+}
+
+TEST(RouteOptimizerTest, optimizedRouteIsShorterThanRandomOrder) {
+    RouteOptimizer optimizer(100, 1.0);
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> distribution(0, 5000);
+    std::vector<Point> points;
+    for (unsigned int id = 0; id < 200; id++) {
+        points.push_back(Point(distribution(generator), distribution(generator), id));
+    }
+
+    OptimizedRoute route = optimizer.optimize({0, 0}, 45, points);
+
+    std::vector<unsigned int> sorted_ids = route.point_ids_;
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    for (unsigned int id = 0; id < 200; id++) {
+        ASSERT_EQ(sorted_ids[id], id);
+    }
+    EXPECT_TRUE(route.is_local_optimum_);
+    EXPECT_GT(route.improvements_number_, 0);
+    EXPECT_LT(route.predicted_time_, route.given_order_time_ / 2);
+    EXPECT_NEAR(route.predicted_time_, optimizer.calculateRouteTime({0, 0}, 45, orderPoints(points,
+        route.point_ids_)), 1e-6);
+}
+
+TEST(RouteOptimizerTest, routeWithoutTimeBudgetKeepsAllPoints) {
+    RouteOptimizer optimizer(100, 0.0);
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> distribution(0, 5000);
+    std::vector<Point> points;
+    for (unsigned int id = 0; id < 100; id++) {
+        points.push_back(Point(distribution(generator), distribution(generator), id));
+    }
+
+    OptimizedRoute route = optimizer.optimize({0, 0}, 0, points);
+
+    EXPECT_EQ(route.point_ids_.size(), 100);
+    EXPECT_FALSE(route.is_local_optimum_);
+    EXPECT_EQ(route.improvements_number_, 0);
+    EXPECT_LE(route.predicted_time_, route.given_order_time_);
+}
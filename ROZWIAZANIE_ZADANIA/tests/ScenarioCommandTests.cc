@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include "ScenarioCommand.h"
+
+TEST(ScenarioCommandTest, binaryCommandsAreReadBack) {
+    std::vector<ScenarioCommand> commands = {
+        ScenarioCommand(ScenarioCommandType::MOVE, 12.5),
+        ScenarioCommand(ScenarioCommandType::ROTATE, -90.0),
+        ScenarioCommand(ScenarioCommandType::MOWING_ON),
+        ScenarioCommand(ScenarioCommandType::MOWING_OFF),
+        ScenarioCommand(ScenarioCommandType::ADD_POINT, 100.25, 200.5),
+        ScenarioCommand(ScenarioCommandType::DELETE_POINT, 3.0),
+        ScenarioCommand(ScenarioCommandType::MOVE_TO_POINT, 4.0),
+        ScenarioCommand(ScenarioCommandType::ROTATE_TOWARDS_POINT, 5.0),
+        ScenarioCommand(ScenarioCommandType::GET_DISTANCE_TO_POINT, 6.0),
+        ScenarioCommand(ScenarioCommandType::GET_CURRENT_POSITION),
+        ScenarioCommand(ScenarioCommandType::ARC, 150.0, -270.5)
+    };
+    std::stringstream stream;
+
+    for (const ScenarioCommand& command : commands) {
+        command.writeBinary(stream);
+    }
+    ScenarioCommand command;
+    for (const ScenarioCommand& expected_command : commands) {
+        ASSERT_TRUE(command.readBinary(stream));
+        EXPECT_EQ(command, expected_command);
+    }
+    EXPECT_FALSE(command.readBinary(stream));
+}
+
+TEST(ScenarioCommandTest, binaryCommandsAreCompact) {
+    std::stringstream stream;
+
+    ScenarioCommand(ScenarioCommandType::ROTATE, 1.0).writeBinary(stream);
+    EXPECT_EQ(stream.str().size(), 3);
+    ScenarioCommand(ScenarioCommandType::MOVE, 1.0).writeBinary(stream);
+    EXPECT_EQ(stream.str().size(), 12);
+    ScenarioCommand(ScenarioCommandType::MOWING_ON).writeBinary(stream);
+    EXPECT_EQ(stream.str().size(), 13);
+}
+
+TEST(ScenarioCommandTest, damagedBinaryCommandIsNotRead) {
+    std::stringstream truncated_stream;
+    ScenarioCommand(ScenarioCommandType::ADD_POINT, 1.0, 2.0).writeBinary(truncated_stream);
+    std::string data = truncated_stream.str();
+    std::stringstream damaged_stream(data.substr(0, data.size() - 1));
+    std::stringstream unknown_type_stream(std::string(1, static_cast<char>(200)));
+    ScenarioCommand command;
+
+    EXPECT_FALSE(command.readBinary(damaged_stream));
+    EXPECT_FALSE(command.readBinary(unknown_type_stream));
+}
+
+TEST(ScenarioCommandTest, binaryHeaderIsReadBack) {
+    ScenarioParameters parameters;
+    parameters.lawn_width_ = 800;
+    parameters.lawn_length_ = 600;
+    parameters.mower_width_ = 50;
+    parameters.mower_length_ = 40;
+    parameters.blade_diameter_ = 30;
+    parameters.speed_ = 100;
+    parameters.starting_x_ = 25.5;
+    parameters.starting_y_ = 30.0;
+    parameters.starting_angle_ = 90;
+    std::stringstream stream;
+    ScenarioParameters read_parameters;
+
+    ScenarioCommand::writeBinaryHeader(stream, parameters);
+
+    ASSERT_TRUE(ScenarioCommand::readBinaryHeader(stream, read_parameters));
+    EXPECT_EQ(read_parameters.lawn_width_, 800);
+    EXPECT_EQ(read_parameters.lawn_length_, 600);
+    EXPECT_EQ(read_parameters.mower_width_, 50);
+    EXPECT_EQ(read_parameters.mower_length_, 40);
+    EXPECT_EQ(read_parameters.blade_diameter_, 30);
+    EXPECT_EQ(read_parameters.speed_, 100);
+    EXPECT_DOUBLE_EQ(read_parameters.starting_x_, 25.5);
+    EXPECT_DOUBLE_EQ(read_parameters.starting_y_, 30.0);
+    EXPECT_EQ(read_parameters.starting_angle_, 90);
+}
+
+TEST(ScenarioCommandTest, headerOfOtherFileIsNotRead) {
+    std::stringstream stream("lawn 800 600\n");
+    ScenarioParameters parameters;
+
+    EXPECT_FALSE(ScenarioCommand::readBinaryHeader(stream, parameters));
+}
+
+TEST(ScenarioCommandTest, textLineUsesKeywordAndValues) {
+    std::stringstream stream;
+
+    ScenarioCommand(ScenarioCommandType::MOVE, 12.5).writeTextLine(stream);
+    ScenarioCommand(ScenarioCommandType::MOWING_OFF).writeTextLine(stream);
+    ScenarioCommand(ScenarioCommandType::ADD_POINT, 100.0, 0.1).writeTextLine(stream);
+    ScenarioCommand(ScenarioCommandType::MOVE_TO_POINT, 7.0).writeTextLine(stream);
+
+    EXPECT_EQ(stream.str(), "move 12.5\nmowing off\nadd_point 100 0.1\nmove_to_point 7\n");
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include "ScenarioReader.h"
+#include "ScenarioWriter.h"
+#include "MowerController.h"
+#include "Exceptions.h"
+#include "Config.h"
+
+namespace {
+    void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+    }
+
+    std::string getErrorMessage(const std::string& path) {
+        try {
+            ScenarioReader reader(path);
+            ScenarioCommand command;
+            while (reader.readCommand(command)) {}
+        } catch (const ScenarioFormatError& error) {
+            return error.what();
+        }
+        return "";
+    }
+}
+
+TEST(ScenarioReaderTest, textScenarioIsParsed) {
+    std::string path = "test_scenario_reader.txt";
+    writeFile(path,
+        "# square\n"
+        "lawn 800 600\n"
+        "mower 50 40 30 100\n"
+        "start 25.5 30 90\n"
+        "\n"
+        "mowing on   # blades on\n"
+        "add_point 100.5 200\n"
+        "move 12.25\n"
+        "rotate -90\n"
+        "move_to_point 0\n"
+        "arc 150 -90.5\n"
+        "position\n");
+    ScenarioReader reader(path);
+    ScenarioCommand command;
+
+    EXPECT_EQ(reader.getFormat(), ScenarioFormat::TEXT);
+    EXPECT_EQ(reader.getParameters().lawn_width_, 800);
+    EXPECT_EQ(reader.getParameters().lawn_length_, 600);
+    EXPECT_EQ(reader.getParameters().mower_width_, 50);
+    EXPECT_EQ(reader.getParameters().mower_length_, 40);
+    EXPECT_EQ(reader.getParameters().blade_diameter_, 30);
+    EXPECT_EQ(reader.getParameters().speed_, 100);
+    EXPECT_DOUBLE_EQ(reader.getParameters().starting_x_, 25.5);
+    EXPECT_DOUBLE_EQ(reader.getParameters().starting_y_, 30.0);
+    EXPECT_EQ(reader.getParameters().starting_angle_, 90);
+
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::MOWING_ON));
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::ADD_POINT, 100.5, 200.0));
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::MOVE, 12.25));
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::ROTATE, -90.0));
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::MOVE_TO_POINT, 0.0));
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::ARC, 150.0, -90.5));
+    ASSERT_TRUE(reader.readCommand(command));
+    EXPECT_EQ(command, ScenarioCommand(ScenarioCommandType::GET_CURRENT_POSITION));
+    EXPECT_FALSE(reader.readCommand(command));
+    EXPECT_TRUE(reader.isFinished());
+    EXPECT_EQ(reader.getReadCommandsNumber(), 7);
+}
+
+TEST(ScenarioReaderTest, errorsContainLineNumber) {
+    std::string path = "test_scenario_reader_errors.txt";
+
+    writeFile(path, "lawn 800 600\nmower 50 50 50 100\nmove 10\njump 10\n");
+    EXPECT_NE(getErrorMessage(path).find("line 4: unknown command 'jump'"), std::string::npos);
+
+    writeFile(path, "lawn 800 600\nmower 50 50 50 100\nrotate 12.5\n");
+    EXPECT_NE(getErrorMessage(path).find("line 3"), std::string::npos);
+
+    writeFile(path, "lawn 800 600\nmower 50 50 50 100\nmove 10 20\n");
+    EXPECT_NE(getErrorMessage(path).find("line 3"), std::string::npos);
+
+    writeFile(path, "lawn 800 600\nmower 50 50 50 100\nmowing maybe\n");
+    EXPECT_NE(getErrorMessage(path).find("line 3"), std::string::npos);
+
+    writeFile(path, "lawn 800\nmower 50 50 50 100\n");
+    EXPECT_NE(getErrorMessage(path).find("line 1"), std::string::npos);
+}
+
+TEST(ScenarioReaderTest, scenarioWithoutParametersIsRejected) {
+    std::string path = "test_scenario_reader_no_mower.txt";
+    writeFile(path, "lawn 800 600\nmove 10\n");
+
+    EXPECT_THROW(ScenarioReader reader(path), ScenarioFormatError);
+    EXPECT_THROW(ScenarioReader reader("not_existing_scenario.txt"), ScenarioFormatError);
+}
+
+TEST(ScenarioReaderTest, binaryScenarioIsReadLikeText) {
+    std::string text_path = "test_scenario_reader_text.txt";
+    std::string binary_path = "test_scenario_reader.bin";
+    writeFile(text_path, "lawn 800 600\nmower 50 50 50 100\nmowing off\nmove 10.5\nrotate 45\nadd_point 1 2\n"
+        "rotate_towards_point 0\ndelete_point 0\ndistance_to_point 1\n");
+    ScenarioReader text_reader(text_path);
+    ScenarioWriter writer(binary_path, text_reader.getParameters());
+    ScenarioCommand command;
+    while (text_reader.readCommand(command)) {
+        writer.write(command);
+    }
+    writer.close();
+
+    ScenarioReader text_reader_again(text_path);
+    ScenarioReader binary_reader(binary_path);
+    ScenarioCommand binary_command;
+
+    EXPECT_EQ(binary_reader.getFormat(), ScenarioFormat::BINARY);
+    EXPECT_EQ(binary_reader.getParameters().lawn_width_, 800);
+    EXPECT_EQ(binary_reader.getParameters().speed_, 100);
+    while (text_reader_again.readCommand(command)) {
+        ASSERT_TRUE(binary_reader.readCommand(binary_command));
+        EXPECT_EQ(binary_command, command);
+    }
+    EXPECT_FALSE(binary_reader.readCommand(binary_command));
+    EXPECT_EQ(binary_reader.getReadCommandsNumber(), 7);
+}
+
+TEST(ScenarioReaderTest, damagedBinaryScenarioThrows) {
+    std::string path = "test_scenario_reader_damaged.bin";
+    ScenarioParameters parameters;
+    parameters.lawn_width_ = parameters.lawn_length_ = 1000;
+    parameters.mower_width_ = parameters.mower_length_ = parameters.blade_diameter_ = 50;
+    parameters.speed_ = 100;
+    {
+        ScenarioWriter writer(path, parameters);
+        writer.write(ScenarioCommand(ScenarioCommandType::MOVE, 10.0));
+    }
+    std::ofstream(path, std::ios::binary | std::ios::app).put(0); // MOVE without distance
+    ScenarioReader reader(path);
+    ScenarioCommand command;
+
+    EXPECT_TRUE(reader.readCommand(command));
+    EXPECT_THROW(reader.readCommand(command), ScenarioFormatError);
+}
+
+TEST(ScenarioReaderTest, controllerIsFedInBatches) {
+    std::string path = "test_scenario_reader_batches.bin";
+    ScenarioParameters parameters;
+    parameters.lawn_width_ = parameters.lawn_length_ = 1000;
+    parameters.mower_width_ = parameters.mower_length_ = parameters.blade_diameter_ = 50;
+    parameters.speed_ = 100;
+    size_t commands_number = 3 * ScenarioReader::FEED_BATCH_SIZE;
+    {
+        ScenarioWriter writer(path, parameters);
+        for (size_t i = 0; i < commands_number; ++i) {
+            writer.write(ScenarioCommand(ScenarioCommandType::MOVE, 0.1));
+        }
+    }
+    ScenarioReader reader(path);
+    MowerController controller;
+
+    EXPECT_EQ(reader.feedController(controller), ScenarioReader::FEED_BATCH_SIZE);
+    EXPECT_EQ(reader.feedController(controller), 0);
+    EXPECT_EQ(controller.getQueueSize(), ScenarioReader::FEED_BATCH_SIZE);
+    EXPECT_FALSE(reader.isFinished());
+}
+
+TEST(ScenarioReaderTest, scenarioIsExecutedByController) {
+    std::string path = "test_scenario_reader_run.txt";
+    writeFile(path, "lawn 1000 1000\nmower 50 50 50 100\nstart 500 500 0\nmowing off\nmove 100\nrotate 90\n"
+        "add_point 100 100\nmove_to_point 0\n");
+    ScenarioReader reader(path);
+    const ScenarioParameters& parameters = reader.getParameters();
+    Config::initializeRuntimeConstants(parameters.lawn_width_, parameters.lawn_length_);
+    Config::initializeMowerConstants(parameters.mower_width_, parameters.mower_length_,
+        parameters.starting_x_, parameters.starting_y_, parameters.starting_angle_);
+    Lawn lawn(parameters.lawn_width_, parameters.lawn_length_);
+    Mower mower(parameters.mower_width_, parameters.mower_length_, parameters.blade_diameter_, parameters.speed_);
+    Logger logger;
+    FileLogger file_logger("test_scenario_reader_run.log");
+    StateSimulation simulation(lawn, mower, logger, file_logger);
+    MowerController controller;
+
+    reader.feedController(controller);
+    for (int i = 0; i < 100000 && controller.getQueueSize() > 0; ++i) {
+        controller.update(simulation, 0.02);
+        reader.feedController(controller);
+    }
+
+    EXPECT_TRUE(reader.isFinished());
+    EXPECT_EQ(controller.getQueueSize(), 0);
+    EXPECT_FALSE(mower.getIsMowing());
+    EXPECT_NEAR(mower.getX(), 100.0, 3.0);
+    EXPECT_NEAR(mower.getY(), 100.0, 3.0);
+}
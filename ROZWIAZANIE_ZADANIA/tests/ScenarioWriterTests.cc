@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include "ScenarioWriter.h"
+#include "Exceptions.h"
+
+namespace {
+    ScenarioParameters createParameters() {
+        ScenarioParameters parameters;
+        parameters.lawn_width_ = 800;
+        parameters.lawn_length_ = 600;
+        parameters.mower_width_ = 50;
+        parameters.mower_length_ = 50;
+        parameters.blade_diameter_ = 40;
+        parameters.speed_ = 100;
+        return parameters;
+    }
+
+    std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+}
+
+TEST(ScenarioWriterTest, textScenarioStartsWithParameters) {
+    std::string path = "test_scenario_writer.txt";
+    ScenarioWriter writer(path, createParameters(), ScenarioFormat::TEXT);
+
+    writer.write(ScenarioCommand(ScenarioCommandType::MOWING_ON));
+    writer.write(ScenarioCommand(ScenarioCommandType::MOVE, 100.0));
+    writer.close();
+
+    EXPECT_EQ(writer.getWrittenCommandsNumber(), 2);
+    EXPECT_EQ(readFile(path), "lawn 800 600\nmower 50 50 40 100\nstart 0 0 0\nmowing on\nmove 100\n");
+}
+
+TEST(ScenarioWriterTest, binaryScenarioHasHeaderAndCompactCommands) {
+    std::string path = "test_scenario_writer.bin";
+    ScenarioWriter writer(path, createParameters());
+    std::stringstream expected;
+    ScenarioCommand::writeBinaryHeader(expected, createParameters());
+    ScenarioCommand(ScenarioCommandType::ROTATE, 45.0).writeBinary(expected);
+
+    writer.write(ScenarioCommand(ScenarioCommandType::ROTATE, 45.0));
+    writer.close();
+
+    EXPECT_EQ(writer.getFormat(), ScenarioFormat::BINARY);
+    EXPECT_EQ(readFile(path), expected.str());
+}
+
+TEST(ScenarioWriterTest, writerThrowsWhenFileCannotBeCreated) {
+    EXPECT_THROW(ScenarioWriter("not_existing_directory/scenario.bin", createParameters()), ScenarioFormatError);
+}
@@ -78,6 +78,27 @@ TEST(StateInterpolatorTest, getInterpolatedStateInterpolatesLinearValues) {
     EXPECT_DOUBLE_EQ(result.y_, 30.0);
 }
 
+TEST(StateInterpolatorTest, getInterpolatedStateInterpolatesOtherMowers) {
+    StateInterpolator interpolator;
+    
+    SimulationSnapshot snapshot1;
+    snapshot1.simulation_time_ = 1000.0;
+    snapshot1.other_mowers_ = {MowerPose{100.0, 0.0, 10.0}};
+    interpolator.addSimulationSnapshot(snapshot1);
+
+    SimulationSnapshot snapshot2;
+    snapshot2.simulation_time_ = 2000.0;
+    snapshot2.other_mowers_ = {MowerPose{200.0, 50.0, 30.0}};
+    interpolator.addSimulationSnapshot(snapshot2);
+
+    SimulationSnapshot result = interpolator.getInterpolatedState(1500.0);
+
+    ASSERT_EQ(result.other_mowers_.size(), 1);
+    EXPECT_DOUBLE_EQ(result.other_mowers_[0].x_, 150.0);
+    EXPECT_DOUBLE_EQ(result.other_mowers_[0].y_, 25.0);
+    EXPECT_DOUBLE_EQ(result.other_mowers_[0].angle_, 20.0);
+}
+
 TEST(StateInterpolatorTest, getInterpolatedStateInterpolatesAngle) {
     StateInterpolator interpolator;
     
@@ -178,3 +199,15 @@ TEST(StateInterpolatorTest, getSimulationTimeReturnsZeroIfEmpty) {
 
     EXPECT_DOUBLE_EQ(sim_time, 0.0);
 }
+
+TEST(StateInterpolatorTest, bufferedSnapshotsCountIsLimitedByCapacity) {
+    StateInterpolator interpolator;
+
+    for (size_t i = 1; i <= StateInterpolator::getBufferCapacity() + 10; ++i) {
+        SimulationSnapshot snapshot;
+        snapshot.simulation_time_ = static_cast<double>(i);
+        interpolator.addSimulationSnapshot(snapshot);
+    }
+
+    EXPECT_EQ(interpolator.getBufferedSnapshotsCount(), StateInterpolator::getBufferCapacity());
+}
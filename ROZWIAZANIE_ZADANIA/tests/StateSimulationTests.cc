@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include "../include/Constants.h"
 #include "../include/Config.h"
 #include "../include/Mower.h"
@@ -526,6 +529,31 @@ TEST(SimulateRotation, invalidAngleTooSmall) {
 }
 
 
+TEST(SimulateRotation, negativeAngleTakesSameTime) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 0, 0, 90);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    short rotation = -90;
+    unsigned short result_angle = 0;
+    uint64_t result_time = 1000;
+
+    stateSimulation.simulateRotation(rotation);
+
+    EXPECT_EQ(result_angle, mower.getAngle());
+    EXPECT_EQ(result_time, stateSimulation.getTime());
+}
+
+
 TEST(SimulateMowingOptionOn, turnOn) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
@@ -681,6 +709,36 @@ TEST(SimulateDeletePoint, deletePointInvalidId) {
 }
 
 
+TEST(SimulateDeletePoint, addingAndDeletingPointsIsNotSavedInLogFile) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 0, 0, 90);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    string log_path = "state_simulation_points_test.log";
+    remove(log_path.c_str());
+    FileLogger fileLogger = FileLogger(log_path);
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    stateSimulation.simulateAddPoint(500, 500);
+    stateSimulation.simulateAddPoint(2000, 500);
+    stateSimulation.simulateDeletePoint(0);
+    stateSimulation.simulateDeletePoint(3);
+    fileLogger.flush();
+
+    ifstream file(log_path);
+    stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(content.str(), "");
+    EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 2);
+}
+
+
 TEST(SimulateMovementToPoint, moveToPoint) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
@@ -798,3 +856,366 @@ TEST(SimulateMovementToPoint, moveToPointCustom) {
     EXPECT_EQ(mower.getY(), 24);
     EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 0);
 }
+
+
+TEST(CuttingTime, cuttingTimeGrowsOnlyWhenMowing) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateMowingOptionOff();
+    stateSimulation.simulateMovement(100);
+    EXPECT_EQ(stateSimulation.getCuttingTimeMs(), 0.0);
+
+    stateSimulation.simulateMowingOptionOn();
+    stateSimulation.simulateMovement(100);
+    EXPECT_GT(stateSimulation.getCuttingTimeMs(), 0.0);
+}
+
+
+TEST(SimulateSegment, segmentIsOneMovement) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateSegment(500);
+
+    EXPECT_NEAR(stateSimulation.getMower().getY(), 600.0, Constants::DISTANCE_PRECISION);
+    EXPECT_EQ(stateSimulation.getTime(), 5000);
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+}
+
+
+TEST(SimulateSegment, intermediatePosesAreSentToCallback) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    vector<SimulationSnapshot> snapshots;
+    stateSimulation.setSnapshotCallback([&snapshots](const SimulationSnapshot& sim_snapshot) {
+        snapshots.push_back(sim_snapshot);
+    });
+
+    stateSimulation.simulateSegment(500);
+
+    ASSERT_EQ(snapshots.size(), 24);
+    for (size_t i = 0; i < snapshots.size(); i ++) {
+        double progress = static_cast<double>(i + 1) / 25.0;
+        EXPECT_NEAR(snapshots[i].simulation_time_, 5000.0 * progress, 1e-6);
+        EXPECT_NEAR(snapshots[i].y_, 100.0 + 500.0 * progress, 1e-6);
+        EXPECT_DOUBLE_EQ(snapshots[i].x_, 500.0);
+    }
+}
+
+
+TEST(DeferredCutting, movementCollectsFieldsWithoutCutting) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    stateSimulation.setCuttingDeferred(true);
+
+    stateSimulation.simulateMovement(100);
+
+    EXPECT_TRUE(stateSimulation.isCuttingDeferred());
+    EXPECT_FALSE(stateSimulation.getPendingFields().empty());
+    EXPECT_EQ(lawn.calculateShavedArea(), 0.0);
+
+    stateSimulation.cutPendingFields();
+
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+    EXPECT_TRUE(stateSimulation.getPendingFields().empty());
+}
+
+
+TEST(PassCounting, returningOverTheSameStripeCountsTwoPasses) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateMowingOptionOn();
+    stateSimulation.simulateMovement(300);
+    stateSimulation.simulateRotation(180);
+    stateSimulation.simulateMovement(300);
+
+    pair<unsigned int, unsigned int> indexes = lawn.calculateFieldIndexes(500, 250);
+    size_t index = static_cast<size_t>(indexes.second) * lawn.getFieldGrid().getColumnsNumber() + indexes.first;
+    EXPECT_EQ(lawn.getPassCounts()[index], 2);
+    EXPECT_GT(lawn.calculateOverlapRatio(), 0.4);
+}
+
+
+TEST(PassCounting, movementsInOneDirectionAreOnePass) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.enablePassCounting();
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateMowingOptionOn();
+    stateSimulation.simulateMovement(150);
+    stateSimulation.beginPass();
+    stateSimulation.simulateMovement(150);
+
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+    EXPECT_EQ(lawn.calculateOverlapRatio(), 0.0);
+}
+
+
+TEST(LogFiltering, onlyErrorsAreSavedWithErrorLevel) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 105;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    string log_path = "state_simulation_filter_test.log";
+    remove(log_path.c_str());
+    FileLogger fileLogger = FileLogger(log_path);
+    fileLogger.getFilter().setMinLevel(LogLevel::ERROR);
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateMowingOptionOn();
+    stateSimulation.simulateMovement(100);
+    stateSimulation.simulateRotation(90);
+    EXPECT_THROW(stateSimulation.simulateMovement(1000), MoveOutsideLawnError);
+    fileLogger.flush();
+
+    ifstream file(log_path);
+    stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(content.str(), "Time: 1960: Attempted to move outside the lawn.\n");
+    EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 1);
+}
+
+
+TEST(SimulateArcMovement, quarterCircleEndsOnArc) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 90);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateMowingOptionOn();
+    stateSimulation.simulateArcMovement(pair<double, double>(500, 300), 200, 180, -90);
+
+    EXPECT_NEAR(stateSimulation.getMower().getX(), 700.0, Constants::DISTANCE_PRECISION);
+    EXPECT_NEAR(stateSimulation.getMower().getY(), 300.0, Constants::DISTANCE_PRECISION);
+    EXPECT_EQ(stateSimulation.getMower().getAngle(), 0);
+    EXPECT_EQ(stateSimulation.getTime(), 3150);
+    EXPECT_GT(lawn.calculateShavedArea(), 0.0);
+}
+
+
+TEST(SimulateArcMovement, arcOutsideLawnThrows) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 90);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    EXPECT_THROW(stateSimulation.simulateArcMovement(pair<double, double>(500, 700), 600, 180, 90), 
+        MoveOutsideLawnError);
+    EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 1);
+    EXPECT_DOUBLE_EQ(stateSimulation.getMower().getX(), 500.0);
+}
+
+
+TEST(SimulateLineMovement, mowerReachesPointAndFacesIt) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    stateSimulation.simulateLineMovement(600, 200);
+
+    EXPECT_DOUBLE_EQ(stateSimulation.getMower().getX(), 600.0);
+    EXPECT_DOUBLE_EQ(stateSimulation.getMower().getY(), 200.0);
+    EXPECT_EQ(stateSimulation.getMower().getAngle(), 45);
+    EXPECT_EQ(stateSimulation.getTime(), 1420);
+}
+
+
+TEST(SimulateMovement, moveIntoObstacleIsLoggedAndStopped) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addCircleObstacle(pair<double, double>(500, 400), 50, ObstacleType::OBSTACLE);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    EXPECT_THROW(stateSimulation.simulateMovement(300), ObstacleCollisionError);
+    EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 1);
+    EXPECT_EQ(stateSimulation.getLogger().getLogs()[0].getMessage(), "Attempted to move into an obstacle.");
+    EXPECT_DOUBLE_EQ(stateSimulation.getMower().getY(), 100.0);
+}
+
+
+TEST(SimulateArcMovement, arcThroughObstacleIsStopped) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 270);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addCircleObstacle(pair<double, double>(100, 500), 30, ObstacleType::NO_GO_ZONE);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+
+    EXPECT_THROW(stateSimulation.simulateArcMovement(pair<double, double>(500, 500), 400, 180, 180), 
+        ObstacleCollisionError);
+    EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 1);
+    EXPECT_DOUBLE_EQ(stateSimulation.getMower().getY(), 100.0);
+}
+
+
+TEST(SimulateMovementToPoint, moveToPointAroundObstacle) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    unsigned int width = 120;
+    unsigned int length = 100;
+    unsigned int blade_diameter = 90;
+    unsigned int speed = 100;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(width, length, 500.0, 100.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    lawn.addCircleObstacle(pair<double, double>(500, 500), 100, ObstacleType::OBSTACLE);
+    Mower mower = Mower(width, length, blade_diameter, speed);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    stateSimulation.simulateAddPoint(500, 900);
+
+    vector<pair<double, double>> waypoints = stateSimulation.planPathToPoint(0);
+    stateSimulation.simulateMovementToPoint(0);
+
+    EXPECT_GT(waypoints.size(), 1);
+    EXPECT_NEAR(mower.getX(), 500, Constants::DISTANCE_PRECISION);
+    EXPECT_NEAR(mower.getY(), 900, Constants::DISTANCE_PRECISION);
+    EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 0);
+}
+
+
+TEST(FindNearestPoint, deletedPointsAreNotFound) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config::initializeMowerConstants(120, 100, 0.0, 0.0, 0);
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    Mower mower = Mower(120, 100, 90, 100);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("example_path");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    stateSimulation.simulateAddPoint(500, 500);
+    stateSimulation.simulateAddPoint(520, 500);
+    stateSimulation.simulateAddPoint(900, 900);
+
+    EXPECT_EQ(stateSimulation.findNearestPoint(490, 500)->getId(), 0);
+    EXPECT_EQ(stateSimulation.findPointsInRadius(500, 500, 50).size(), 2);
+
+    stateSimulation.simulateDeletePoint(0);
+
+    EXPECT_EQ(stateSimulation.findNearestPoint(490, 500)->getId(), 1);
+    EXPECT_EQ(stateSimulation.findPointsInRadius(500, 500, 50).size(), 1);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "../include/ThreadPool.h"
+
+using namespace std;
+
+TEST(ThreadPoolTest, createsRequestedNumberOfThreads) {
+    ThreadPool pool(3);
+
+    EXPECT_EQ(pool.getThreadsNumber(), 3);
+}
+
+TEST(ThreadPoolTest, zeroThreadsMeansAtLeastOneThread) {
+    ThreadPool pool(0);
+
+    EXPECT_GE(pool.getThreadsNumber(), 1);
+}
+
+TEST(ThreadPoolTest, submittedTaskIsExecuted) {
+    ThreadPool pool(2);
+    atomic<int> counter{0};
+
+    future<void> result = pool.submit([&counter]() { counter++; });
+    result.get();
+
+    EXPECT_EQ(counter.load(), 1);
+}
+
+TEST(ThreadPoolTest, runForEachRunsEveryIndexOnce) {
+    ThreadPool pool(4);
+    vector<int> runs(100, 0);
+
+    pool.runForEach(runs.size(), [&runs](size_t index) { runs[index]++; });
+
+    for (int run : runs) {
+        EXPECT_EQ(run, 1);
+    }
+}
+
+TEST(ThreadPoolTest, runForEachWaitsForAllTasksAndRethrows) {
+    ThreadPool pool(2);
+    atomic<int> finished{0};
+
+    EXPECT_THROW(pool.runForEach(10, [&finished](size_t index) {
+        if (index == 0) {
+            throw runtime_error("task failed");
+        }
+        finished++;
+    }), runtime_error);
+
+    EXPECT_EQ(finished.load(), 9);
+}
+
+TEST(ThreadPoolTest, destructorFinishesQueuedTasks) {
+    atomic<int> counter{0};
+    {
+        ThreadPool pool(1);
+        for (int i = 0; i < 20; ++i) {
+            pool.submit([&counter]() { counter++; });
+        }
+    }
+
+    EXPECT_EQ(counter.load(), 20);
+}
+
+TEST(ThreadPoolTest, runForEachWithoutTasksReturnsImmediately) {
+    ThreadPool pool(2);
+    int runs = 0;
+
+    pool.runForEach(0, [&runs](size_t index) { runs++; });
+
+    EXPECT_EQ(runs, 0);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "../include/Viewport.h"
+
+using namespace std;
+
+namespace {
+    Viewport createViewport(double lawn_width, double lawn_length, double screen_width, double screen_height) {
+        Viewport viewport;
+        viewport.setLawnSize(lawn_width, lawn_length);
+        viewport.setScreenSize(screen_width, screen_height);
+        return viewport;
+    }
+}
+
+TEST(ViewportTest, defaultModeFitsWholeLawn) {
+    Viewport viewport = createViewport(1000.0, 500.0, 800.0, 600.0);
+
+    EXPECT_EQ(viewport.getMode(), Viewport::Mode::FIT_LAWN);
+    EXPECT_DOUBLE_EQ(viewport.getScale(), 0.8);
+}
+
+TEST(ViewportTest, mapToScreenCentersLawnAndFlipsYAxis) {
+    Viewport viewport = createViewport(1000.0, 500.0, 800.0, 600.0);
+
+    pair<double, double> bottom_left = viewport.mapToScreen(0.0, 0.0);
+    pair<double, double> top_right = viewport.mapToScreen(1000.0, 500.0);
+
+    EXPECT_DOUBLE_EQ(bottom_left.first, 0.0);
+    EXPECT_DOUBLE_EQ(bottom_left.second, 500.0);
+    EXPECT_DOUBLE_EQ(top_right.first, 800.0);
+    EXPECT_DOUBLE_EQ(top_right.second, 100.0);
+}
+
+TEST(ViewportTest, mapToWorldIsInverseOfMapToScreen) {
+    Viewport viewport = createViewport(1000.0, 500.0, 800.0, 600.0);
+    viewport.zoomAt(3.0, 100.0, 200.0);
+
+    pair<double, double> screen_pos = viewport.mapToScreen(321.0, 123.0);
+    pair<double, double> world_pos = viewport.mapToWorld(screen_pos.first, screen_pos.second);
+
+    EXPECT_NEAR(world_pos.first, 321.0, 1e-9);
+    EXPECT_NEAR(world_pos.second, 123.0, 1e-9);
+}
+
+TEST(ViewportTest, zoomKeepsPointUnderCursorInPlace) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 800.0, 800.0);
+    pair<double, double> anchor_before = viewport.mapToWorld(200.0, 600.0);
+
+    viewport.zoomAt(4.0, 200.0, 600.0);
+    pair<double, double> anchor_after = viewport.mapToWorld(200.0, 600.0);
+
+    EXPECT_EQ(viewport.getMode(), Viewport::Mode::FREE);
+    EXPECT_DOUBLE_EQ(viewport.getZoom(), 4.0);
+    EXPECT_NEAR(anchor_after.first, anchor_before.first, 1e-9);
+    EXPECT_NEAR(anchor_after.second, anchor_before.second, 1e-9);
+}
+
+TEST(ViewportTest, zoomIsLimitedAndZoomingOutResetsView) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 800.0, 800.0);
+
+    viewport.zoomAt(1e6, 400.0, 400.0);
+    EXPECT_DOUBLE_EQ(viewport.getZoom(), Viewport::MAX_ZOOM);
+
+    viewport.zoomAt(1e-6, 0.0, 0.0);
+    EXPECT_DOUBLE_EQ(viewport.getZoom(), Viewport::MIN_ZOOM);
+    EXPECT_EQ(viewport.getMode(), Viewport::Mode::FIT_LAWN);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().first, 500.0);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().second, 500.0);
+}
+
+TEST(ViewportTest, panMovesCenterAndSwitchesToFreeMode) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 1000.0, 1000.0);
+    viewport.zoomAt(2.0, 500.0, 500.0);
+
+    viewport.pan(100.0, 100.0);
+
+    EXPECT_EQ(viewport.getMode(), Viewport::Mode::FREE);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().first, 450.0);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().second, 550.0);
+}
+
+TEST(ViewportTest, panCannotMoveCenterOutsideLawn) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 1000.0, 1000.0);
+    viewport.zoomAt(2.0, 500.0, 500.0);
+
+    viewport.pan(100000.0, -100000.0);
+
+    EXPECT_DOUBLE_EQ(viewport.getCenter().first, 0.0);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().second, 0.0);
+}
+
+TEST(ViewportTest, followModeCentersOnTarget) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 800.0, 800.0);
+    viewport.setMode(Viewport::Mode::FOLLOW_MOWER);
+
+    viewport.followTarget(120.0, 730.0);
+
+    EXPECT_DOUBLE_EQ(viewport.getCenter().first, 120.0);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().second, 730.0);
+}
+
+TEST(ViewportTest, followTargetIsIgnoredOutsideFollowMode) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 800.0, 800.0);
+
+    viewport.followTarget(120.0, 730.0);
+
+    EXPECT_DOUBLE_EQ(viewport.getCenter().first, 500.0);
+    EXPECT_DOUBLE_EQ(viewport.getCenter().second, 500.0);
+}
+
+TEST(ViewportTest, visibleCellsCoverWholeGridWhenFitting) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 800.0, 800.0);
+
+    CellRange cells = viewport.calculateVisibleCells(1000, 1000);
+
+    EXPECT_EQ(cells.first_col_, 0);
+    EXPECT_EQ(cells.end_col_, 1000);
+    EXPECT_EQ(cells.first_row_, 0);
+    EXPECT_EQ(cells.end_row_, 1000);
+}
+
+TEST(ViewportTest, visibleCellsShrinkWhenZoomedIn) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 800.0, 800.0);
+    viewport.setMode(Viewport::Mode::FOLLOW_MOWER);
+    viewport.zoomAt(10.0, 400.0, 400.0);
+    viewport.followTarget(250.0, 750.0);
+
+    CellRange cells = viewport.calculateVisibleCells(1000, 1000);
+
+    EXPECT_EQ(cells.first_col_, 200);
+    EXPECT_EQ(cells.end_col_, 300);
+    EXPECT_EQ(cells.first_row_, 700);
+    EXPECT_EQ(cells.end_row_, 800);
+    EXPECT_EQ(cells.getColumnsCount() * cells.getRowsCount(), 10000);
+}
+
+TEST(ViewportTest, isPointVisibleRespectsMargin) {
+    Viewport viewport = createViewport(1000.0, 1000.0, 1000.0, 1000.0);
+    viewport.setMode(Viewport::Mode::FOLLOW_MOWER);
+    viewport.zoomAt(2.0, 500.0, 500.0);
+    viewport.followTarget(500.0, 500.0);
+
+    EXPECT_TRUE(viewport.isPointVisible(500.0, 500.0, 0.0));
+    EXPECT_FALSE(viewport.isPointVisible(760.0, 500.0, 0.0));
+    EXPECT_TRUE(viewport.isPointVisible(760.0, 500.0, 30.0));
+}
+
+TEST(ViewportTest, invalidDimensionsProduceEmptyCellRange) {
+    Viewport viewport;
+
+    CellRange cells = viewport.calculateVisibleCells(100, 100);
+
+    EXPECT_TRUE(cells.isEmpty());
+}
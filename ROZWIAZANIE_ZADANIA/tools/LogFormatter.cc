@@ -0,0 +1,51 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Renders a binary log of the simulation in the text format of the logs.
+    Usage: ./LogFormatter binary_log_path [text_log_path]
+    Without the second argument the text log is printed to the standard output.
+*/
+
+#include <fstream>
+#include <iostream>
+#include "LogRecord.h"
+
+using namespace std;
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        cerr << "Usage: " << argv[0] << " binary_log_path [text_log_path]" << endl;
+        return 1;
+    }
+
+    ifstream binary_log(argv[1], ios::binary);
+    if (!binary_log.is_open()) {
+        cerr << "Unable to open " << argv[1] << endl;
+        return 1;
+    }
+    if (!LogRecord::readBinaryHeader(binary_log)) {
+        cerr << argv[1] << " is not a binary log of the simulation" << endl;
+        return 1;
+    }
+
+    ofstream text_log;
+    if (argc == 3) {
+        text_log.open(argv[2]);
+        if (!text_log.is_open()) {
+            cerr << "Unable to open " << argv[2] << endl;
+            return 1;
+        }
+    }
+    ostream& output = argc == 3 ? text_log : cout;
+
+    LogRecord record;
+    while (record.readBinary(binary_log)) {
+        record.writeTextLine(output);
+    }
+    if (!binary_log.eof()) {
+        cerr << "The log is damaged, records after the damaged one are skipped" << endl;
+        return 1;
+    }
+    return 0;
+}
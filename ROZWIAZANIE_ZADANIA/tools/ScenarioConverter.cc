@@ -0,0 +1,51 @@
+/*
+    Author: Hanna Biegacz
+
+    Converts a scenario between the text and the binary format.
+    Usage: ./ScenarioConverter input_scenario_path output_scenario_path [text|binary]
+    Without the format argument the scenario is converted to the other format.
+*/
+
+#include <cstring>
+#include <iostream>
+#include "ScenarioReader.h"
+#include "ScenarioWriter.h"
+#include "Exceptions.h"
+
+using namespace std;
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || argc > 4) {
+        cerr << "Usage: " << argv[0] << " input_scenario_path output_scenario_path [text|binary]" << endl;
+        return 1;
+    }
+
+    try {
+        ScenarioReader reader(argv[1]);
+        ScenarioFormat output_format = reader.getFormat() == ScenarioFormat::TEXT 
+            ? ScenarioFormat::BINARY : ScenarioFormat::TEXT;
+        if (argc == 4) {
+            if (strcmp(argv[3], "text") == 0) {
+                output_format = ScenarioFormat::TEXT;
+            } else if (strcmp(argv[3], "binary") == 0) {
+                output_format = ScenarioFormat::BINARY;
+            } else {
+                cerr << "Unknown format " << argv[3] << ", expected text or binary" << endl;
+                return 1;
+            }
+        }
+
+        ScenarioWriter writer(argv[2], reader.getParameters(), output_format);
+        ScenarioCommand command;
+        while (reader.readCommand(command)) {
+            writer.write(command);
+        }
+        writer.close();
+        cout << "Converted " << writer.getWrittenCommandsNumber() << " commands" << endl;
+    } catch (const ScenarioFormatError& error) {
+        cerr << error.what() << endl;
+        return 1;
+    }
+    return 0;
+}